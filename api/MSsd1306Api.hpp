@@ -18,7 +18,7 @@
 #ifndef M_SSD_1306_M_SSD_1306_API_H
 #define M_SSD_1306_M_SSD_1306_API_H
 
-#include "../include/Ssd1306.hpp"
+#include "../include/SSD1306.hpp"
 
 #endif	// #ifndef M_SSD_1306_M_SSD_1306_API_H
 
@@ -0,0 +1,29 @@
+//!
+//! @file 				Config.h
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Project configuration used when building the benchmarks on a PC.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+#ifndef M_SSD1306_BENCHMARK_CONFIG_H
+#define M_SSD1306_BENCHMARK_CONFIG_H
+
+//===============================================================================================//
+//======================================= PUBLIC DEFINES ========================================//
+//===============================================================================================//
+
+// Debug prints would add nothing to the bus counts, but slow the benchmarks down
+#define configDEBUG_SSD1306				0
+#define configDEBUG_SSD1306_ERROR		1
+#define configDEBUG_SSD1306_VERBOSE		0
+
+#endif	// #ifndef M_SSD1306_BENCHMARK_CONFIG_H
+
+// EOF
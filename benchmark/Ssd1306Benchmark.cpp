@@ -0,0 +1,483 @@
+//!
+//! @file 				Ssd1306Benchmark.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Measures the bus cost of every public Ssd1306 operation, using the emulator.
+//! @details
+//!						Build from the repo root dir with:
+//!
+//!						g++ -DMCU_PLATFORM=EMULATOR -Ibenchmark -include Config.h benchmark/Ssd1306Benchmark.cpp src/*.cpp -o Ssd1306Benchmark
+//!
+//!						Run with:
+//!
+//!						./Ssd1306Benchmark benchmark/Baseline.txt
+//!
+//!						Exits with 1 if any operation uses more transactions or bytes than in the
+//!						baseline file. Run with --update to re-write the baseline after an intended change.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// System includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/SSD1306.hpp"
+#include "../include/Animator.hpp"
+#include "../include/Console.hpp"
+#include "../include/Ssd1306Emulator.hpp"
+#include "../include/fonts/Prop5x7.hpp"
+
+//===============================================================================================//
+//===================================== PRE-COMPILER CHECKS =====================================//
+//===============================================================================================//
+
+#if(MCU_PLATFORM != EMULATOR)
+	#error Benchmarks have to be built with MCU_PLATFORM == EMULATOR
+#endif
+
+using namespace MbeddedNinja::MSsd1306;
+
+//! @brief		Panel size the benchmark (and the baseline) is measured with.
+typedef Ssd1306<128, 32> Display;
+
+//! @brief		Panel size for operations that work differently on a 64 row panel (e.g. Console,
+//!				which scrolls with the display start line rather than moving the frame buffer).
+typedef Ssd1306<128, 64> TallDisplay;
+
+//===============================================================================================//
+//========================================== DEFINES ============================================//
+//===============================================================================================//
+
+//! @brief		Max. number of operations the benchmark can measure.
+#define benchMAX_NUM_OPS			(32)
+
+//! @brief		Max. length of an operation name.
+#define benchMAX_NAME_LENGTH		(32)
+
+//===============================================================================================//
+//======================================= PRIVATE TYPEDEFS ======================================//
+//===============================================================================================//
+
+//! @brief		Result of measuring one operation.
+typedef struct
+{
+	char name[benchMAX_NAME_LENGTH];
+	uint32 numTransactions;
+	uint32 numBusBytes;
+	uint32 delayUs;
+} opResult_t;
+
+//===============================================================================================//
+//====================================== PRIVATE VARIABLES ======================================//
+//===============================================================================================//
+
+//! @brief		I2C bus speeds to report timings for.
+static const uint32 busSpeedsHz[] = { 100000, 400000, 1000000 };
+
+//! @brief		A full-screen pattern, used by ShowPattern().
+static uint8 patternArray[Display::NUM_PAGES*Display::NUM_COLS];
+
+static opResult_t results[benchMAX_NUM_OPS];
+static uint8 numResults = 0;
+
+//===============================================================================================//
+//====================================== PRIVATE FUNCTIONS ======================================//
+//===============================================================================================//
+
+//! @brief		Works out how long the bus is busy for, in micro-seconds.
+//! @details	Each byte takes 9 clocks (8 bits + ACK), and each transaction also takes about
+//!				2 clocks for the start and stop conditions.
+static double BusTimeUs(uint32 numBusBytes, uint32 numTransactions, uint32 busSpeedHz)
+{
+	return ((double)numBusBytes*9.0 + (double)numTransactions*2.0)*1000000.0/(double)busSpeedHz;
+}
+
+//! @brief		Runs one operation and records what it cost on the bus.
+//! @details	The screen is cleared and flushed first, so every operation starts from the same state.
+//! @tparam		Panel		Display, or TallDisplay for operations that need 64 rows.
+template<class Panel>
+static void Measure(const char *name, void (*opFunction)(Panel &ssd1306))
+{
+	Panel ssd1306;
+	Ssd1306Emulator emulator;
+	opResult_t *result;
+	uint32 delayBeforeUs;
+
+	ssd1306.GetPort().AttachEmulator(Port::i2cLeft, &emulator);
+
+	// Known starting state
+	ssd1306.OledInitVccInt();
+	ssd1306.FillRam(0x00);
+	ssd1306.Flush();
+
+	emulator.ClearStats();
+	delayBeforeUs = ssd1306.GetPort().GetTotalDelayUs();
+
+	opFunction(ssd1306);
+
+	if(numResults >= benchMAX_NUM_OPS)
+	{
+		printf("Error: Too many operations, increase benchMAX_NUM_OPS.\n");
+		exit(2);
+	}
+
+	result = &results[numResults++];
+	strncpy(result->name, name, benchMAX_NAME_LENGTH - 1);
+	result->name[benchMAX_NAME_LENGTH - 1] = '\0';
+	result->numTransactions = emulator.GetStats().numTransactions;
+	result->numBusBytes = emulator.GetStats().numBusBytes;
+	result->delayUs = ssd1306.GetPort().GetTotalDelayUs() - delayBeforeUs;
+}
+
+//===============================================================================================//
+//========================================= OPERATIONS ==========================================//
+//===============================================================================================//
+
+static void OpOledInitVccInt(Display &ssd1306)
+{
+	ssd1306.OledInitVccInt();
+}
+
+static void OpOledInitVccExt(Display &ssd1306)
+{
+	ssd1306.OledInitVccExt();
+}
+
+static void OpFillRam(Display &ssd1306)
+{
+	ssd1306.FillRam(0xFF);
+	ssd1306.Flush();
+}
+
+static void OpFillRamWindow(Display &ssd1306)
+{
+	ssd1306.SetFlushMode(Display::FLUSH_MODE_WINDOW);
+	ssd1306.FillRam(0xFF);
+	ssd1306.Flush();
+}
+
+static void OpShowPatternFull(Display &ssd1306)
+{
+	ssd1306.ShowPattern(patternArray, 0, Display::NUM_PAGES - 1, 0, Display::NUM_COLS);
+	ssd1306.Flush();
+}
+
+static void OpShowPatternPartial(Display &ssd1306)
+{
+	// 2 pages x 16 columns, e.g. an icon
+	ssd1306.ShowPattern(patternArray, 1, 2, 40, 16);
+	ssd1306.Flush();
+}
+
+static void OpShowString(Display &ssd1306)
+{
+	char msg[] = "Status: OK 12:34:56";
+
+	ssd1306.ShowString(1, msg, 0, 0);
+	ssd1306.Flush();
+}
+
+static void OpShowStringProp(Display &ssd1306)
+{
+	// Same string as OpShowString(), in the proportional font
+	ssd1306.frameBuffer.DrawString(fontProp5x7, "Status: OK 12:34:56", 0, 0);
+	ssd1306.Flush();
+}
+
+static void OpShowStringAtRow(Display &ssd1306)
+{
+	// Same string again, 3 rows down, so it straddles two pages
+	ssd1306.frameBuffer.DrawStringAtRow(fontProp5x7, "Status: OK 12:34:56", 3, 0);
+	ssd1306.Flush();
+}
+
+static void OpDrawFrame(Display &ssd1306)
+{
+	ssd1306.DrawFrame();
+	ssd1306.Flush();
+}
+
+static void OpDrawDashboard(Display &ssd1306)
+{
+	// Bar graph, gauge and divider, drawn with the frame buffer primitives
+	ssd1306.frameBuffer.DrawRoundRect(0, 0, Display::NUM_ROWS, Display::NUM_COLS, 4);
+	ssd1306.frameBuffer.DrawRect(3, 4, 10, 80);
+	ssd1306.frameBuffer.FillRect(5, 6, 6, 51);
+	ssd1306.frameBuffer.DrawCircle(16, 106, 12);
+	ssd1306.frameBuffer.DrawLine(16, 106, 8, 112);
+	ssd1306.frameBuffer.DrawHLine(20, 4, 80);
+	ssd1306.Flush();
+}
+
+static void OpBlitCursor(Display &ssd1306)
+{
+	// 6x10 block cursor, XORed over whatever is there, straddling two pages
+	static const uint8 cursor[12] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03 };
+
+	ssd1306.frameBuffer.Blit(13, 40, cursor, 6, 10, ROP_XOR);
+	ssd1306.Flush();
+}
+
+static void DrawSparseUpdate(Display &ssd1306)
+{
+	// Status icons blinking at both ends of the screen, e.g. a clock colon and a link indicator
+	ssd1306.frameBuffer.FillRect(1, 2, 5, 2);
+	ssd1306.frameBuffer.FillRect(1, 122, 5, 3);
+	ssd1306.frameBuffer.FillRect(17, 60, 3, 2);
+	ssd1306.frameBuffer.FillRect(17, 120, 3, 2);
+}
+
+static void OpSparseUpdate(Display &ssd1306)
+{
+	DrawSparseUpdate(ssd1306);
+	ssd1306.Flush();
+}
+
+static void OpSparseUpdatePlanned(Display &ssd1306)
+{
+	static TransferPlanner<Display::NUM_COLS, Display::NUM_ROWS> planner;
+
+	// Screen was flushed before this was called, so it already matches the frame buffer
+	ssd1306.SetTransferPlanner(&planner);
+	planner.Sync(ssd1306.frameBuffer);
+	ssd1306.SetFlushMode(Display::FLUSH_MODE_PLANNED);
+
+	DrawSparseUpdate(ssd1306);
+	ssd1306.Flush();
+}
+
+static void OpCheckerboard(Display &ssd1306)
+{
+	ssd1306.Checkerboard();
+	ssd1306.Flush();
+}
+
+static void OpFadeIn(Display &ssd1306)
+{
+	ssd1306.FadeIn();
+}
+
+static void OpFadeOut(Display &ssd1306)
+{
+	ssd1306.FadeOut();
+}
+
+static void OpAnimatedFadeIn(Display &ssd1306)
+{
+	Animator<Display::NUM_COLS, Display::NUM_ROWS> animator(ssd1306);
+	uint32 nowMs;
+
+	// Same length as FadeIn(), ticked from a 100Hz main loop
+	animator.StartFadeIn(90, 0);
+	for(nowMs = 0; animator.IsRunning(); nowMs += 10)
+		animator.Tick(nowMs);
+}
+
+template<class Panel>
+static void OpConsoleLines(Panel &ssd1306)
+{
+	static char history[Console<Panel::NUM_COLS, Panel::NUM_ROWS>::MIN_HISTORY_SIZE];
+	Console<Panel::NUM_COLS, Panel::NUM_ROWS> console(ssd1306, fontProp5x7, history, sizeof(history));
+	char line[consoleLINE_SIZE];
+	uint32 nowMs = 0;
+	uint8 i;
+
+	// A flood of 100 log lines, one every 5ms, ticked as they arrive
+	for(i = 0; i < 100; i++)
+	{
+		snprintf(line, sizeof(line), "%u: sensor ok\n", (unsigned)i);
+		console.Puts(line);
+		console.Tick(nowMs);
+		nowMs += 5;
+	}
+	console.Tick(nowMs + consoleUPDATE_INTERVAL_MS);
+}
+
+static void OpContinuousScroll(Display &ssd1306)
+{
+	ssd1306.ContinuousScroll(0x00, 0x00, Display::NUM_PAGES - 1, 0x00, Display::NUM_ROWS, 0x01, 0x00, 0);
+}
+
+static void OpHorizontalScroll(Display &ssd1306)
+{
+	ssd1306.HorizontalScroll(0x00, 0x00, Display::NUM_PAGES - 1, 0x00, 0);
+}
+
+static void OpVerticalScroll(Display &ssd1306)
+{
+	ssd1306.VerticalScroll(0x00, 0x00, Display::NUM_ROWS, 0x01, 0x01);
+}
+
+static void OpDeactivateScroll(Display &ssd1306)
+{
+	ssd1306.DeactivateScroll();
+}
+
+//===============================================================================================//
+//======================================== BASELINE FILE ========================================//
+//===============================================================================================//
+
+//! @brief		Writes all results to the baseline file.
+static bool WriteBaseline(const char *fileName)
+{
+	FILE *file;
+	uint8 i;
+
+	file = fopen(fileName, "w");
+	if(file == NULL)
+		return false;
+
+	fprintf(file, "# Bus cost of each operation: name transactions bytes\n");
+	fprintf(file, "# Generated by Ssd1306Benchmark --update, see benchmark/Ssd1306Benchmark.cpp\n");
+	for(i = 0; i < numResults; i++)
+	{
+		fprintf(file, "%s %u %u\n", results[i].name, results[i].numTransactions, results[i].numBusBytes);
+	}
+
+	fclose(file);
+	return true;
+}
+
+//! @brief		Compares all results against the baseline file.
+//! @returns	Number of regressions found, or -1 if the file couldn't be read.
+static int CheckBaseline(const char *fileName)
+{
+	FILE *file;
+	char line[128];
+	char name[benchMAX_NAME_LENGTH];
+	unsigned int numTransactions, numBusBytes;
+	int numRegressions = 0;
+	uint8 i;
+
+	file = fopen(fileName, "r");
+	if(file == NULL)
+		return -1;
+
+	while(fgets(line, sizeof(line), file) != NULL)
+	{
+		if((line[0] == '#') || (sscanf(line, "%31s %u %u", name, &numTransactions, &numBusBytes) != 3))
+			continue;
+
+		for(i = 0; i < numResults; i++)
+		{
+			if(strcmp(results[i].name, name) != 0)
+				continue;
+
+			if((results[i].numTransactions > numTransactions) || (results[i].numBusBytes > numBusBytes))
+			{
+				printf("REGRESSION: %s now %u transactions/%u bytes, baseline %u/%u\n",
+					name, results[i].numTransactions, results[i].numBusBytes, numTransactions, numBusBytes);
+				numRegressions++;
+			}
+			else if((results[i].numTransactions < numTransactions) || (results[i].numBusBytes < numBusBytes))
+			{
+				printf("Improved: %s now %u transactions/%u bytes, baseline %u/%u (run with --update)\n",
+					name, results[i].numTransactions, results[i].numBusBytes, numTransactions, numBusBytes);
+			}
+		}
+	}
+
+	fclose(file);
+	return numRegressions;
+}
+
+//===============================================================================================//
+//============================================ MAIN =============================================//
+//===============================================================================================//
+
+int main(int argc, char *argv[])
+{
+	const char *baselineFileName = NULL;
+	bool isUpdate = false;
+	int numRegressions;
+	uint32 i;
+	uint8 j;
+
+	for(i = 1; i < (uint32)argc; i++)
+	{
+		if(strcmp(argv[i], "--update") == 0)
+			isUpdate = true;
+		else
+			baselineFileName = argv[i];
+	}
+
+	for(i = 0; i < sizeof(patternArray); i++)
+		patternArray[i] = (uint8)(i*7 + 1);
+
+	Measure("OledInitVccInt", OpOledInitVccInt);
+	Measure("OledInitVccExt", OpOledInitVccExt);
+	Measure("FillRam", OpFillRam);
+	Measure("FillRamWindow", OpFillRamWindow);
+	Measure("ShowPatternFull", OpShowPatternFull);
+	Measure("ShowPatternPartial", OpShowPatternPartial);
+	Measure("ShowString", OpShowString);
+	Measure("ShowStringProp", OpShowStringProp);
+	Measure("ShowStringAtRow", OpShowStringAtRow);
+	Measure("DrawFrame", OpDrawFrame);
+	Measure("DrawDashboard", OpDrawDashboard);
+	Measure("BlitCursor", OpBlitCursor);
+	Measure("SparseUpdate", OpSparseUpdate);
+	Measure("SparseUpdatePlanned", OpSparseUpdatePlanned);
+	Measure("Checkerboard", OpCheckerboard);
+	Measure("FadeIn", OpFadeIn);
+	Measure("FadeOut", OpFadeOut);
+	Measure("AnimatedFadeIn", OpAnimatedFadeIn);
+	Measure("ConsoleLines", OpConsoleLines<Display>);
+	Measure("ConsoleLinesTall", OpConsoleLines<TallDisplay>);
+	Measure("ContinuousScroll", OpContinuousScroll);
+	Measure("HorizontalScroll", OpHorizontalScroll);
+	Measure("VerticalScroll", OpVerticalScroll);
+	Measure("DeactivateScroll", OpDeactivateScroll);
+
+	printf("%-20s %8s %8s", "Operation", "Trans.", "Bytes");
+	for(j = 0; j < sizeof(busSpeedsHz)/sizeof(busSpeedsHz[0]); j++)
+		printf(" %9luk", (unsigned long)(busSpeedsHz[j]/1000));
+	printf(" %10s\n", "Delay");
+
+	for(i = 0; i < numResults; i++)
+	{
+		printf("%-20s %8u %8u", results[i].name, results[i].numTransactions, results[i].numBusBytes);
+		for(j = 0; j < sizeof(busSpeedsHz)/sizeof(busSpeedsHz[0]); j++)
+			printf(" %8.2fms", BusTimeUs(results[i].numBusBytes, results[i].numTransactions, busSpeedsHz[j])/1000.0);
+		printf(" %8.2fms\n", results[i].delayUs/1000.0);
+	}
+
+	if(baselineFileName == NULL)
+		return 0;
+
+	if(isUpdate)
+	{
+		if(!WriteBaseline(baselineFileName))
+		{
+			printf("Error: Could not write %s.\n", baselineFileName);
+			return 2;
+		}
+		printf("Baseline written to %s.\n", baselineFileName);
+		return 0;
+	}
+
+	numRegressions = CheckBaseline(baselineFileName);
+	if(numRegressions < 0)
+	{
+		printf("Error: Could not read %s.\n", baselineFileName);
+		return 2;
+	}
+
+	if(numRegressions > 0)
+	{
+		printf("%d operation(s) regressed against %s.\n", numRegressions, baselineFileName);
+		return 1;
+	}
+
+	printf("No regressions against %s.\n", baselineFileName);
+	return 0;
+}
+
+// EOF
@@ -0,0 +1,227 @@
+//!
+//! @file 				TransportBenchmark.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Measures the CPU time the driver spends per byte sent, for each way of getting bytes to the bus.
+//! @details
+//!						Build from the repo root dir with:
+//!
+//!						g++ -O2 -DMCU_PLATFORM=EMULATOR -Ibenchmark -include Config.h benchmark/TransportBenchmark.cpp src/*.cpp -o TransportBenchmark
+//!
+//!						Run with:
+//!
+//!						./TransportBenchmark
+//!
+//!						Unlike Ssd1306Benchmark, there is no baseline, as the times depend on the PC. Compare
+//!						the rows against each other, the emulator's own WriteBytes() is the floor.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// System includes
+#include <stdio.h>
+#include <time.h>
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/SSD1306.hpp"
+#include "../include/Transport.hpp"
+#include "../include/Ssd1306Emulator.hpp"
+
+//===============================================================================================//
+//===================================== PRE-COMPILER CHECKS =====================================//
+//===============================================================================================//
+
+#if(MCU_PLATFORM != EMULATOR)
+	#error Benchmarks have to be built with MCU_PLATFORM == EMULATOR
+#endif
+
+using namespace MbeddedNinja::MSsd1306;
+
+//===============================================================================================//
+//========================================== DEFINES ============================================//
+//===============================================================================================//
+
+//! @brief		Bytes of display data in each transaction of the raw write tests (one 128 column page).
+#define benchPAYLOAD_SIZE			(128)
+
+//! @brief		Number of transactions in each of the raw write tests.
+#define benchNUM_TRANSACTIONS		(20000)
+
+//! @brief		Number of full-frame flushes in each of the flush tests.
+#define benchNUM_FLUSHES			(2000)
+
+//===============================================================================================//
+//====================================== PRIVATE VARIABLES ======================================//
+//===============================================================================================//
+
+static uint8 payload[benchPAYLOAD_SIZE];
+
+//! @brief		Stops the compiler optimising away work whose result is never used.
+static volatile uint32 sink;
+
+//===============================================================================================//
+//====================================== PRIVATE FUNCTIONS ======================================//
+//===============================================================================================//
+
+//! @brief		Returns a monotonic time in nano-seconds.
+static double NowNs()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec*1000000000.0 + (double)now.tv_nsec;
+}
+
+static void PrintResult(const char *name, double elapsedNs, uint32 numBytes)
+{
+	printf("%-32s %10u %10.2f\n", name, numBytes, elapsedNs/(double)numBytes);
+}
+
+//! @brief		The old way, a function call (and port switch) for every byte.
+static void BenchPortByteAtATime()
+{
+	Port port;
+	Ssd1306Emulator emulator;
+	double startNs;
+	uint32 i;
+	uint16 j;
+
+	port.AttachEmulator(Port::i2cLeft, &emulator);
+
+	startNs = NowNs();
+	for(i = 0; i < benchNUM_TRANSACTIONS; i++)
+	{
+		port.I2cMasterSendStart(emulator.GetI2cAddress(), 0);
+		port.I2cMasterWriteByte(ssd1306DATA_FOLLOWS_BYTE);
+		for(j = 0; j < benchPAYLOAD_SIZE; j++)
+			port.I2cMasterWriteByte(payload[j]);
+		port.I2cMasterSendStop();
+	}
+	PrintResult("Port, byte at a time", NowNs() - startNs, emulator.GetStats().numBusBytes);
+}
+
+//! @brief		A whole transaction per call, but still through the run-time port/interface switch.
+static void BenchPortVectored()
+{
+	Port port;
+	Ssd1306Emulator emulator;
+	Port::ioVector_t vector = { payload, benchPAYLOAD_SIZE };
+	double startNs;
+	uint32 i;
+
+	port.AttachEmulator(Port::i2cLeft, &emulator);
+
+	startNs = NowNs();
+	for(i = 0; i < benchNUM_TRANSACTIONS; i++)
+		port.I2cMasterWriteVectored(emulator.GetI2cAddress(), ssd1306DATA_FOLLOWS_BYTE, &vector, 1);
+	PrintResult("Port, vectored", NowNs() - startNs, emulator.GetStats().numBusBytes);
+}
+
+//! @brief		The compile-time transport, which the compiler can inline into the caller.
+static void BenchEmulatorTransport()
+{
+	Port port;
+	EmulatorTransport transport;
+	Ssd1306Emulator emulator;
+	Port::ioVector_t vector = { payload, benchPAYLOAD_SIZE };
+	double startNs;
+	uint32 i;
+
+	transport.Attach(&emulator);
+
+	startNs = NowNs();
+	for(i = 0; i < benchNUM_TRANSACTIONS; i++)
+		transport.Write(port, emulator.GetI2cAddress(), ssd1306DATA_FOLLOWS_BYTE, &vector, 1);
+	PrintResult("EmulatorTransport", NowNs() - startNs, emulator.GetStats().numBusBytes);
+}
+
+//! @brief		The emulator on it's own, i.e. what is left when the driver costs nothing.
+static void BenchEmulatorFloor()
+{
+	Ssd1306Emulator emulator;
+	double startNs;
+	uint32 i;
+
+	startNs = NowNs();
+	for(i = 0; i < benchNUM_TRANSACTIONS; i++)
+	{
+		emulator.Start();
+		emulator.WriteByte(ssd1306DATA_FOLLOWS_BYTE);
+		emulator.WriteBytes(payload, benchPAYLOAD_SIZE);
+		emulator.Stop();
+	}
+	PrintResult("Emulator only (floor)", NowNs() - startNs, emulator.GetStats().numBusBytes);
+}
+
+//! @brief		Full-frame flushes through the driver, with the transport given.
+//! @details	Every flush changes every byte, so all of the frame buffer is sent.
+template<class Transport>
+static void BenchFlush(const char *name, Ssd1306<128, 64, Transport> &ssd1306, uint32 *numBytes)
+{
+	double startNs;
+	uint32 bytesBefore;
+	uint32 i;
+
+	ssd1306.OledInitVccInt();
+	ssd1306.SetFlushMode(Ssd1306<128, 64, Transport>::FLUSH_MODE_WINDOW);
+
+	bytesBefore = ssd1306.GetNumBusBytesWritten();
+	startNs = NowNs();
+	for(i = 0; i < benchNUM_FLUSHES; i++)
+	{
+		ssd1306.frameBuffer.Fill((uint8)i);
+		ssd1306.Flush();
+	}
+	*numBytes = ssd1306.GetNumBusBytesWritten() - bytesBefore;
+	PrintResult(name, NowNs() - startNs, *numBytes);
+}
+
+//===============================================================================================//
+//============================================ MAIN =============================================//
+//===============================================================================================//
+
+int main()
+{
+	uint32 numBytes;
+	uint16 i;
+
+	for(i = 0; i < benchPAYLOAD_SIZE; i++)
+		payload[i] = (uint8)(i*7 + 1);
+
+	printf("%-32s %10s %10s\n", "Path", "Bytes", "ns/byte");
+
+	BenchPortByteAtATime();
+	BenchPortVectored();
+	BenchEmulatorTransport();
+	BenchEmulatorFloor();
+
+	{
+		Ssd1306<128, 64> ssd1306;
+		Ssd1306Emulator emulator;
+		ssd1306.GetPort().AttachEmulator(Port::i2cLeft, &emulator);
+		BenchFlush("Flush, PortTransport", ssd1306, &numBytes);
+		sink = emulator.GetRamByte(0, 0);
+	}
+
+	{
+		Ssd1306<128, 64, EmulatorTransport> ssd1306;
+		Ssd1306Emulator emulator;
+		ssd1306.GetTransport().Attach(&emulator);
+		BenchFlush("Flush, EmulatorTransport", ssd1306, &numBytes);
+		sink = emulator.GetRamByte(0, 0);
+	}
+
+	{
+		// Driver cost alone, nothing is done with the bytes
+		Ssd1306<128, 64, NullTransport> ssd1306;
+		BenchFlush("Flush, NullTransport", ssd1306, &numBytes);
+		sink = ssd1306.GetTransport().GetNumBytes();
+	}
+
+	return 0;
+}
+
+// EOF
@@ -0,0 +1,186 @@
+//!
+//! @file 				Animator.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Runs contrast fades, start-line scrolls and blinks on an SSD1306 without blocking.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_ANIMATOR_H
+#define M_SSD1306_ANIMATOR_H
+
+#include "Port.hpp"
+#include "SSD1306.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//=========================================== CLASS =============================================//
+		//===============================================================================================//
+
+		//! @brief		Animates the contrast, display start line and inverse/on state of an SSD1306.
+		//! @details	Start an animation, then call Tick() from the main loop or a timer with the current
+		//!				time (e.g. Port::GetTimeMs()). Each Tick() works out where every running animation
+		//!				should be by now and sends only the registers that changed, all in one command
+		//!				transaction, so nothing waits and a late tick just catches up. A contrast ramp, a
+		//!				scroll and a blink can all run at once.
+		//!
+		//!				Tick() sends nothing while a flush started with FlushAsync() is still running, it
+		//!				catches up on the next tick instead. Don't use an Animator on a panel owned by a
+		//!				DisplayScheduler.
+		//!
+		//!				The Animator starts off assuming the SSD1306 is as the init functions leave it
+		//!				(start line 0, not inverted). Blinks end with the display on and not inverted.
+		//! @tparam		numCols, numRows, Transport		Same as the Ssd1306 being animated.
+		template<uint8 numCols, uint8 numRows, class Transport = PortTransport>
+		class Animator
+		{
+			public:
+
+				//===============================================================================================//
+				//======================================== PUBLIC TYPEDEFS ======================================//
+				//===============================================================================================//
+
+				//! @brief		What a blink does to the panel, see StartBlink().
+				typedef enum
+				{
+					//! @brief		Inverts the whole panel (0xA6/0xA7).
+					BLINK_INVERT,
+					//! @brief		Turns the panel off and on again (0xAE/0xAF).
+					BLINK_DISPLAY_OFF
+				} blinkMode_t;
+
+				//===============================================================================================//
+				//================================== PUBLIC METHOD DECLARATIONS =================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor.
+				//! @param		ssd1306		The panel to animate.
+				Animator(Ssd1306<numCols, numRows, Transport> &ssd1306);
+
+				//! @brief		Starts ramping the contrast from one value to another.
+				//! @param		durationMs	How long the ramp takes. 0 jumps straight to toContrast.
+				//! @param		nowMs		The current time, on the same clock as passed to Tick().
+				void StartContrastRamp(uint8 fromContrast, uint8 toContrast, uint16 durationMs, uint32 nowMs);
+
+				//! @brief		Turns the display on and ramps the contrast up from 0 to #ssd1306BRIGHTNESS.
+				//! @details	Non-blocking version of Ssd1306::FadeIn().
+				void StartFadeIn(uint16 durationMs, uint32 nowMs);
+
+				//! @brief		Ramps the contrast down from #ssd1306BRIGHTNESS to 0, then turns the display off.
+				//! @details	Non-blocking version of Ssd1306::FadeOut().
+				void StartFadeOut(uint16 durationMs, uint32 nowMs);
+
+				//! @brief		Scrolls the display start line a number of rows at a time.
+				//! @details	Moves the whole picture up (rowsPerStep > 0) or down (rowsPerStep < 0),
+				//!				wrapping round through the 64 lines of GDDRAM. Non-blocking version of
+				//!				Ssd1306::VerticalScroll(), which doesn't need the hardware scroll commands.
+				//!
+				//!				Panels with less than 64 rows (128x32, 64x48) also scroll through the GDDRAM
+				//!				pages they don't show, so the picture goes off the edge and comes back round
+				//!				rather than wrapping straight away. The init functions blank all 8 pages, so
+				//!				those rows show up blank unless something else has written to them.
+				//! @param		stepIntervalMs	Time between steps.
+				//! @param		numSteps		Number of steps to take, 0 to scroll until StopScroll().
+				void StartScroll(int8 rowsPerStep, uint16 stepIntervalMs, uint16 numSteps, uint32 nowMs);
+
+				//! @brief		Blinks the panel.
+				//! @param		periodMs		Time for one blink (off and on again).
+				//! @param		numBlinks		Number of blinks, 0 to blink until StopBlink().
+				void StartBlink(blinkMode_t blinkMode, uint16 periodMs, uint16 numBlinks, uint32 nowMs);
+
+				//! @brief		Stops the contrast ramp, leaving the contrast where it has got to.
+				void StopContrastRamp();
+
+				//! @brief		Stops scrolling, leaving the start line where it has got to.
+				void StopScroll();
+
+				//! @brief		Stops blinking. The next Tick() puts the panel back on and not inverted.
+				void StopBlink();
+
+				//! @brief		Returns true if an animation is running, or there are changes still to send.
+				bool IsRunning();
+
+				//! @brief		Returns the display start line the animations have got to.
+				uint8 GetStartLine();
+
+				//! @brief		Moves the animations on to nowMs, and sends whatever changed.
+				//! @returns	True if a transaction was sent.
+				bool Tick(uint32 nowMs);
+
+			private:
+
+				//! @brief		Bits of #dirtyFlags, one for each register the Animator drives.
+				typedef enum
+				{
+					DIRTY_CONTRAST		= 0x01,
+					DIRTY_START_LINE	= 0x02,
+					DIRTY_INVERSE		= 0x04,
+					DIRTY_DISPLAY_ON	= 0x08
+				} dirtyFlag_t;
+
+				//! @brief		Works out the contrast ramp at nowMs.
+				void UpdateContrastRamp(uint32 nowMs);
+
+				//! @brief		Works out the scroll at nowMs.
+				void UpdateScroll(uint32 nowMs);
+
+				//! @brief		Works out the blink at nowMs.
+				void UpdateBlink(uint32 nowMs);
+
+				//! @brief		Sets the inverse and display on state, marking them dirty if they changed.
+				void SetBlinkState(bool isInverse, bool isDisplayOn);
+
+				//! @brief		The panel being animated.
+				Ssd1306<numCols, numRows, Transport> &ssd1306;
+
+				//! @brief		Registers that have changed since they were last sent, see #dirtyFlag_t.
+				uint8 dirtyFlags;
+
+				//! @brief		Where the animations have got to, i.e. what the registers should be set to.
+				uint8 contrast;
+				uint8 startLine;
+				bool isInverse;
+				bool isDisplayOn;
+
+				//! @brief		Contrast ramp.
+				bool isRampRunning;
+				uint8 rampFromContrast, rampToContrast;
+				uint16 rampDurationMs;
+				uint32 rampStartMs;
+				//! @brief		True to turn the display off once the ramp has finished (StartFadeOut()).
+				bool isOffAfterRamp;
+
+				//! @brief		Start-line scroll.
+				bool isScrollRunning;
+				int8 scrollRowsPerStep;
+				uint16 scrollIntervalMs;
+				uint16 scrollNumSteps;
+				uint32 scrollStartMs;
+				//! @brief		Start line when the scroll was started.
+				uint8 scrollFromLine;
+
+				//! @brief		Blink.
+				bool isBlinkRunning;
+				blinkMode_t blinkMode;
+				uint16 blinkPeriodMs;
+				uint16 blinkNumBlinks;
+				uint32 blinkStartMs;
+		};
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_ANIMATOR_H
+
+// EOF
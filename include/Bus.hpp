@@ -0,0 +1,446 @@
+//!
+//! @file 				Bus.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Code that opens and writes to each kind of bus, shared by Port and the transports.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_BUS_H
+#define M_SSD1306_BUS_H
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+#include "Port.hpp"
+
+#if(MCU_PLATFORM == LINUX)
+	// System includes
+	#include <errno.h>
+	#include <fcntl.h>
+	#include <stdio.h>
+	#include <string.h>
+	#include <unistd.h>
+	#include <sys/ioctl.h>
+	#include <linux/gpio.h>
+	#include <linux/i2c.h>
+	#include <linux/i2c-dev.h>
+	#include <linux/spi/spidev.h>
+#endif
+
+namespace SSD1306Ns
+{
+
+	// Port picks the bus at run-time and the transports (see Transport.hpp) at compile-time, but
+	// once picked, both put the bytes on it with these functions. They are inline so the
+	// transports' inner loops still get inlined into the driver.
+
+	//===============================================================================================//
+	//=========================================== CLASSES ===========================================//
+	//===============================================================================================//
+
+	#if(MCU_PLATFORM == PSOC)
+		//! @brief		The master functions of the I2C component of a port.
+		//! @details	Lets BusPsocI2cWrite() be written once for both components.
+		//! @tparam		i2cPort		Port::i2cLeft (I2cCpLeft) or Port::i2cRight (I2cCpRight).
+		template<Port::i2cPort_t i2cPort>
+		class BusPsocI2cComponent;
+
+		template<>
+		class BusPsocI2cComponent<Port::i2cLeft>
+		{
+			public:
+
+				//! @brief		Each returns true if there was no error.
+				static bool SendStart(uint8 slaveAddress);
+				static bool WriteByte(uint8 byteToWrite);
+				static bool SendStop();
+		};
+
+		template<>
+		class BusPsocI2cComponent<Port::i2cRight>
+		{
+			public:
+
+				//! @brief		Each returns true if there was no error.
+				static bool SendStart(uint8 slaveAddress);
+				static bool WriteByte(uint8 byteToWrite);
+				static bool SendStop();
+		};
+	#endif
+
+	//===============================================================================================//
+	//==================================== FUNCTION PROTOTYPES ======================================//
+	//===============================================================================================//
+
+	#if(MCU_PLATFORM == PSOC)
+		//! @brief		Writes a whole transaction with the master functions of a PSoC I2C component.
+		//! @returns	A Port::transferResult_t.
+		template<Port::i2cPort_t i2cPort>
+		uint8 BusPsocI2cWrite(uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors);
+	#endif
+
+	#if(MCU_PLATFORM == LINUX)
+		//! @brief		Calls ioctl(), or ioctlFunction if it isn't NULL (a mock, see Port::SetIoctlFunction()).
+		int BusIoctl(Port::ioctlFunction_t ioctlFunction, int fd, unsigned long request, void *arg);
+
+		//! @brief		Writes a whole transaction to an i2c-dev file descriptor.
+		//! @details	The transaction is split into messages of at most maxMessageSize bytes, each
+		//!				starting with the control byte. The vectors are copied into msgBuffer a chunk
+		//!				at a time, and as many messages as fit are passed to the kernel in each I2C_RDWR
+		//!				ioctl().
+		//! @param		msgBuffer	#portLINUX_MSG_BUFFER_SIZE bytes to assemble the messages in.
+		//! @returns	A Port::transferResult_t.
+		uint8 BusI2cDevWrite(
+			int fd,
+			Port::ioctlFunction_t ioctlFunction,
+			uint8 *msgBuffer,
+			uint16 maxMessageSize,
+			uint8 slaveAddress,
+			uint8 controlByte,
+			const Port::ioVector_t *vectors,
+			uint8 numVectors);
+
+		//! @brief		Sends messages with one I2C_RDWR ioctl().
+		//! @returns	A Port::transferResult_t.
+		uint8 BusI2cDevSendMessages(int fd, Port::ioctlFunction_t ioctlFunction, struct i2c_msg *msgs, uint8 numMsgs);
+
+		//! @brief		Opens /dev/spidevB.C, in SPI mode 0 at the given clock.
+		//! @returns	The file descriptor, or -1 on error.
+		int BusSpidevOpen(uint8 busNumber, uint8 chipSelect, uint32 speedHz);
+
+		//! @brief		Writes the payload of a transaction to a spidev file descriptor.
+		//! @details	One transfer per vector, pointing straight at the caller's memory, so a whole
+		//!				frame goes to the kernel in one SPI_IOC_MESSAGE without being copied. Chip select
+		//!				stays low between the transfers of a message.
+		//! @returns	A Port::transferResult_t.
+		uint8 BusSpidevWrite(int fd, Port::ioctlFunction_t ioctlFunction, const Port::ioVector_t *vectors, uint8 numVectors);
+
+		//! @brief		Requests a line of /dev/gpiochipN as an output, starting low.
+		//! @returns	The line handle file descriptor, or -1 on error.
+		int BusGpioRequestOutput(uint8 chipNumber, uint8 line);
+
+		//! @brief		Sets the level of a line requested with BusGpioRequestOutput().
+		//! @returns	A Port::transferResult_t (Port::TRANSFER_ERROR_START if the line couldn't be set).
+		uint8 BusGpioSetLine(int fd, Port::ioctlFunction_t ioctlFunction, uint8 level);
+	#endif
+
+	//===============================================================================================//
+	//====================================== INLINE FUNCTIONS =======================================//
+	//===============================================================================================//
+
+	#if(MCU_PLATFORM == PSOC)
+		// BusPsocI2cComponent
+
+		inline bool BusPsocI2cComponent<Port::i2cLeft>::SendStart(uint8 slaveAddress)
+		{
+			return (I2cCpLeft_MasterSendStart(slaveAddress, 0) == I2cCpLeft_MSTR_NO_ERROR);
+		}
+
+		inline bool BusPsocI2cComponent<Port::i2cLeft>::WriteByte(uint8 byteToWrite)
+		{
+			return (I2cCpLeft_MasterWriteByte(byteToWrite) == I2cCpLeft_MSTR_NO_ERROR);
+		}
+
+		inline bool BusPsocI2cComponent<Port::i2cLeft>::SendStop()
+		{
+			return (I2cCpLeft_MasterSendStop() == I2cCpLeft_MSTR_NO_ERROR);
+		}
+
+		inline bool BusPsocI2cComponent<Port::i2cRight>::SendStart(uint8 slaveAddress)
+		{
+			return (I2cCpRight_MasterSendStart(slaveAddress, 0) == I2cCpRight_MSTR_NO_ERROR);
+		}
+
+		inline bool BusPsocI2cComponent<Port::i2cRight>::WriteByte(uint8 byteToWrite)
+		{
+			return (I2cCpRight_MasterWriteByte(byteToWrite) == I2cCpRight_MSTR_NO_ERROR);
+		}
+
+		inline bool BusPsocI2cComponent<Port::i2cRight>::SendStop()
+		{
+			return (I2cCpRight_MasterSendStop() == I2cCpRight_MSTR_NO_ERROR);
+		}
+
+		template<Port::i2cPort_t i2cPort>
+		inline uint8 BusPsocI2cWrite(uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors)
+		{
+			typedef BusPsocI2cComponent<i2cPort> component;
+			uint8 vectorIndex;
+			uint16 byteIndex;
+
+			if(!component::SendStart(slaveAddress))
+			{
+				component::SendStop();
+				return Port::TRANSFER_ERROR_START;
+			}
+
+			if(!component::WriteByte(controlByte))
+			{
+				component::SendStop();
+				return Port::TRANSFER_ERROR_BYTE;
+			}
+
+			for(vectorIndex = 0; vectorIndex < numVectors; vectorIndex++)
+			{
+				for(byteIndex = 0; byteIndex < vectors[vectorIndex].numBytes; byteIndex++)
+				{
+					if(!component::WriteByte(vectors[vectorIndex].data[byteIndex]))
+					{
+						component::SendStop();
+						return Port::TRANSFER_ERROR_BYTE;
+					}
+				}
+			}
+
+			if(!component::SendStop())
+				return Port::TRANSFER_ERROR_STOP;
+
+			return Port::TRANSFER_OK;
+		}
+	#endif
+
+	#if(MCU_PLATFORM == LINUX)
+		inline int BusIoctl(Port::ioctlFunction_t ioctlFunction, int fd, unsigned long request, void *arg)
+		{
+			if(ioctlFunction != NULL)
+				return ioctlFunction(fd, request, arg);
+
+			return ioctl(fd, request, arg);
+		}
+
+		inline uint8 BusI2cDevWrite(
+			int fd,
+			Port::ioctlFunction_t ioctlFunction,
+			uint8 *msgBuffer,
+			uint16 maxMessageSize,
+			uint8 slaveAddress,
+			uint8 controlByte,
+			const Port::ioVector_t *vectors,
+			uint8 numVectors)
+		{
+			struct i2c_msg msgs[I2C_RDWR_IOCTL_MAX_MSGS];
+			uint8 numMsgs = 0;
+			uint16 bufferIndex = 0;
+			uint16 msgLength = 0;
+			uint8 vectorIndex;
+			uint16 offset;
+			uint16 chunkLength;
+			uint8 result;
+
+			for(vectorIndex = 0; vectorIndex < numVectors; vectorIndex++)
+			{
+				offset = 0;
+				while(offset < vectors[vectorIndex].numBytes)
+				{
+					// Start a new message?
+					if(msgLength == 0)
+					{
+						// Flush assembled messages if out of space
+						if((numMsgs == I2C_RDWR_IOCTL_MAX_MSGS) || ((bufferIndex + 2) > portLINUX_MSG_BUFFER_SIZE))
+						{
+							result = BusI2cDevSendMessages(fd, ioctlFunction, msgs, numMsgs);
+							if(result != Port::TRANSFER_OK)
+								return result;
+							numMsgs = 0;
+							bufferIndex = 0;
+						}
+
+						msgs[numMsgs].addr = slaveAddress;
+						msgs[numMsgs].flags = 0;
+						msgs[numMsgs].buf = &msgBuffer[bufferIndex];
+						msgBuffer[bufferIndex++] = controlByte;
+						msgLength = 1;
+					}
+
+					// As much of the vector as fits in the message and the buffer
+					chunkLength = vectors[vectorIndex].numBytes - offset;
+					if(chunkLength > maxMessageSize - msgLength)
+						chunkLength = maxMessageSize - msgLength;
+					if(chunkLength > portLINUX_MSG_BUFFER_SIZE - bufferIndex)
+						chunkLength = portLINUX_MSG_BUFFER_SIZE - bufferIndex;
+
+					memcpy(&msgBuffer[bufferIndex], &vectors[vectorIndex].data[offset], chunkLength);
+					bufferIndex += chunkLength;
+					msgLength += chunkLength;
+					offset += chunkLength;
+
+					// End the current message?
+					if((msgLength == maxMessageSize) || (bufferIndex == portLINUX_MSG_BUFFER_SIZE))
+					{
+						msgs[numMsgs].len = msgLength;
+						numMsgs++;
+						msgLength = 0;
+					}
+				}
+			}
+
+			// Close off last message
+			if(msgLength != 0)
+			{
+				msgs[numMsgs].len = msgLength;
+				numMsgs++;
+			}
+
+			// A transaction with no data is still sent, as a control byte on it's own
+			if((numMsgs == 0) && (bufferIndex == 0))
+			{
+				msgs[0].addr = slaveAddress;
+				msgs[0].flags = 0;
+				msgs[0].buf = &msgBuffer[0];
+				msgs[0].len = 1;
+				msgBuffer[0] = controlByte;
+				numMsgs = 1;
+			}
+
+			if(numMsgs == 0)
+				return Port::TRANSFER_OK;
+
+			return BusI2cDevSendMessages(fd, ioctlFunction, msgs, numMsgs);
+		}
+
+		inline uint8 BusI2cDevSendMessages(int fd, Port::ioctlFunction_t ioctlFunction, struct i2c_msg *msgs, uint8 numMsgs)
+		{
+			struct i2c_rdwr_ioctl_data rdwrData;
+
+			rdwrData.msgs = msgs;
+			rdwrData.nmsgs = numMsgs;
+
+			if(BusIoctl(ioctlFunction, fd, I2C_RDWR, &rdwrData) < 0)
+			{
+				// No ACK to the address shows up as ENXIO (or EREMOTEIO on some adapters)
+				if(errno == ENXIO)
+					return Port::TRANSFER_ERROR_START;
+				else
+					return Port::TRANSFER_ERROR_BYTE;
+			}
+
+			return Port::TRANSFER_OK;
+		}
+
+		inline int BusSpidevOpen(uint8 busNumber, uint8 chipSelect, uint32 speedHz)
+		{
+			char devicePath[24];
+			uint8 mode = SPI_MODE_0;
+			uint8 bitsPerWord = 8;
+			int fd;
+
+			snprintf(devicePath, sizeof(devicePath), "/dev/spidev%u.%u", busNumber, chipSelect);
+
+			fd = open(devicePath, O_RDWR);
+			if(fd < 0)
+				return -1;
+
+			// SSD1306 samples on the rising edge of the clock, which idles low
+			if((ioctl(fd, SPI_IOC_WR_MODE, &mode) < 0) ||
+				(ioctl(fd, SPI_IOC_WR_BITS_PER_WORD, &bitsPerWord) < 0) ||
+				(ioctl(fd, SPI_IOC_WR_MAX_SPEED_HZ, &speedHz) < 0))
+			{
+				close(fd);
+				return -1;
+			}
+
+			return fd;
+		}
+
+		inline uint8 BusSpidevWrite(int fd, Port::ioctlFunction_t ioctlFunction, const Port::ioVector_t *vectors, uint8 numVectors)
+		{
+			struct spi_ioc_transfer xfers[portLINUX_SPI_MAX_XFERS];
+			uint8 numXfers = 0;
+			uint32 msgLength = 0;
+			uint8 vectorIndex;
+			uint16 offset;
+			uint16 chunkLength;
+
+			for(vectorIndex = 0; vectorIndex < numVectors; vectorIndex++)
+			{
+				offset = 0;
+				while(offset < vectors[vectorIndex].numBytes)
+				{
+					// Send what has been assembled if out of space
+					if((numXfers == portLINUX_SPI_MAX_XFERS) || (msgLength == portLINUX_SPI_MAX_MSG_SIZE))
+					{
+						if(BusIoctl(ioctlFunction, fd, SPI_IOC_MESSAGE(numXfers), xfers) < 0)
+							return Port::TRANSFER_ERROR_BYTE;
+						numXfers = 0;
+						msgLength = 0;
+					}
+
+					chunkLength = vectors[vectorIndex].numBytes - offset;
+					if(chunkLength > portLINUX_SPI_MAX_MSG_SIZE - msgLength)
+						chunkLength = portLINUX_SPI_MAX_MSG_SIZE - msgLength;
+
+					// Zero speed and word size means the ones set on the device are used
+					memset(&xfers[numXfers], 0, sizeof(xfers[numXfers]));
+					xfers[numXfers].tx_buf = (uintptr_t)&vectors[vectorIndex].data[offset];
+					xfers[numXfers].len = chunkLength;
+					numXfers++;
+
+					msgLength += chunkLength;
+					offset += chunkLength;
+				}
+			}
+
+			if((numXfers != 0) && (BusIoctl(ioctlFunction, fd, SPI_IOC_MESSAGE(numXfers), xfers) < 0))
+				return Port::TRANSFER_ERROR_BYTE;
+
+			return Port::TRANSFER_OK;
+		}
+
+		inline int BusGpioRequestOutput(uint8 chipNumber, uint8 line)
+		{
+			struct gpiohandle_request request;
+			char devicePath[24];
+			int chipFd;
+			int returnVal;
+
+			snprintf(devicePath, sizeof(devicePath), "/dev/gpiochip%u", chipNumber);
+
+			chipFd = open(devicePath, O_RDWR);
+			if(chipFd < 0)
+				return -1;
+
+			memset(&request, 0, sizeof(request));
+			request.lineoffsets[0] = line;
+			request.flags = GPIOHANDLE_REQUEST_OUTPUT;
+			request.default_values[0] = 0;
+			request.lines = 1;
+			strncpy(request.consumer_label, "ssd1306-dc", sizeof(request.consumer_label) - 1);
+
+			// The line stays requested through the handle after the chip is closed
+			returnVal = ioctl(chipFd, GPIO_GET_LINEHANDLE_IOCTL, &request);
+			close(chipFd);
+
+			if(returnVal < 0)
+				return -1;
+
+			return request.fd;
+		}
+
+		inline uint8 BusGpioSetLine(int fd, Port::ioctlFunction_t ioctlFunction, uint8 level)
+		{
+			struct gpiohandle_data values;
+
+			memset(&values, 0, sizeof(values));
+			values.values[0] = level;
+
+			if(BusIoctl(ioctlFunction, fd, GPIOHANDLE_SET_LINE_VALUES_IOCTL, &values) < 0)
+				return Port::TRANSFER_ERROR_START;
+
+			return Port::TRANSFER_OK;
+		}
+	#endif
+
+} // namespace SSD1306Ns
+
+#endif // #ifndef M_SSD1306_BUS_H
+
+// EOF
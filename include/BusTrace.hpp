@@ -0,0 +1,186 @@
+//!
+//! @file 				BusTrace.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Records the transactions the driver puts on the bus into a compact binary trace.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_BUS_TRACE_H
+#define M_SSD1306_BUS_TRACE_H
+
+#include "Port.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		// The port layer lives in it's own namespace
+		using SSD1306Ns::Port;
+
+		//===============================================================================================//
+		//======================================= PUBLIC DEFINES ========================================//
+		//===============================================================================================//
+
+		//! @brief		Version of the trace format, stored in the header. Bump when the format changes.
+		#define busTraceVERSION				1
+
+		//! @brief		Size (in bytes) of the header at the start of every trace.
+		#define busTraceHEADER_SIZE			8
+
+		//===============================================================================================//
+		//======================================= PUBLIC TYPEDEFS =======================================//
+		//===============================================================================================//
+
+		//! @brief		One transaction read back from a trace, see BusTraceReader::Next().
+		typedef struct
+		{
+			//! @brief		Micro-seconds since the trace was started (BusTrace::Clear()).
+			uint32 timeUs;
+
+			//! @brief		7-bit I2C address the transaction was sent to.
+			uint8 slaveAddress;
+
+			//! @brief		Control byte, says whether the payload is commands or data.
+			uint8 controlByte;
+
+			//! @brief		The payload, pointing into the trace.
+			const uint8 *data;
+
+			//! @brief		Number of bytes in the payload.
+			uint32 numBytes;
+		} busTraceRecord_t;
+
+		//===============================================================================================//
+		//=========================================== CLASS =============================================//
+		//===============================================================================================//
+
+		//! @brief		Records every transaction of one or more Ssd1306's into a binary trace.
+		//! @details	Attach with Ssd1306::SetBusTrace(). Each transaction is recorded as it is handed
+		//!				to the transport: the time since the last one, address, control byte, length
+		//!				and payload. The start and stop conditions are implied. Times and lengths are
+		//!				variable length integers, so a small command transaction takes 5 bytes.
+		//!
+		//!				The storage is supplied by the caller, so the trace can be kept in RAM on the
+		//!				MCU and dumped (e.g. over a UART) with GetData() and GetLength(). Once it is
+		//!				full, nothing more is recorded (so a trace never has a gap in it), see
+		//!				GetNumDropped(). Panels sharing a bus can share a trace, but it must only be
+		//!				written from one thread.
+		//!
+		//!				Format (all little-endian):
+		//!					Header:	"SSDT", version (1 byte), 3 reserved bytes.
+		//!					Record:	delta time in us (varint), address (1 byte), control byte (1 byte),
+		//!							payload length (varint), payload.
+		//!				A varint is 7 bits per byte, least significant first, with bit 7 set on every byte
+		//!				but the last.
+		class BusTrace
+		{
+			public:
+
+				//! @brief		Constructor. Starts an empty trace.
+				//! @param		storage		RAM to hold the trace.
+				//! @param		storageSize	Size of storage, in bytes (at least #busTraceHEADER_SIZE).
+				BusTrace(uint8 *storage, uint32 storageSize);
+
+				//! @brief		Throws away everything recorded and starts again, timed from now.
+				void Clear();
+
+				//! @brief		Records one transaction.
+				//! @details	Called by Ssd1306, but can be called directly to add your own transactions.
+				void Record(uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors);
+
+				//! @brief		Returns the trace, starting with the header.
+				const uint8* GetData() const;
+
+				//! @brief		Returns the number of bytes of the trace used so far.
+				uint32 GetLength() const;
+
+				//! @brief		Returns the number of transactions recorded.
+				uint32 GetNumRecords() const;
+
+				//! @brief		Returns the number of transactions that didn't fit, once the trace filled up.
+				uint32 GetNumDropped() const;
+
+				#if((MCU_PLATFORM == LINUX) || (MCU_PLATFORM == EMULATOR))
+					//! @brief		Writes the trace to a file, for TraceReplay.
+					//! @returns	False if the file couldn't be written.
+					bool Save(const char *fileName) const;
+				#endif
+
+			private:
+
+				//! @brief		Appends a varint to the trace. There must be room for it.
+				void WriteVarint(uint32 value);
+
+				//! @brief		Returns the number of bytes a varint takes.
+				static uint8 GetVarintSize(uint32 value);
+
+				//! @brief		The trace.
+				uint8 *storage;
+
+				//! @brief		Size of storage, in bytes.
+				uint32 storageSize;
+
+				//! @brief		Number of bytes of storage used.
+				uint32 length;
+
+				//! @brief		Port::GetTimeUs() of the last record (or Clear()).
+				uint32 lastTimeUs;
+
+				//! @brief		Number of transactions recorded, and dropped.
+				uint32 numRecords, numDropped;
+		};
+
+		//! @brief		Reads the transactions back out of a trace made by BusTrace.
+		class BusTraceReader
+		{
+			public:
+
+				//! @brief		Constructor.
+				//! @param		data		The trace, starting with the header.
+				//! @param		length		Size of the trace, in bytes.
+				BusTraceReader(const uint8 *data, uint32 length);
+
+				//! @brief		Returns true if the trace starts with a header this reader understands.
+				bool IsValid() const;
+
+				//! @brief		Reads the next transaction.
+				//! @returns	False at the end of the trace, or if the rest of it is cut short.
+				bool Next(busTraceRecord_t &record);
+
+				//! @brief		Goes back to the first transaction.
+				void Rewind();
+
+			private:
+
+				//! @brief		Reads a varint.
+				//! @returns	False if the trace ends part way through it.
+				bool ReadVarint(uint32 &value);
+
+				//! @brief		The trace.
+				const uint8 *data;
+
+				//! @brief		Size of the trace, in bytes.
+				uint32 length;
+
+				//! @brief		Where the next record starts.
+				uint32 position;
+
+				//! @brief		Time of the last record read.
+				uint32 timeUs;
+		};
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_BUS_TRACE_H
+
+// EOF
@@ -0,0 +1,206 @@
+//!
+//! @file 				Console.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Scrolling text console on an SSD1306, using the display start line to scroll.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_CONSOLE_H
+#define M_SSD1306_CONSOLE_H
+
+#include "Port.hpp"
+#include "Font.hpp"
+#include "SSD1306.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC DEFINES ========================================//
+		//===============================================================================================//
+
+		//! @brief		Size (in bytes) of each line of console history, including the terminating null.
+		//! @details	Lines wrap when they reach the edge of the panel, or at this many characters
+		//!				less one, whichever comes first.
+		#define consoleLINE_SIZE				32
+
+		//! @brief		Default minimum time (in milli-seconds) between two updates of the panel, see
+		//!				Console::SetUpdateInterval().
+		#define consoleUPDATE_INTERVAL_MS		20
+
+		//===============================================================================================//
+		//=========================================== CLASS =============================================//
+		//===============================================================================================//
+
+		//! @brief		A scrolling text console (putc/puts, newline, wrap and scrollback) on an SSD1306.
+		//! @details	Each line of text takes one page. On 64 row panels the pages are used as a ring,
+		//!				the same as the 64 lines of GDDRAM: a new line is drawn into the page that has
+		//!				just scrolled off the top, and the display start line is moved down one page, so
+		//!				appending a line costs one page of data plus one command transaction rather than
+		//!				a full redraw. Panels with less than 64 rows don't show all of GDDRAM, so there the
+		//!				lines are moved up the frame buffer instead, and only the bytes that change are sent.
+		//!
+		//!				Putc() and Puts() only store the text. Tick() draws whatever has changed into
+		//!				Ssd1306::frameBuffer and sends it, at most once every SetUpdateInterval(), so a
+		//!				burst of lines costs one update, and lines that scroll off before the next update
+		//!				are never drawn or sent at all.
+		//!
+		//!				The console owns the whole panel, including the display start line. Don't use it
+		//!				with an Animator scroll, or on a panel owned by a DisplayScheduler.
+		//! @tparam		numCols, numRows, Transport		Same as the Ssd1306 the console is drawn on.
+		template<uint8 numCols, uint8 numRows, class Transport = PortTransport>
+		class Console
+		{
+			public:
+
+				//===============================================================================================//
+				//====================================== PUBLIC CONSTANTS =======================================//
+				//===============================================================================================//
+
+				//! @brief		Number of lines shown on the panel at once.
+				static constexpr uint8 NUM_LINES = numRows/8;
+
+				//! @brief		True if the panel is scrolled with the display start line (it shows all
+				//!				64 lines of GDDRAM), false if the frame buffer is moved instead.
+				static constexpr bool IS_HARDWARE_SCROLL = (numRows == 64);
+
+				//! @brief		Smallest history (in bytes) that can be used, enough for one screen.
+				//! @details	The console doesn't work with less, see Console().
+				static constexpr uint16 MIN_HISTORY_SIZE = NUM_LINES*consoleLINE_SIZE;
+
+				//===============================================================================================//
+				//================================== PUBLIC METHOD DECLARATIONS =================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor. Starts with an empty console.
+				//! @param		ssd1306		The panel to draw on.
+				//! @param		font		Font to draw the text in. Must be no more than 8 pixels high.
+				//! @param		history		RAM to hold the text, #consoleLINE_SIZE bytes per line. Lines
+				//!							older than the history can hold are forgotten.
+				//! @param		historySize	Size of history, in bytes. If it is less than #MIN_HISTORY_SIZE, the
+				//!							history isn't used at all: Putc() and Tick() do nothing and the
+				//!							panel is never drawn on. See IsValid().
+				Console(Ssd1306<numCols, numRows, Transport> &ssd1306, const font_t &font, char *history, uint16 historySize);
+
+				//! @brief		Adds one character at the end of the last line.
+				//! @details	'\n' starts a new line, '\r' is ignored (so "\r\n" line endings work). Anything
+				//!				else is drawn in the font, wrapping to a new line if it doesn't fit.
+				void Putc(char character);
+
+				//! @brief		Adds a null-terminated string, see Putc().
+				void Puts(const char *msg);
+
+				//! @brief		Throws away all of the text and blanks the panel (on the next Tick()).
+				void Clear();
+
+				//! @brief		Scrolls the view back through the history.
+				//! @details	Stops at the oldest line in the history. While scrolled back, new text is
+				//!				still stored, but the view stays on the same lines.
+				void ScrollBack(uint16 numLines);
+
+				//! @brief		Scrolls the view forward, towards the last line.
+				void ScrollForward(uint16 numLines);
+
+				//! @brief		Scrolls the view back to the last line.
+				void ScrollToEnd();
+
+				//! @brief		Returns how many lines the view is scrolled back by (0 if it is showing the last line).
+				uint16 GetScrollBack();
+
+				//! @brief		Returns false if the history passed to Console() was less than
+				//!				#MIN_HISTORY_SIZE, so the console does nothing.
+				bool IsValid();
+
+				//! @brief		Sets the minimum time between two updates of the panel.
+				//! @details	Defaults to #consoleUPDATE_INTERVAL_MS. Everything that changes in between goes
+				//!				out in one update. 0 updates on every Tick() that has something to send.
+				void SetUpdateInterval(uint16 intervalMs);
+
+				//! @brief		Makes the next Tick() draw every line again.
+				//! @details	Use if something else has drawn on the panel.
+				void Redraw();
+
+				//! @brief		Draws and sends whatever has changed since the last update.
+				//! @details	Call from the main loop or a timer with the current time (e.g. Port::GetTimeMs()).
+				//!				Sends nothing if the last update was less than SetUpdateInterval() ago, or
+				//!				while a flush started with FlushAsync() is still running.
+				//! @returns	True if the panel was updated.
+				bool Tick(uint32 nowMs);
+
+			private:
+
+				//! @brief		pageLines entry of a page that isn't showing a line (it is blank).
+				static constexpr uint32 NO_LINE = 0xFFFFFFFF;
+
+				//! @brief		Returns the history entry for a line.
+				char* GetLine(uint32 line);
+
+				//! @brief		Starts a new line.
+				void NewLine();
+
+				//! @brief		Returns the oldest line still in the history.
+				uint32 GetOldestLine();
+
+				//! @brief		Limits #scrollBack so the view doesn't go past the oldest line in the history.
+				void LimitScrollBack();
+
+				//! @brief		Draws every line in view that isn't already in the frame buffer.
+				//! @returns	The display start line for the view.
+				uint8 Draw();
+
+				//! @brief		The panel the console is drawn on.
+				Ssd1306<numCols, numRows, Transport> &ssd1306;
+
+				//! @brief		Font the text is drawn in.
+				const font_t &font;
+
+				//! @brief		History of the text, #numHistoryLines lines of #consoleLINE_SIZE bytes.
+				char *history;
+				uint16 numHistoryLines;
+
+				//! @brief		Number of the last line (the one Putc() adds to), counting from 0 since Clear().
+				uint32 lastLine;
+
+				//! @brief		Number of characters in the last line, and it's width (in columns).
+				uint8 lastLineLength;
+				uint8 lastLineWidth;
+
+				//! @brief		First line that has had characters added since the last update, or #NO_LINE.
+				uint32 firstChangedLine;
+
+				//! @brief		Number of lines the view is scrolled back by.
+				uint16 scrollBack;
+
+				//! @brief		The line each page of the frame buffer is showing, or #NO_LINE.
+				uint32 pageLines[NUM_LINES];
+
+				//! @brief		The display start line last sent.
+				uint8 startLine;
+
+				//! @brief		True if something has changed since the last update.
+				bool isChanged;
+
+				//! @brief		See SetUpdateInterval().
+				uint16 updateIntervalMs;
+
+				//! @brief		Time of the last update, valid once #hasUpdated is true.
+				uint32 lastUpdateMs;
+				bool hasUpdated;
+		};
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_CONSOLE_H
+
+// EOF
@@ -0,0 +1,232 @@
+//!
+//! @file 				DisplayScheduler.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Flushes many SSD1306's spread over several buses, sharing each bus fairly.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_DISPLAY_SCHEDULER_H
+#define M_SSD1306_DISPLAY_SCHEDULER_H
+
+#include "Port.hpp"
+#include "SSD1306.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC DEFINES ========================================//
+		//===============================================================================================//
+
+		//! @brief		Max. number of panels one DisplayScheduler can drive.
+		#ifndef schedulerMAX_PANELS
+			#define schedulerMAX_PANELS			(12)
+		#endif
+
+		//! @brief		Max. number of buses one DisplayScheduler can drive.
+		#ifndef schedulerMAX_BUSES
+			#define schedulerMAX_BUSES			(4)
+		#endif
+
+		//! @brief		Bytes of bus time each panel (with a weight of 1) gets every time it's turn comes
+		//!				round. Panels on the same bus take turns, so smaller values interleave them more finely.
+		#ifndef schedulerQUANTUM_BYTES
+			#define schedulerQUANTUM_BYTES		(128)
+		#endif
+
+		//===============================================================================================//
+		//======================================= PUBLIC TYPEDEFS =======================================//
+		//===============================================================================================//
+
+		//! @brief		Totals for one bus, see DisplayScheduler::GetBusStats().
+		typedef struct
+		{
+			//! @brief		Number of panel frames that have been completely sent.
+			uint32 numFrames;
+
+			//! @brief		Number of transactions sent.
+			uint32 numTransactions;
+
+			//! @brief		Number of bytes sent (including address and control bytes).
+			uint32 numBytes;
+
+			//! @brief		Number of transactions that failed.
+			uint32 numErrors;
+
+			//! @brief		Port::GetTimeMs() when the stats were last cleared.
+			uint32 startTimeMs;
+		} schedulerBusStats_t;
+
+		//===============================================================================================//
+		//=========================================== CLASS =============================================//
+		//===============================================================================================//
+
+		//! @brief		Owns a set of Ssd1306's spread over several buses, and flushes them.
+		//! @details	RequestFlush() collects the changes of a panel straight away (like
+		//!				Ssd1306::FlushAsync()), so drawing can carry on, and the transactions are then
+		//!				sent in the background. Panels on different buses are sent at the same time (one
+		//!				worker thread per bus on LINUX). Panels on the same bus take turns (deficit round
+		//!				robin), each getting a share of the bus in proportion to it's weight, so one panel
+		//!				with a lot of changes can't hold up the others.
+		//!
+		//!				On PSOC and EMULATOR there are no threads, call Service() from the main loop to
+		//!				send the next transaction on each bus.
+		//!
+		//!				The panels must not be used directly (e.g. Flush()) while they are owned by a scheduler.
+		class DisplayScheduler
+		{
+			public:
+
+				//! @brief		Constructor.
+				DisplayScheduler();
+
+				//! @brief		Destructor. Waits for everything requested to be sent, and stops the
+				//!				worker threads on LINUX.
+				~DisplayScheduler();
+
+				//! @brief		Adds a panel.
+				//! @details	The panel's port has to already be set up for the bus (e.g. SetBusNumber()
+				//!				on LINUX). Panels that share a bus must be given the same bus number here.
+				//!				Lowers the panel's SetMaxTransactionSize() to #schedulerQUANTUM_BYTES if it
+				//!				is bigger.
+				//! @param		bus			Index of the bus (0 to #schedulerMAX_BUSES - 1), just used
+				//!							to group panels.
+				//! @param		weight		Relative share of the bus this panel gets when it is busy. Min. 1.
+				//! @returns	The panel number to pass to RequestFlush(), or -1 if there is no room
+				//!				or the bus number is out of range.
+				template<uint8 numCols, uint8 numRows, class Transport>
+				int8 AddPanel(Ssd1306<numCols, numRows, Transport> &ssd1306, uint8 bus, uint8 weight = 1);
+
+				//! @brief		Collects the changes of a panel and queues them to be sent.
+				//! @details	The panel's frame buffer can be drawn into as soon as this returns.
+				//! @returns	False if the last frame of this panel hasn't finished sending yet (or, on
+				//!				LINUX, the bus's worker thread couldn't be started). Nothing is collected and
+				//!				the changes stay dirty, so they go with the next request.
+				bool RequestFlush(uint8 panel);
+
+				//! @brief		Calls RequestFlush() for every panel.
+				//! @returns	The number of panels that were queued.
+				uint8 RequestFlushAll();
+
+				//! @brief		Returns true if the last frame of this panel hasn't finished sending yet.
+				bool IsPanelBusy(uint8 panel);
+
+				//! @brief		Blocks until everything requested has been sent.
+				//! @details	On PSOC and EMULATOR, this calls Service() until there is nothing left.
+				void Wait();
+
+				//! @brief		Sends the next transaction on each bus.
+				//! @details	Call from the main loop on PSOC and EMULATOR. Does nothing on LINUX, where
+				//!				the worker threads do this.
+				//! @returns	True if anything was sent.
+				bool Service();
+
+				//! @brief		Returns the totals for a bus since the last ClearStats().
+				schedulerBusStats_t GetBusStats(uint8 bus);
+
+				//! @brief		Returns the number of frames per second sent on a bus, counting the frames of
+				//!				all the panels on it, averaged since the last ClearStats().
+				uint16 GetBusFps(uint8 bus);
+
+				//! @brief		Resets the totals of every bus.
+				void ClearStats();
+
+			private:
+
+				//! @brief		Functions used to talk to a panel, so panels of different sizes can be mixed.
+				typedef bool (*startFunction_t)(void *ssd1306);
+				typedef uint16 (*sizeFunction_t)(void *ssd1306);
+				typedef uint8 (*sendFunction_t)(void *ssd1306);
+
+				//! @brief		Everything the scheduler knows about one panel.
+				typedef struct
+				{
+					//! @brief		The Ssd1306, of whatever size.
+					void *ssd1306;
+
+					startFunction_t startFlush;
+					sizeFunction_t getNextSize;
+					sendFunction_t sendNext;
+
+					uint8 bus;
+					uint8 weight;
+
+					//! @brief		True from RequestFlush() until the last transaction of the frame has been sent.
+					bool isPending;
+
+					//! @brief		Bytes the panel may still send before it's turn is over.
+					uint32 deficit;
+				} panel_t;
+
+				//! @brief		Picks the panel that sends next on a bus, taking it's bytes off the panel's deficit.
+				//! @returns	The panel, or -1 if nothing on the bus is waiting to be sent.
+				int8 SelectPanel(uint8 bus);
+
+				//! @brief		Sends the next transaction of a panel, and updates the stats.
+				//! @details	Called without the lock held on LINUX.
+				void SendTransaction(uint8 panelIndex, uint16 numBytes);
+
+				//! @brief		Returns true if any panel is waiting to be sent.
+				bool IsAnyPending();
+
+				//! @brief		Locks/unlocks everything shared with the worker threads (does nothing
+				//!				without threads).
+				void Lock();
+				void Unlock();
+
+				panel_t panels[schedulerMAX_PANELS];
+				uint8 numPanels;
+
+				//! @brief		Panel whose turn it is on each bus.
+				uint8 currentPanel[schedulerMAX_BUSES];
+
+				//! @brief		True once the current panel on a bus has been given it's quantum for this turn.
+				bool isTurnStarted[schedulerMAX_BUSES];
+
+				schedulerBusStats_t busStats[schedulerMAX_BUSES];
+
+				#if(MCU_PLATFORM == LINUX)
+					//! @brief		Passed to WorkerThreadMain().
+					typedef struct
+					{
+						DisplayScheduler *scheduler;
+						uint8 bus;
+					} worker_t;
+
+					//! @brief		Entry point of the worker thread for one bus.
+					static void* WorkerThreadMain(void *arg);
+
+					//! @brief		Starts the worker thread for a bus if it isn't running yet.
+					//! @details	Called with the lock held.
+					//! @returns	False if the thread couldn't be created.
+					bool StartWorker(uint8 bus);
+
+					worker_t workers[schedulerMAX_BUSES];
+					pthread_t workerThreads[schedulerMAX_BUSES];
+					bool isWorkerStarted[schedulerMAX_BUSES];
+
+					//! @brief		Set by the destructor to stop the worker threads.
+					bool isExit;
+
+					//! @brief		Protects everything above, and signals new requests and finished frames.
+					pthread_mutex_t mutex;
+					pthread_cond_t cond;
+				#endif
+		};
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_DISPLAY_SCHEDULER_H
+
+// EOF
@@ -0,0 +1,109 @@
+//!
+//! @file 				Font.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Runtime descriptor for the page-packed fonts made by tools/FontCompiler.py.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_FONT_H
+#define M_SSD1306_FONT_H
+
+#include "Port.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC TYPEDEFS =======================================//
+		//===============================================================================================//
+
+		//! @brief		One character of a font.
+		typedef struct
+		{
+			//! @brief		Index of the glyph's first byte in font_t::bitmaps.
+			uint16 offset;
+
+			//! @brief		Number of columns of bitmap data. 0 for glyphs with no pixels set (e.g. space).
+			uint8 width;
+
+			//! @brief		Number of columns to move on by after drawing the glyph, including the gap
+			//!				before the next one. 0 if the font doesn't have this character.
+			uint8 advance;
+		} fontGlyph_t;
+
+		//! @brief		Moves a pair of characters closer together (or further apart).
+		typedef struct
+		{
+			uint8 left;
+			uint8 right;
+
+			//! @brief		Added to the advance of the left character when it is followed by the right one.
+			int8 adjust;
+		} fontKerningPair_t;
+
+		//! @brief		A bitmap font, as generated by tools/FontCompiler.py.
+		//! @details	Glyphs are stored the same way as the SSD1306 GDDRAM, one byte per column with
+		//!				bit 0 at the top. Fonts higher than 8 pixels take more than one page; all the
+		//!				columns for the first page of a glyph come first, then all the columns for the
+		//!				second page, and so on, so each page of a glyph is one contiguous run.
+		typedef struct
+		{
+			//! @brief		Bitmap data for all glyphs.
+			const uint8 *bitmaps;
+
+			//! @brief		One entry for each character from firstChar to lastChar.
+			const fontGlyph_t *glyphs;
+
+			//! @brief		Kerning pairs, sorted by left then right character. NULL if there are none.
+			const fontKerningPair_t *kerningPairs;
+
+			//! @brief		Number of entries in kerningPairs.
+			uint16 numKerningPairs;
+
+			//! @brief		First character in the font.
+			uint8 firstChar;
+
+			//! @brief		Last character in the font.
+			uint8 lastChar;
+
+			//! @brief		Drawn in place of characters the font doesn't have.
+			uint8 defaultChar;
+
+			//! @brief		Height of the font, in pixels.
+			uint8 height;
+
+			//! @brief		Number of 8-pixel high pages each glyph takes.
+			uint8 numPages;
+		} font_t;
+
+		//===============================================================================================//
+		//==================================== FUNCTION PROTOTYPES ======================================//
+		//===============================================================================================//
+
+		//! @brief		Returns the glyph for a character.
+		//! @details	Returns the glyph for font_t::defaultChar if the font doesn't have the character.
+		const fontGlyph_t* FontGetGlyph(const font_t &font, uint8 character);
+
+		//! @brief		Returns the kerning adjustment for a pair of characters (0 if there is none).
+		int8 FontGetKerning(const font_t &font, uint8 left, uint8 right);
+
+		//! @brief		Returns the width of a string (in columns) when drawn in a font, including
+		//!				kerning and the gap after the last character.
+		uint16 FontGetStringWidth(const font_t &font, const char *msg);
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_FONT_H
+
+// EOF
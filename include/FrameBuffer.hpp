@@ -0,0 +1,259 @@
+//!
+//! @file 				FrameBuffer.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Host-side (MCU RAM) copy of the SSD1306 GDDRAM, with dirty-region tracking.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_FRAME_BUFFER_H
+#define M_SSD1306_FRAME_BUFFER_H
+
+#include "Port.hpp"
+#include "Font.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC DEFINES ========================================//
+		//===============================================================================================//
+
+		//! @brief		Panel sizes (columns, rows) that the driver classes are compiled for.
+		//! @details	The classes are templates, but their code lives in the .cpp files, so they are
+		//!				explicitly instantiated for each size in this list. Add to it (or define it in
+		//!				your compiler settings) to use other sizes.
+		#ifndef ssd1306PANEL_SIZES
+			#define ssd1306PANEL_SIZES(X)		X(128, 64) X(128, 32) X(64, 48)
+		#endif
+
+		//===============================================================================================//
+		//======================================= PUBLIC TYPEDEFS =======================================//
+		//===============================================================================================//
+
+		//! @brief		What the graphics primitives do to the pixels they cover.
+		typedef enum
+		{
+			COLOUR_OFF,
+			COLOUR_ON,
+			COLOUR_INVERT
+		} colour_t;
+
+		//! @brief		How FrameBuffer::Blit() combines the source bitmap (src) with the buffer (dest).
+		typedef enum
+		{
+			ROP_COPY,		//!< dest = src
+			ROP_OR,			//!< dest = dest | src
+			ROP_AND,		//!< dest = dest & src
+			ROP_XOR,		//!< dest = dest ^ src
+			ROP_NOT			//!< dest = ~src
+		} rasterOp_t;
+
+		//===============================================================================================//
+		//=========================================== CLASS =============================================//
+		//===============================================================================================//
+
+		class GlyphCache;
+
+		//! @brief		Page-packed copy of the display RAM.
+		//! @details	Laid out the same way as the SSD1306 GDDRAM, one byte per column per page,
+		//!				with bit 0 being the top pixel of the page. Every write is compared against
+		//!				the existing contents, and only bytes that actually change extend the dirty
+		//!				column range of their page. Ssd1306::Flush() then only sends the dirty ranges.
+		//!	@tparam		numCols		Width of the display, in pixels.
+		//! @tparam		numRows		Height of the display, in pixels. Must be a multiple of 8.
+		template<uint8 numCols, uint8 numRows>
+		class FrameBuffer
+		{
+			public:
+
+				//! @brief		Number of columns.
+				static constexpr uint8 NUM_COLS = numCols;
+
+				//! @brief		Number of rows.
+				static constexpr uint8 NUM_ROWS = numRows;
+
+				//! @brief		Number of 8-pixel high pages.
+				static constexpr uint8 NUM_PAGES = numRows/8;
+
+				static_assert((numRows % 8) == 0, "Number of rows must be a multiple of 8.");
+				static_assert((numRows >= 16) && (numRows <= 64), "SSD1306 supports 16 to 64 rows.");
+				static_assert((numCols >= 1) && (numCols <= 128), "SSD1306 supports up to 128 columns.");
+
+				//! @brief		Constructor.
+				//! @details	Clears the buffer and marks it all dirty, since the contents of the
+				//!				SSD1306 RAM are unknown at power-up.
+				FrameBuffer();
+
+				//! @brief		Writes a single byte (8 vertical pixels) into the buffer.
+				//! @details	Out-of-range pages/columns are ignored.
+				void WriteByte(uint8 page, uint8 col, uint8 byteToWrite);
+
+				//! @brief		Writes a run of bytes into one page of the buffer, starting at startCol.
+				//! @details	The run is clipped at the right-hand edge of the display.
+				void WriteBytes(uint8 page, uint8 startCol, const uint8 *bytesToWrite, uint8 numBytes);
+
+				//! @brief		Writes a run of bytes into one page, only changing the bits that are set in mask.
+				//! @details	Each byte becomes (old & ~mask) | (new & mask), so whatever is drawn above or
+				//!				below the masked rows is kept. Clipped at the right-hand edge of the display.
+				void WriteBytesMasked(uint8 page, uint8 startCol, const uint8 *bytesToWrite, uint8 mask, uint8 numBytes);
+
+				//! @brief		Fills a run of columns in one page with the same byte.
+				void FillBytes(uint8 page, uint8 startCol, uint8 byteToFillWith, uint8 numBytes);
+
+				//! @brief		Fills the entire buffer with a single byte.
+				void Fill(uint8 byteToFillWith);
+
+				//! @brief		Draws a string in a font, with the top of the text at the top of startPage.
+				//! @details	Each page of the text is put together first and written with one
+				//!				WriteBytes(), so the next flush sends it with one cursor setup and one data
+				//!				transaction per page. The gaps between glyphs are cleared. The text is cut off
+				//!				at the right-hand and bottom edges of the display.
+				//! @returns	The column after the last one drawn, so more text can be drawn after it.
+				uint8 DrawString(const font_t &font, const char *msg, uint8 startPage, uint8 startCol);
+
+				//! @brief		Draws a page-packed bitmap with its top-left corner at any row and column.
+				//! @details	bitmap holds (height + 7)/8 pages of width bytes, laid out the same way as
+				//!				for Ssd1306::ShowPattern(). Each column is shifted down across two pages and
+				//!				merged with what is already there: the height rows covered by the bitmap are
+				//!				replaced, everything above and below them is kept. Clipped at the edges.
+				void DrawBitmap(uint8 startRow, uint8 startCol, const uint8 *bitmap, uint8 width, uint8 height);
+
+				//! @brief		Combines a bitmap with the buffer at any position, using a raster op.
+				//! @details	bitmap (and mask) are laid out like for DrawBitmap(). The top-left corner can
+				//!				be off the screen (negative), whatever falls outside is clipped. Each column is
+				//!				read out of all the pages into one 64-bit word, shifted into place with one shift,
+				//!				combined, and only the bytes that changed are written back.
+				//! @param		height	In pixels, at most 64.
+				//! @param		op		How the bitmap is combined with what is already there.
+				//! @param		mask	Optional. Only pixels set in the mask are changed, so sprites can have
+				//!						transparent parts. If NULL, every pixel of the bitmap is used.
+				void Blit(int16 startRow, int16 startCol, const uint8 *bitmap, uint8 width, uint8 height, rasterOp_t op = ROP_COPY, const uint8 *mask = NULL);
+
+				//! @brief		Draws a string in a font, with the top of the text at any row.
+				//! @details	Like DrawString(), but only the font_t::height rows covered by the text are
+				//!				changed, so it can be drawn between other things on the same pages. Each page
+				//!				is still written with one WriteBytesMasked().
+				//! @param		cache	Optional. If it was built for this font and (startRow % 8), the glyphs
+				//!						are copied from it already shifted, otherwise they are shifted here.
+				//! @returns	The column after the last one drawn, so more text can be drawn after it.
+				uint8 DrawStringAtRow(const font_t &font, const char *msg, uint8 startRow, uint8 startCol, const GlyphCache *cache = NULL);
+
+				//! @brief		Sets, clears or inverts one pixel. Out-of-range pixels are ignored.
+				void SetPixel(uint8 row, uint8 col, colour_t colour = COLOUR_ON);
+
+				//! @brief		Returns true if a pixel is on (false if out of range).
+				bool GetPixel(uint8 row, uint8 col) const;
+
+				//! @brief		Draws a horizontal line of length pixels, starting at startCol and going right.
+				//! @details	All the pixels are in the same bit of one page, so this is one masked
+				//!				operation over a run of bytes.
+				void DrawHLine(uint8 row, uint8 startCol, uint8 length, colour_t colour = COLOUR_ON);
+
+				//! @brief		Draws a vertical line of length pixels, starting at startRow and going down.
+				//! @details	Costs one masked byte write per page covered.
+				void DrawVLine(uint8 startRow, uint8 col, uint8 length, colour_t colour = COLOUR_ON);
+
+				//! @brief		Draws a line between any two points (both ends included).
+				//! @details	Uses Bresenham's algorithm, but draws each horizontal (or vertical, for steep
+				//!				lines) run of pixels as one DrawHLine() (or DrawVLine()) rather than pixel by pixel.
+				void DrawLine(uint8 startRow, uint8 startCol, uint8 endRow, uint8 endCol, colour_t colour = COLOUR_ON);
+
+				//! @brief		Draws the 1-pixel outline of a rectangle.
+				void DrawRect(uint8 startRow, uint8 startCol, uint8 height, uint8 width, colour_t colour = COLOUR_ON);
+
+				//! @brief		Fills a rectangle.
+				//! @details	One masked operation over a run of bytes per page covered.
+				void FillRect(uint8 startRow, uint8 startCol, uint8 height, uint8 width, colour_t colour = COLOUR_ON);
+
+				//! @brief		Draws the 1-pixel outline of a circle. Parts off the edge of the display are clipped.
+				void DrawCircle(uint8 centreRow, uint8 centreCol, uint8 radius, colour_t colour = COLOUR_ON);
+
+				//! @brief		Fills a circle, one vertical span per column.
+				void FillCircle(uint8 centreRow, uint8 centreCol, uint8 radius, colour_t colour = COLOUR_ON);
+
+				//! @brief		Draws the 1-pixel outline of a rectangle with rounded corners.
+				//! @details	radius is limited to half the width/height.
+				void DrawRoundRect(uint8 startRow, uint8 startCol, uint8 height, uint8 width, uint8 radius, colour_t colour = COLOUR_ON);
+
+				//! @brief		Returns the byte at the given page and column (0 if out of range).
+				uint8 ReadByte(uint8 page, uint8 col) const;
+
+				//! @brief		Returns a pointer to the first column of a page.
+				const uint8* GetPage(uint8 page) const;
+
+				//! @brief		Returns true if any part of the buffer has changed since the last call to ClearDirty().
+				bool IsDirty() const;
+
+				//! @brief		Gets the dirty column range of a page.
+				//! @returns	True if the page is dirty, in which case startCol and endCol (inclusive) are valid.
+				bool GetDirtyRange(uint8 page, uint8 *startCol, uint8 *endCol) const;
+
+				//! @brief		Marks the whole buffer as clean. Called once the dirty regions have been sent.
+				void ClearDirty();
+
+				//! @brief		Marks the whole buffer as dirty, without changing the contents.
+				//! @details	Use when the SSD1306 RAM contents are no longer known (e.g. after a reset).
+				void Invalidate();
+
+				//! @brief		Returns the number of times Invalidate() has been called (wraps at 255).
+				//! @details	Lets anything that keeps its own copy of the SSD1306 RAM (e.g. TransferPlanner)
+				//!				tell that the copy can no longer be trusted.
+				uint8 GetInvalidateCount() const;
+
+			private:
+
+				//! @brief		Returns the bits of a page that fall within height rows from startRow.
+				static uint8 GetRowMask(uint8 page, uint8 startRow, uint8 height);
+
+				//! @brief		Applies a row mask to numBytes columns of a page, four columns at a time.
+				//! @details	Assumes the range is on the display.
+				void ApplyMask(uint8 page, uint8 startCol, uint8 numBytes, uint8 mask, colour_t colour);
+
+				//! @brief		Draws columns startCol-endCol (inclusive) of one row, clipped to the display.
+				void FillRowSpan(int16 row, int16 startCol, int16 endCol, colour_t colour);
+
+				//! @brief		Draws rows startRow-endRow (inclusive) of one column, clipped to the display.
+				void FillColumnSpan(int16 col, int16 startRow, int16 endRow, colour_t colour);
+
+				//! @brief		Draws one pixel, if it is on the display.
+				void PlotPixel(int16 row, int16 col, colour_t colour);
+
+				//! @brief		Draws the points of a circle for one step of the midpoint algorithm (x >= y > 0),
+				//!				without drawing any point twice.
+				//! @details	Each quadrant (top-left, top-right, bottom-left, bottom-right) has its own
+				//!				centre, so the corners of a rounded rect can be drawn the same way. The points
+				//!				on the axes (y == 0) are left to the caller.
+				void PlotArcPoints(const int16 *centreRows, const int16 *centreCols, int16 x, int16 y, colour_t colour);
+
+				//! @brief		Extends the dirty column range of a page to include startCol-endCol.
+				void MarkDirty(uint8 page, uint8 startCol, uint8 endCol);
+
+				//! @brief		The buffer itself, in the same page/column order as the SSD1306 GDDRAM.
+				uint8 buffer[NUM_PAGES][NUM_COLS];
+
+				//! @brief		First dirty column of each page. Page is clean if greater than dirtyEndCol.
+				uint8 dirtyStartCol[NUM_PAGES];
+
+				//! @brief		Last dirty column of each page (inclusive).
+				uint8 dirtyEndCol[NUM_PAGES];
+
+				//! @brief		Incremented by Invalidate().
+				uint8 invalidateCount;
+		};
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_FRAME_BUFFER_H
+
+// EOF
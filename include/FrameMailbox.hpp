@@ -0,0 +1,100 @@
+//!
+//! @file 				FrameMailbox.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Lock-free triple buffer for passing frames from a renderer to the flusher.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_FRAME_MAILBOX_H
+#define M_SSD1306_FRAME_MAILBOX_H
+
+#include "Port.hpp"
+#include "FrameBuffer.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//=========================================== CLASS =============================================//
+		//===============================================================================================//
+
+		//! @brief		Passes whole frames from one producer (the renderer) to one consumer (the flusher).
+		//! @details	Holds three frame buffers. At any time one belongs to the producer (the back
+		//!				buffer), one to the consumer (the front buffer), and the third holds the newest
+		//!				finished frame. Publish() and Acquire() swap buffers with a single atomic exchange,
+		//!				so neither side ever waits for the other. If the producer publishes again before
+		//!				the consumer has acquired the last frame, the last frame is dropped, so the
+		//!				consumer always gets the newest frame and never works through a backlog.
+		//!	@tparam		numCols		Width of the display, in pixels.
+		//! @tparam		numRows		Height of the display, in pixels.
+		template<uint8 numCols, uint8 numRows>
+		class FrameMailbox
+		{
+			public:
+
+				//! @brief		Constructor.
+				FrameMailbox();
+
+				//! @brief		Returns the buffer the producer should draw the next frame into.
+				//! @details	Holds an older frame (not necessarily the last one published), so the
+				//!				whole frame should be redrawn. Only call from the producer.
+				FrameBuffer<numCols, numRows>& GetBackBuffer();
+
+				//! @brief		Makes the back buffer the newest finished frame, and gives the producer
+				//!				a free buffer to draw the next one into.
+				//! @details	Only call from the producer.
+				void Publish();
+
+				//! @brief		Takes the newest finished frame.
+				//! @details	The frame stays valid until the next call to Acquire(). Only call from
+				//!				the consumer.
+				//! @returns	The frame, or NULL if nothing has been published since the last call.
+				const FrameBuffer<numCols, numRows>* Acquire();
+
+				//! @brief		Returns the number of frames published by the producer.
+				uint32 GetNumFramesProduced() const;
+
+				//! @brief		Returns the number of frames taken by the consumer.
+				uint32 GetNumFramesSent() const;
+
+				//! @brief		Returns the number of frames that were replaced by a newer one before the
+				//!				consumer took them.
+				uint32 GetNumFramesDropped() const;
+
+			private:
+
+				//! @brief		The three frames.
+				FrameBuffer<numCols, numRows> frames[3];
+
+				//! @brief		Index of the frame that belongs to the producer.
+				uint8 backIndex;
+
+				//! @brief		Index of the frame that belongs to the consumer.
+				uint8 frontIndex;
+
+				//! @brief		Index of the newest finished frame, plus #frameMailboxNEW_FRAME_BIT if the
+				//!				consumer hasn't taken it yet. Only ever changed with Port::AtomicExchange().
+				volatile uint8 middleState;
+
+				//! @brief		Frame counters. Each one is only written by one side.
+				volatile uint32 numFramesProduced;
+				volatile uint32 numFramesSent;
+				volatile uint32 numFramesDropped;
+		};
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_FRAME_MAILBOX_H
+
+// EOF
@@ -0,0 +1,84 @@
+//!
+//! @file 				GlyphCache.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Copy of a font with every glyph shifted down to a given row within a page.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_GLYPH_CACHE_H
+#define M_SSD1306_GLYPH_CACHE_H
+
+#include "Port.hpp"
+#include "Font.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//=========================================== CLASS =============================================//
+		//===============================================================================================//
+
+		//! @brief		Holds every glyph of a font already shifted down by a number of rows.
+		//! @details	Text that doesn't start on a page boundary has each glyph column split across
+		//!				two pages. FrameBuffer::DrawStringAtRow() does the shifting as it draws, unless
+		//!				it is given a cache built for the same font and shift, in which case it just
+		//!				copies bytes. Build one for each text line that is redrawn often (e.g. a clock).
+		//!
+		//!				A shifted glyph takes one more page than the original. The storage is supplied
+		//!				by the caller, use GetRequiredSize() to size it.
+		class GlyphCache
+		{
+			public:
+
+				//! @brief		Constructor.
+				//! @param		storage		RAM to hold the shifted glyphs.
+				//! @param		storageSize	Size of storage, in bytes.
+				GlyphCache(uint8 *storage, uint16 storageSize);
+
+				//! @brief		Returns the number of bytes of storage needed to cache a font.
+				static uint16 GetRequiredSize(const font_t &font);
+
+				//! @brief		Fills the cache with the glyphs of a font, shifted down by shift rows.
+				//! @param		shift		Row within the page the top of the text will be at (0-7).
+				//! @returns	False if the storage is too small for the font (the cache is then empty).
+				bool Build(const font_t &font, uint8 shift);
+
+				//! @brief		Returns true if the cache holds the given font with the given shift.
+				bool Matches(const font_t &font, uint8 shift) const;
+
+				//! @brief		Returns the shifted columns of a glyph of the cached font.
+				//! @details	Laid out like the font bitmaps (page-major), but with font_t::numPages + 1
+				//!				pages of glyph->width columns.
+				const uint8* GetGlyph(const fontGlyph_t *glyph) const;
+
+			private:
+
+				//! @brief		Shifted glyphs, in the same order as the font bitmaps.
+				uint8 *storage;
+
+				//! @brief		Size of storage, in bytes.
+				uint16 storageSize;
+
+				//! @brief		The font the cache was built for. NULL if the cache is empty.
+				const font_t *font;
+
+				//! @brief		The number of rows the glyphs are shifted down by.
+				uint8 shift;
+		};
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_GLYPH_CACHE_H
+
+// EOF
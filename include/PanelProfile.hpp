@@ -0,0 +1,170 @@
+//!
+//! @file 				PanelProfile.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Panel settings sent by the init functions, and the command tables made from them.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_PANEL_PROFILE_H
+#define M_SSD1306_PANEL_PROFILE_H
+
+#include "Port.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC DEFINES ========================================//
+		//===============================================================================================//
+
+		//! @brief		Number of command bytes in an init table, see PanelProfileGetInitTable().
+		#define ssd1306INIT_TABLE_SIZE		22
+
+		//===============================================================================================//
+		//======================================= PUBLIC TYPEDEFS =======================================//
+		//===============================================================================================//
+
+		//! @brief		Everything the init functions set up that depends on the panel.
+		//! @details	Define your own as constexpr and pass it to Ssd1306::OledInit(), which checks it at
+		//!				compile time with PanelProfileIsValid(). See the SSD1306 datasheet for the values.
+		typedef struct
+		{
+			//! @brief		Clock divide ratio (bits 0-3) and oscillator frequency (bits 4-7), command 0xD5.
+			uint8 displayClock;
+
+			//! @brief		Number of rows less one (15-63), command 0xA8.
+			uint8 multiplexRatio;
+
+			//! @brief		Vertical shift of the COM outputs (0-63), command 0xD3.
+			uint8 displayOffset;
+
+			//! @brief		Display start line (0-63), command 0x40-0x7F.
+			uint8 startLine;
+
+			//! @brief		0x14 to use the built-in charge pump (Vcc supplied internally), 0x10 if not.
+			uint8 chargePump;
+
+			//! @brief		0xA0, or 0xA1 to mirror the columns.
+			uint8 segmentRemap;
+
+			//! @brief		0xC0, or 0xC8 to scan the COM outputs in reverse (mirrors the rows).
+			uint8 comScanDirection;
+
+			//! @brief		COM pins hardware configuration, command 0xDA. 0x02 sequential, 0x12 alternative,
+			//!				plus 0x20 for left/right remap.
+			uint8 comPinConfig;
+
+			//! @brief		Contrast, command 0x81.
+			uint8 contrast;
+
+			//! @brief		Pre-charge period, phase 1 (bits 0-3) and phase 2 (bits 4-7), neither 0. Command 0xD9.
+			uint8 prechargePeriod;
+
+			//! @brief		VCOMH deselect level (bits 4-6), command 0xDB.
+			uint8 vcomhLevel;
+		} ssd1306PanelProfile_t;
+
+		//! @brief		The commands that set up a panel, made from a profile by PanelProfileGetInitTable().
+		typedef struct
+		{
+			uint8 commands[ssd1306INIT_TABLE_SIZE];
+		} ssd1306InitTable_t;
+
+		//===============================================================================================//
+		//==================================== FUNCTION PROTOTYPES ======================================//
+		//===============================================================================================//
+
+		//! @brief		Returns true if every setting of a profile is one the SSD1306 accepts.
+		constexpr bool PanelProfileIsValid(const ssd1306PanelProfile_t &profile)
+		{
+			return (profile.multiplexRatio >= 15) && (profile.multiplexRatio <= 63) &&
+				(profile.displayOffset <= 63) &&
+				(profile.startLine <= 63) &&
+				((profile.chargePump == 0x10) || (profile.chargePump == 0x14)) &&
+				((profile.segmentRemap == 0xA0) || (profile.segmentRemap == 0xA1)) &&
+				((profile.comScanDirection == 0xC0) || (profile.comScanDirection == 0xC8)) &&
+				((profile.comPinConfig & 0xCF) == 0x02) &&
+				((profile.prechargePeriod & 0x0F) != 0) && ((profile.prechargePeriod & 0xF0) != 0) &&
+				((profile.vcomhLevel & 0x8F) == 0);
+		}
+
+		//! @brief		Returns the commands that set up a panel with a profile.
+		//! @details	Display off, then each setting of the profile, then the entire display on and
+		//!				inverse commands set back to normal. Everything can go in one command transaction.
+		constexpr ssd1306InitTable_t PanelProfileGetInitTable(const ssd1306PanelProfile_t &profile)
+		{
+			return ssd1306InitTable_t
+			{
+				{
+					0xAE,								// Display off
+					0xD5, profile.displayClock,
+					0xA8, profile.multiplexRatio,
+					0xD3, profile.displayOffset,
+					(uint8)(0x40 | profile.startLine),
+					0x8D, profile.chargePump,
+					profile.segmentRemap,
+					profile.comScanDirection,
+					0xDA, profile.comPinConfig,
+					0x81, profile.contrast,
+					0xD9, profile.prechargePeriod,
+					0xDB, profile.vcomhLevel,
+					0xA4,								// Show the RAM, rather than every pixel on
+					0xA6								// Not inverted
+				}
+			};
+		}
+
+		//! @brief		Profile used by Ssd1306::OledInitVccInt(), for a panel with numRows rows.
+		constexpr ssd1306PanelProfile_t PanelProfileVccInt(uint8 numRows)
+		{
+			return ssd1306PanelProfile_t
+			{
+				0x80,								// 175 frames/sec
+				(uint8)(numRows - 1),
+				0x00,
+				0x00,
+				0x14,								// Charge pump on
+				0xA1,
+				0xC8,
+				(uint8)((numRows <= 32) ? 0x02 : 0x12),	// Sequential up to 32 rows, alternative for taller panels
+				0xFF,
+				0xF1,								// 15 DCLKs pre-charge, 1 DCLK discharge
+				0x20								// 0.77Vcc, the reset default
+			};
+		}
+
+		//! @brief		Profile used by Ssd1306::OledInitVccExt(), for a panel with numRows rows.
+		constexpr ssd1306PanelProfile_t PanelProfileVccExt(uint8 numRows)
+		{
+			return ssd1306PanelProfile_t
+			{
+				0x80,								// 200 frames/sec
+				(uint8)(numRows - 1),
+				0x00,
+				0x00,
+				0x10,								// Charge pump off
+				0xA1,
+				0xC8,
+				(uint8)((numRows <= 32) ? 0x02 : 0x12),
+				0xFF,
+				0x22,								// 2 DCLKs pre-charge, 2 DCLKs discharge
+				0x40
+			};
+		}
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_PANEL_PROFILE_H
+
+// EOF
@@ -3,7 +3,7 @@
 //! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
 //! @edited 			n/a
 //! @created			2012/10/04
-//! @last-modified 	2014/01/14
+//! @last-modified 	2026/10/16
 //! @brief 				Contains port specific functions for the SSD1306 library.
 //! @details
 //!						See the README in the repo root dir for more info.
@@ -16,6 +16,58 @@
 #ifndef PORT_H
 #define PORT_H
 
+//===============================================================================================//
+//======================================= PUBLIC DEFINES ========================================//
+//===============================================================================================//
+
+//! @brief		Values for #MCU_PLATFORM.
+#define PSOC				1
+#define LINUX				2
+#define EMULATOR			3
+
+//! @brief		Determines what code is used for the port-specific functions.
+//! @details	Supported platforms:
+//!					PSOC	All PSoC families (PSoC 3, PSoC 4, PSoC 5, PSoC 5LP)
+//!					LINUX	Linux, using the i2c-dev interface (/dev/i2c-N)
+//!					EMULATOR	Any host, talking to a software SSD1306 (Ssd1306Emulator)
+//!				Can also be set from the compiler command line (e.g. -DMCU_PLATFORM=LINUX).
+#ifndef MCU_PLATFORM
+	#define MCU_PLATFORM		PSOC
+#endif
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+#if(MCU_PLATFORM == PSOC)
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+		// PSoC includes, also provide the fixed-width types (uint8, e.t.c)
+		#include <device.h>
+	#ifdef __cplusplus
+	}
+	#endif
+#elif((MCU_PLATFORM == LINUX) || (MCU_PLATFORM == EMULATOR))
+	#include <stddef.h>
+	#include <stdint.h>
+
+	// Fixed-width types that the PSoC headers provide on PSoC platforms
+	typedef uint8_t		uint8;
+	typedef uint16_t	uint16;
+	typedef uint32_t	uint32;
+	typedef int8_t		int8;
+	typedef int16_t		int16;
+	typedef int32_t		int32;
+
+	#if(MCU_PLATFORM == LINUX)
+		// Worker thread for I2cMasterStartWrite()
+		#include <pthread.h>
+	#else
+		namespace MbeddedNinja { namespace MSsd1306 { class Ssd1306Emulator; } }
+	#endif
+#endif
+
 namespace SSD1306Ns
 {
 
@@ -23,10 +75,62 @@ namespace SSD1306Ns
 	//======================================= PUBLIC DEFINES ========================================//
 	//===============================================================================================//
 	
-	//! @brief		Determines what code is used for the port-specific functions.
-	//! @details	Supported platforms:
-	//!					PSOC	All PSoC families (PSoC 3, PSoC 4, PSoC 5, PSoC 5LP)
-	#define MCU_PLATFORM		PSOC
+	#if(MCU_PLATFORM == LINUX)
+		//! @brief		Default maximum length (in bytes, including the control byte) of one I2C message.
+		//! @details	Longer transactions are split into several messages, each starting with the
+		//!				control byte again. Change at run-time with Port::SetMaxMessageSize().
+		#define portLINUX_DEFAULT_MAX_MSG_SIZE		(4096)
+	
+		//! @brief		Size of the buffer that messages are assembled in before being passed to the kernel.
+		//! @details	Must be large enough to hold a full frame plus control bytes. Larger
+		//!				transactions are sent with more than one ioctl() call.
+		#define portLINUX_MSG_BUFFER_SIZE			(2048)
+	
+		//! @brief		Max. size of a SMBus I2C block write, used when the adapter can't do plain I2C
+		//!				(e.g. the i2c-stub module).
+		#define portLINUX_SMBUS_BLOCK_MAX			(32)
+	
+		//! @brief		Max. number of bytes in one SPI_IOC_MESSAGE.
+		//! @details	Matches the default spidev buffer size (the "bufsiz" module parameter). Longer
+		//!				transactions are sent with more than one ioctl().
+		#define portLINUX_SPI_MAX_MSG_SIZE			(4096)
+	
+		//! @brief		Max. number of spi_ioc_transfer's in one SPI_IOC_MESSAGE.
+		#define portLINUX_SPI_MAX_XFERS				(8)
+	
+		//! @brief		Default SPI clock, change at run-time with Port::SetSpiSpeedHz().
+		#define portLINUX_SPI_DEFAULT_SPEED_HZ		(8000000)
+	#endif
+	
+	//! @brief		Bit of the control byte that gives the level of the D/C# pin when using SPI.
+	#define portSPI_DC_BIT						(0x40)
+	
+	//! @brief		Max. length (in bytes, including the control byte) of one transaction passed to
+	//!				I2cMasterStartWrite().
+	//! @details	The PSoC I2C component takes an 8-bit byte count.
+	#if(MCU_PLATFORM == PSOC)
+		#define portASYNC_MAX_TRANSACTION_SIZE		(255)
+	#else
+		#define portASYNC_MAX_TRANSACTION_SIZE		(65535)
+	#endif
+	
+	//! @brief		Rough bus time (in byte times) of the fixed part of one transaction.
+	//! @details	The address and control byte, plus start/stop conditions and any per-transfer
+	//!				overhead in the driver underneath. Used as the default TransferPlanner cost model.
+	#if(MCU_PLATFORM == PSOC)
+		#define portTRANSACTION_OVERHEAD			(3)
+	#elif(MCU_PLATFORM == LINUX)
+		// Each transaction is an ioctl(), which costs several byte times at 400kHz
+		#define portTRANSACTION_OVERHEAD			(8)
+	#else
+		// The emulator only counts bytes, so the plans are exact in bytes
+		#define portTRANSACTION_OVERHEAD			(2)
+	#endif
+	
+	#if(MCU_PLATFORM == EMULATOR)
+		//! @brief		Max. number of emulated SSD1306's that can be attached to each I2C port.
+		#define portEMULATOR_MAX_DEVICES			(2)
+	#endif
 
 	//! @brief 		Set to 1 if SA0 is pulled low
 	#define SSD1306_I2C_SA0_0 	1		
@@ -49,10 +153,124 @@ namespace SSD1306Ns
 				i2cRight
 			} i2cPort_t;
 			
+			//! @brief		Result of a whole I2C transaction, as returned by I2cMasterWriteVectored().
+			//! @details	Errors record which phase of the transaction failed.
+			typedef enum
+			{
+				TRANSFER_OK,
+				TRANSFER_ERROR_START,
+				TRANSFER_ERROR_BYTE,
+				TRANSFER_ERROR_STOP,
+				//! @brief		Returned by I2cMasterStartWrite() if the previous write hasn't finished yet.
+				TRANSFER_BUSY
+			} transferResult_t;
+			
+			//! @brief		A contiguous block of bytes to write. Used by I2cMasterWriteVectored().
+			typedef struct
+			{
+				const uint8 *data;
+				uint16 numBytes;
+			} ioVector_t;
+			
+			//! @brief		Called when a write started with I2cMasterStartWrite() has finished.
+			//! @param		context		The context pointer passed to I2cMasterStartWrite().
+			//! @param		result		A #transferResult_t, the first error if any transaction failed.
+			typedef void (*writeCompleteCallback_t)(void *context, uint8 result);
+			
+			//! @brief		Interface used to talk to the SSD1306, see SetInterface().
+			typedef enum
+			{
+				//! @brief		I2C, each transaction is an address byte, a control byte and then the payload.
+				INTERFACE_I2C,
+				//! @brief		4-wire SPI, the payload is sent on it's own and the D/C# pin says whether
+				//!				it is commands or data.
+				INTERFACE_SPI
+			} interface_t;
+			
+			//! @brief		Selects the bus to use (I2C or SPI), out of the two the board has.
 			i2cPort_t i2cPort;
 		
 			//! @brief		Constructor.
 			Port();
+			
+			//! @brief		Sets the interface used to talk to the SSD1306. Defaults to #INTERFACE_I2C.
+			//! @details	With #INTERFACE_SPI, all the I2cMaster... write functions send over SPI instead.
+			//!				The slave address is ignored, and rather than being sent, the control byte sets
+			//!				the D/C# pin (see #portSPI_DC_BIT). The pin is only changed when it needs to be.
+			//!				Don't change the interface while a write is in progress.
+			void SetInterface(interface_t interfaceType);
+			
+			//! @brief		Returns the interface used to talk to the SSD1306.
+			interface_t GetInterface();
+			
+			//! @brief		Returns the number of bytes each transaction takes on the bus on top of the
+			//!				payload (2 for I2C, the address and control byte, 0 for SPI).
+			uint8 GetTransactionOverheadBytes();
+			
+			#if(MCU_PLATFORM == LINUX)
+				//! @brief		Destructor. Closes any open I2C bus devices.
+				~Port();
+				
+				//! @brief		Function used to call ioctl(). Replace with SetIoctlFunction() to mock the bus.
+				typedef int (*ioctlFunction_t)(int fd, unsigned long request, void *arg);
+				
+				//! @brief		Maps an I2C port to a Linux I2C bus number (/dev/i2c-N).
+				//! @details	Defaults are i2cLeft => 0, i2cRight => 1. Closes the bus if it was already open.
+				void SetBusNumber(i2cPort_t i2cPort, uint8 busNumber);
+				
+				//! @brief		Uses an already open file descriptor for an I2C port, rather than opening /dev/i2c-N.
+				//! @details	The port does not take ownership, the file descriptor is not closed by Port.
+				//!				Useful for testing with a mock file descriptor.
+				//! @param		supportsI2c		False if the adapter can only do SMBus, so transactions are sent
+				//!								as SMBus I2C block writes (what GetFileDescriptor() picks for
+				//!								such an adapter it opens itself).
+				void SetFileDescriptor(i2cPort_t i2cPort, int fd, bool supportsI2c = true);
+				
+				//! @brief		Sets the maximum length of a single I2C message, including the control byte.
+				//! @details	Some adapters limit the length of a message. Transactions longer than this are
+				//!				split into multiple messages, each one starting with the control byte.
+				void SetMaxMessageSize(uint16 maxMessageSize);
+				
+				//! @brief		Replaces the function used to call ioctl().
+				//! @details	Used to test against a mock, without a real I2C bus. Pass NULL to restore the default.
+				//!				Also used for the SPI_IOC_MESSAGE and GPIO ioctls of #INTERFACE_SPI.
+				void SetIoctlFunction(ioctlFunction_t ioctlFunction);
+				
+				//! @brief		Maps a port to a Linux SPI device (/dev/spidevB.C).
+				//! @details	Defaults are i2cLeft => spidev0.0, i2cRight => spidev0.1. Closes the device
+				//!				if it was already open.
+				void SetSpiDevice(i2cPort_t i2cPort, uint8 busNumber, uint8 chipSelect);
+				
+				//! @brief		Uses an already open spidev file descriptor for a port. Not closed by Port.
+				//! @details	The mode and speed are left as they are. Useful for testing with a mock
+				//!				file descriptor.
+				void SetSpiFileDescriptor(i2cPort_t i2cPort, int fd);
+				
+				//! @brief		Sets the SPI clock (in Hz) used when a spidev device is opened.
+				void SetSpiSpeedHz(uint32 speedHz);
+				
+				//! @brief		Sets the GPIO used for the D/C# pin of a port, as a line of a GPIO chip
+				//!				(/dev/gpiochipN). Closes the line if it was already open.
+				void SetDcGpio(i2cPort_t i2cPort, uint8 chipNumber, uint8 line);
+				
+				//! @brief		Uses an already requested GPIO line handle (from GPIO_GET_LINEHANDLE_IOCTL)
+				//!				for the D/C# pin of a port. Not closed by Port.
+				void SetDcFileDescriptor(i2cPort_t i2cPort, int fd);
+			#endif
+			
+			#if(MCU_PLATFORM == EMULATOR)
+				//! @brief		Attaches an emulated SSD1306 to an I2C port.
+				//! @details	Transactions are routed to the emulator with the matching I2C address.
+				//!				Transactions to an address with nothing attached fail at the start phase,
+				//!				like a real NACK. With #INTERFACE_SPI, the first emulator attached to the port
+				//!				gets every transaction, as if it's CS# was tied low.
+				//! @returns	False if there is no room for another device on the port.
+				bool AttachEmulator(i2cPort_t i2cPort, MbeddedNinja::MSsd1306::Ssd1306Emulator *emulator);
+				
+				//! @brief		Returns the total time (in micro-seconds) that DelayUs() and DelayMs() have been asked to wait.
+				//! @details	The emulator doesn't actually wait, the delay is just added up.
+				uint32 GetTotalDelayUs();
+			#endif
 		
 			//! @brief		Initialises the I2C interface.
 			void I2cStart();
@@ -62,6 +280,7 @@ namespace SSD1306Ns
 			void I2cEnableInt();
 			
 			//! @brief		Sends a start signal on the I2C interface.
+			//! @details	This and the other byte-at-a-time functions are for #INTERFACE_I2C only.
 			uint8 I2cMasterSendStart(uint8 slaveAddress, uint8 readWrite);
 			
 			//! @brief		Writes a byte across the I2C interface.
@@ -70,6 +289,64 @@ namespace SSD1306Ns
 			//! @brief		Sends stop signal on I2C interface.
 			uint8 I2cMasterSendStop();
 			
+			//! @brief		Writes a whole transaction (start, control byte, data, stop) across the I2C interface.
+			//! @details	Same as I2cMasterWriteVectored() with a single vector.
+			//! @returns	A #transferResult_t.
+			uint8 I2cMasterWriteBuffer(uint8 slaveAddress, uint8 controlByte, const uint8 *buffer, uint16 numBytes);
+			
+			//! @brief		Writes a whole transaction (start, control byte, data, stop) across the I2C interface,
+			//!				with the data gathered from one or more separate blocks of memory.
+			//! @details	The I2C port is selected once per transaction rather than once per byte, and
+			//!				platforms with DMA or kernel drivers can send the whole transaction in one go.
+			//!				If any phase fails, a stop is still sent and the rest of the data is skipped.
+			//! @returns	A #transferResult_t.
+			uint8 I2cMasterWriteVectored(uint8 slaveAddress, uint8 controlByte, const ioVector_t *vectors, uint8 numVectors);
+			
+			//! @brief		Writes a whole transaction across the SPI interface, with the D/C# pin set
+			//!				beforehand.
+			//! @details	Used by the I2cMaster... write functions when the interface is #INTERFACE_SPI.
+			//!				On LINUX the whole transaction goes to the kernel in one SPI_IOC_MESSAGE, one
+			//!				spi_ioc_transfer per vector, so nothing is copied.
+			//! @param		isData		Level of the D/C# pin, true for data, false for commands.
+			//! @returns	A #transferResult_t.
+			uint8 SpiWriteVectored(bool isData, const ioVector_t *vectors, uint8 numVectors);
+			
+			//! @brief		Starts writing a list of transactions, without waiting for them to be sent.
+			//! @details	Each vector is one whole transaction, with the control byte as it's first byte.
+			//!				The memory the vectors point to must not change until the write has finished.
+			//!				On PSOC each transaction is handed to the I2C component, which sends it from
+			//!				it's interrupt, and I2cMasterServiceWrite() starts the next one. On LINUX the
+			//!				transactions are sent by a worker thread. On EMULATOR one transaction is sent
+			//!				per call to I2cMasterServiceWrite(). The callback is called (from the worker
+			//!				thread on LINUX) once the last transaction has been sent, or one has failed.
+			//!				The write counts as busy until the callback has returned, but the callback
+			//!				itself can start the next write.
+			//!				Don't call the blocking write functions until I2cMasterIsWriteBusy() is false.
+			//! @returns	#TRANSFER_BUSY if the last write is still in progress, otherwise #TRANSFER_OK.
+			uint8 I2cMasterStartWrite(
+				uint8 slaveAddress,
+				const ioVector_t *transactions,
+				uint8 numTransactions,
+				writeCompleteCallback_t callback,
+				void *context);
+			
+			//! @brief		Returns true while a write started with I2cMasterStartWrite() is in progress.
+			//! @details	Stays true until it's callback has returned, except when called from the
+			//!				callback.
+			bool I2cMasterIsWriteBusy();
+			
+			//! @brief		Moves a write started with I2cMasterStartWrite() on to the next transaction once
+			//!				the current one is complete.
+			//! @details	Call from the main loop, a timer or the I2C interrupt. Returns straight away if
+			//!				the current transaction is still being sent. Does nothing on LINUX.
+			void I2cMasterServiceWrite();
+			
+			//! @brief		Blocks until the write started with I2cMasterStartWrite() has finished.
+			//! @details	Returns straight away when called from the write's callback. On LINUX it also
+			//!				does when called from a callback which has started another write, as the
+			//!				worker thread can't send it until the callback returns.
+			void I2cMasterWaitForWrite();
+			
 			//! @brief		Delays processing for a certain amount of time (in micro-seconds).
 			//! @details	This can either be a hard wait (stalls the processor), or a soft wait
 			//!				(performs a context-switch, only applicable if using an OS).
@@ -88,8 +365,197 @@ namespace SSD1306Ns
 			//! @brief		Pulls the reset pin high, taking SSD1306 out of reset
 			void PullResetHigh();
 			
+			//! @brief		Enables power to the Vddb line.
+			void EnableVddb();
+			
+			//! @brief		Disables power to the Vddb line.
+			void DisableVddb();
+			
 			//! @brief		Prints debug information to an output (typically a UART).
 			void PrintDebug(const char* msg);
+			
+			//! @brief		Writes a new value to a byte and returns the old one, as one atomic operation.
+			//! @details	Used by FrameMailbox to swap buffers between threads (or a thread and an
+			//!				interrupt) without locking.
+			static uint8 AtomicExchange(volatile uint8 *value, uint8 newValue);
+			
+			//! @brief		Returns a free-running time in milli-seconds (wraps after ~49 days).
+			//! @details	Only differences between two calls mean anything. Used by DisplayScheduler to
+			//!				work out frame rates. On PSOC the first call starts the SysTick timer (PSoC 4/5LP).
+			static uint32 GetTimeMs();
+			
+			//! @brief		Returns a free-running time in micro-seconds (wraps after ~71 minutes).
+			//! @details	Only differences between two calls mean anything. Used to time flushes, see
+			//!				Ssd1306::GetStats(). On PSOC it is worked out from the SysTick count, so it has
+			//!				the resolution of the CPU clock.
+			static uint32 GetTimeUs();
+			
+			//! @brief		Makes sure all memory accesses before it are done before any after it.
+			//! @details	Used by Ssd1306::GetStats() to read the counters while another thread (or an
+			//!				interrupt) may be updating them.
+			static void MemoryBarrier();
+			
+			//! @brief		Stops anything else getting past EnterCritical() with the same lock until
+			//!				ExitCritical() is called.
+			//! @details	Only for a few lines of code. On PSOC it masks interrupts (single core, so
+			//!				nothing else can run), elsewhere it spins on the lock. Used by Ssd1306 to update
+			//!				it's counters from more than one thread.
+			//! @param		lock	A byte starting at 0, the same one for every section sharing the data.
+			//! @returns	State to pass to ExitCritical().
+			static uint8 EnterCritical(volatile uint8 *lock);
+			
+			//! @brief		Ends a section started with EnterCritical().
+			//! @param		state	As returned by EnterCritical().
+			static void ExitCritical(volatile uint8 *lock, uint8 state);
+			
+		private:
+		
+			//! @brief		Starts sending transaction #asyncIndex of the current asynchronous write.
+			void StartAsyncTransaction();
+			
+			//! @brief		Ends the current asynchronous write and calls the callback.
+			void FinishAsyncWrite(uint8 result);
+			
+			//! @brief		Sets the D/C# pin of the current port, if it isn't at that level already.
+			//! @returns	A #transferResult_t.
+			uint8 SetDcPin(bool isData);
+			
+			//! @brief		Interface used to talk to the SSD1306.
+			interface_t interfaceType;
+			
+			//! @brief		Transactions of the current asynchronous write. See I2cMasterStartWrite().
+			const ioVector_t *asyncTransactions;
+			
+			//! @brief		Number of transactions in #asyncTransactions, and the one being sent.
+			uint8 asyncNumTransactions, asyncIndex;
+			
+			//! @brief		Slave address of the current asynchronous write.
+			uint8 asyncSlaveAddress;
+			
+			//! @brief		Called once the current asynchronous write has finished.
+			writeCompleteCallback_t asyncCallback;
+			
+			//! @brief		Passed to #asyncCallback.
+			void *asyncContext;
+			
+			//! @brief		True while an asynchronous write is in progress, including while it's callback
+			//!				is running.
+			volatile bool isAsyncBusy;
+			
+			//! @brief		True while the callback of the last asynchronous write is running, until it
+			//!				starts the next write.
+			volatile bool isAsyncCompleting;
+		
+			#if(MCU_PLATFORM == LINUX)
+				//! @brief		Entry point of the worker thread which sends asynchronous writes.
+				static void* AsyncThreadMain(void *arg);
+				
+				//! @brief		Worker thread, started by the first call to I2cMasterStartWrite().
+				pthread_t asyncThread;
+				
+				//! @brief		Protects #isAsyncBusy, #isAsyncCompleting and #isAsyncThreadExit, and signals
+				//!				changes to them.
+				pthread_mutex_t asyncMutex;
+				pthread_cond_t asyncCond;
+				
+				//! @brief		True once #asyncThread has been started.
+				bool isAsyncThreadStarted;
+				
+				//! @brief		Set by the destructor to stop #asyncThread.
+				bool isAsyncThreadExit;
+				
+				//! @brief		Opens the I2C bus for the current port if it isn't open yet.
+				//! @returns	The file descriptor, or -1 on error.
+				int GetFileDescriptor();
+				
+				//! @brief		Sends a transaction as SMBus I2C block writes, for adapters that can't do plain I2C.
+				uint8 SendSmbusBlocks(int fd, uint8 slaveAddress, uint8 controlByte, const ioVector_t *vectors, uint8 numVectors);
+				
+				//! @brief		File descriptor for each I2C port (-1 if not open).
+				int fds[2];
+				
+				//! @brief		True if the file descriptor was opened by Port (and therefore gets closed by it).
+				bool ownsFd[2];
+				
+				//! @brief		Linux bus number for each I2C port.
+				uint8 busNumbers[2];
+				
+				//! @brief		True if the adapter for each I2C port supports plain I2C transfers (I2C_RDWR).
+				bool supportsI2c[2];
+				
+				//! @brief		Max. length of one I2C message, including the control byte.
+				uint16 maxMessageSize;
+				
+				//! @brief		Function used to call ioctl().
+				ioctlFunction_t ioctlFunction;
+				
+				//! @brief		Messages are assembled here before being handed to the kernel, see BusI2cDevWrite().
+				uint8 msgBuffer[portLINUX_MSG_BUFFER_SIZE];
+				
+				//! @brief		Bytes written with I2cMasterWriteByte() are collected here until I2cMasterSendStop().
+				uint8 byteBuffer[portLINUX_MSG_BUFFER_SIZE];
+				
+				//! @brief		Number of bytes in #byteBuffer.
+				uint16 byteBufferLength;
+				
+				//! @brief		Slave address passed to I2cMasterSendStart().
+				uint8 byteBufferAddress;
+				
+				//! @brief		Opens the spidev device for the current port if it isn't open yet.
+				//! @returns	The file descriptor, or -1 on error.
+				int GetSpiFileDescriptor();
+				
+				//! @brief		Requests the D/C# GPIO line for the current port if it hasn't been yet.
+				//! @returns	The line handle file descriptor, or -1 on error.
+				int GetDcFileDescriptor();
+				
+				//! @brief		spidev file descriptor for each port (-1 if not open).
+				int spiFds[2];
+				
+				//! @brief		True if the spidev file descriptor was opened by Port.
+				bool ownsSpiFd[2];
+				
+				//! @brief		spidev bus and chip select numbers for each port.
+				uint8 spiBusNumbers[2], spiChipSelects[2];
+				
+				//! @brief		SPI clock set when a spidev device is opened.
+				uint32 spiSpeedHz;
+				
+				//! @brief		D/C# GPIO line handle for each port (-1 if not requested).
+				int dcFds[2];
+				
+				//! @brief		True if the line handle was requested by Port.
+				bool ownsDcFd[2];
+				
+				//! @brief		GPIO chip and line of the D/C# pin of each port.
+				uint8 dcChipNumbers[2], dcLines[2];
+				
+				//! @brief		True once SetDcGpio() has been called for the port.
+				bool isDcGpioSet[2];
+			#endif
+			
+			#if(MCU_PLATFORM == PSOC)
+				//! @brief		Returns true once every byte written to the SPI component of the current
+				//!				port has been shifted out.
+				bool IsSpiIdle();
+			#endif
+			
+			//! @brief		Last level written to the D/C# pin of each port (-1 if unknown).
+			int8 dcLevels[2];
+			
+			#if(MCU_PLATFORM == EMULATOR)
+				//! @brief		Emulators attached to each I2C port.
+				MbeddedNinja::MSsd1306::Ssd1306Emulator *emulators[2][portEMULATOR_MAX_DEVICES];
+				
+				//! @brief		Emulator addressed by the current transaction (NULL if none).
+				MbeddedNinja::MSsd1306::Ssd1306Emulator *currentEmulator;
+				
+				//! @brief		Total delay time requested, in micro-seconds.
+				uint32 totalDelayUs;
+				
+				//! @brief		Returns the emulator with the given address on the current port, or NULL.
+				MbeddedNinja::MSsd1306::Ssd1306Emulator* FindEmulator(uint8 slaveAddress);
+			#endif
 	
 	};
 	
@@ -3,7 +3,7 @@
 //! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @edited 			n/a
 //! @created			2012-10-04
-//! @last-modified 		2014-11-01
+//! @last-modified 		2026-10-16
 //! @brief 				Driver for the SDD1306 OLED segment/common controller.
 //! @details
 //!						See the README in the repo root dir for more info.
@@ -18,30 +18,33 @@
 #define M_SSD1306_SSD1306_H
 
 #include "Port.hpp"
+#include "FrameBuffer.hpp"
+#include "FrameMailbox.hpp"
+#include "TransferPlanner.hpp"
+#include "Transport.hpp"
+#include "BusTrace.hpp"
+#include "PanelProfile.hpp"
 
 namespace MbeddedNinja
 {
 	namespace MSsd1306
 	{
 	
+		// The port layer lives in it's own namespace
+		using SSD1306Ns::Port;
+	
 		//===============================================================================================//
 		//======================================= PUBLIC DEFINES ========================================//
 		//===============================================================================================//
 		
-		//! @brief		Number of columns of display device connected to SSD1306.
-		#define ssd1306NUM_COLS				128
-		
-		//! @brief		Number of rows of display device connected to SSD1306.
-		//! @note		Currenlty not used in any code.
-		#define ssd1306NUM_ROWS				32
-		
 		//! @brief		Determines the max brightness used by the FadeIn() and FadeOut() functions.
 		#define	ssd1306BRIGHTNESS			0x8F
 		
 		//! @brief		Enables/disables fonts.
 		//! @details	As fonts a decent amount of flash memory, there is
-		//!				the option to disables fonts. If fonts are disabled, you can't use any
-		//! 			font-related functions.
+		//!				the option to disables fonts. If fonts are disabled, the built-in fonts are
+		//! 			left out and you can't use ShowFont57() or ShowString(). frameBuffer.DrawString()
+		//!				still works with fonts you include yourself (see include/fonts/).
 		#define ssd1306ENABLE_FONTS			1
 
 		//! @brief		Sent over I2C to indiciate to the SSD1306 IC that a command follows.
@@ -52,11 +55,148 @@ namespace MbeddedNinja
 		//! @details	This is the "control" byte.
 		#define ssd1306DATA_FOLLOWS_BYTE 	0x40
 
+		//! @brief		Size (in bytes) of the command queue used to coalesce commands.
+		//! @details	Commands written while a command batch is open are collected here and sent
+		//!				as one I2C transaction. The queue is sent early if it fills up.
+		#define ssd1306CMD_QUEUE_SIZE		32
+
+		//! @brief		7-bit, right-adjusted SSD1306 I2C address if SA0 is pulled low.
+		#define SSD1306_I2C_ADD_SA0_0		0x3C
+
+		//! @brief		7-bit, right-adjusted SSD1306 I2C address if SA0 is pulled high.
+		#define SSD1306_I2C_ADD_SA0_1		0x3D
+
+		// Check to make sure SA0 has a defined position
+		#if((SSD1306_I2C_SA0_0 ^ SSD1306_I2C_SA0_1) != 1)
+			#error Please set either SSD1306_I2C_SA0_0 or SSD1306_I2C_SA0_1 to 1, but not both
+		#endif
+
+		//! @brief		I2C address Ssd1306 objects use unless one is passed to the constructor or
+		//!				SetI2cAddress(). Depends on the position of SA0 set in Port.hpp.
+		#if(SSD1306_I2C_SA0_0 == 1)
+			#define SSD1306_I2C_ADD 		SSD1306_I2C_ADD_SA0_0
+		#else
+			#define SSD1306_I2C_ADD 		SSD1306_I2C_ADD_SA0_1
+		#endif
+
+		//! @brief		Smallest value SetMaxTransactionSize() accepts.
+		#define ssd1306MIN_TRANSACTION_SIZE	64
+
+		//! @brief		Set to 1 to count transactions, bytes, errors and flush times, see Ssd1306::GetStats().
+		//! @details	When 0, the counting code and counters are left out altogether.
+		#ifndef configSSD1306_STATS
+			#define configSSD1306_STATS		0
+		#endif
+
+		//! @brief		Number of buckets in the flush time histogram of #ssd1306Stats_t.
+		#define ssd1306STATS_NUM_FLUSH_BUCKETS		10
+
+		//! @brief		Upper limit (in micro-seconds) of the first flush time bucket. Each bucket after
+		//!				it is twice as wide, and the last one takes everything longer.
+		#define ssd1306STATS_FIRST_BUCKET_US		500
+
+		//===============================================================================================//
+		//======================================= PUBLIC TYPEDEFS =======================================//
+		//===============================================================================================//
+
+		//! @brief		Snapshot of the counters of one Ssd1306, see Ssd1306::GetStats().
+		typedef struct
+		{
+			//! @brief		Number of transactions sent.
+			uint32 numTransactions;
+
+			//! @brief		Number of command bytes sent (not counting control bytes).
+			uint32 numCommandBytes;
+
+			//! @brief		Number of display data bytes sent (not counting control bytes).
+			uint32 numDataBytes;
+
+			//! @brief		Number of bytes put on the bus, the same as GetNumBusBytesWritten().
+			uint32 numBusBytes;
+
+			//! @brief		Number of transactions that failed at the start condition (e.g. address NACK'ed).
+			uint32 numStartErrors;
+
+			//! @brief		Number of transactions that failed while sending a byte.
+			uint32 numByteErrors;
+
+			//! @brief		Number of transactions that failed at the stop condition.
+			uint32 numStopErrors;
+
+			//! @brief		Number of writes refused because the port was busy with another one.
+			uint32 numBusyErrors;
+
+			//! @brief		Number of flushes (of a dirty frame buffer) that have finished.
+			uint32 numFlushes;
+
+			//! @brief		Total and longest time (in micro-seconds) from starting a flush to the last
+			//!				transaction being sent.
+			uint32 totalFlushTimeUs;
+			uint32 maxFlushTimeUs;
+
+			//! @brief		Number of flushes that took less than #ssd1306STATS_FIRST_BUCKET_US, less than
+			//!				twice that, and so on.
+			uint32 flushTimeHistogram[ssd1306STATS_NUM_FLUSH_BUCKETS];
+		} ssd1306Stats_t;
 
 		//! @brief		Main class for the SSD1306 driver.
+		//! @details	The panel size is fixed at compile time, so buffer sizes and loop bounds are
+		//!				constants, and panels of different sizes can be driven from the same binary.
+		//!				Sizes must be listed in #ssd1306PANEL_SIZES.
+		//!	@tparam		numCols		Width of the panel, in pixels (up to 128).
+		//! @tparam		numRows		Height of the panel, in pixels (16 to 64, multiple of 8).
+		//! @tparam		Transport	Puts the transactions on the bus (see Transport.hpp). Must be listed
+		//!							in #ssd1306TRANSPORTS. The default sends through the Port.
+		template<uint8 numCols, uint8 numRows, class Transport = PortTransport>
 		class Ssd1306
 		{
 			public:
+
+				//===============================================================================================//
+				//====================================== PUBLIC CONSTANTS =======================================//
+				//===============================================================================================//
+
+				//! @brief		Number of columns of the panel.
+				static constexpr uint8 NUM_COLS = numCols;
+
+				//! @brief		Number of rows of the panel.
+				static constexpr uint8 NUM_ROWS = numRows;
+
+				//! @brief		Number of 8-pixel high pages of the panel.
+				static constexpr uint8 NUM_PAGES = numRows/8;
+
+				//! @brief		First SSD1306 column (SEG) the panel is connected to.
+				//! @details	Panels narrower than 128 pixels (e.g. 64x48) are connected to the middle
+				//!				segments, so their columns are offset in GDDRAM.
+				static constexpr uint8 COL_OFFSET = (128 - numCols)/2;
+
+				//! @brief		COM pin configuration used by the init functions (0xDA command).
+				//! @details	Sequential for panels up to 32 rows, alternative for taller ones.
+				static constexpr uint8 COM_PIN_CONFIG = (numRows <= 32) ? 0x02 : 0x12;
+
+				//! @brief		Max. number of extra transactions a flush can be split into by SetMaxTransactionSize().
+				static constexpr uint8 MAX_SPLIT_TRANSACTIONS = (NUM_PAGES*NUM_COLS)/(ssd1306MIN_TRANSACTION_SIZE - 1);
+
+				//! @brief		Max. number of I2C transactions one flush can take. Used by FlushAsync().
+				//! @details	A planned flush can take two transactions for each of
+				//!				TransferPlanner::MAX_TRANSFERS, and long data transactions may be split.
+				static constexpr uint8 MAX_FLUSH_TRANSACTIONS = 4*NUM_PAGES + 2 + MAX_SPLIT_TRANSACTIONS;
+
+				//! @brief		Size (in bytes) of the buffer FlushAsync() copies the transactions of a flush into.
+				//! @details	Enough for every page (control bytes plus all columns), the window or cursor
+				//!				commands for two transfers per page, the addressing mode commands, and a
+				//!				control byte for every split.
+				static constexpr uint16 FLUSH_BUFFER_SIZE = NUM_PAGES*(NUM_COLS + 16) + 16 + MAX_SPLIT_TRANSACTIONS;
+
+				//! @brief		Panel profile used by OledInitVccInt().
+				static constexpr ssd1306PanelProfile_t PROFILE_VCC_INT = PanelProfileVccInt(numRows);
+
+				//! @brief		Panel profile used by OledInitVccExt().
+				static constexpr ssd1306PanelProfile_t PROFILE_VCC_EXT = PanelProfileVccExt(numRows);
+
+				static_assert((numRows % 8) == 0, "Number of rows must be a multiple of 8.");
+				static_assert((numRows >= 16) && (numRows <= 64), "SSD1306 supports 16 to 64 rows.");
+				static_assert((numCols >= 1) && (numCols <= 128), "SSD1306 supports up to 128 columns.");
 			
 				//===============================================================================================//
 				//======================================== PUBLIC TYPEDEFS ======================================//
@@ -70,25 +210,100 @@ namespace MbeddedNinja
 					PAGE_ADDRESSING_MODE 		= 0x02
 				} addressingMode_t;
 			
+				//! @brief		Used as an input to SetFlushMode().
+				typedef enum
+				{
+					//! @brief		Each dirty page is sent separately, using page addressing mode
+					//!				(a start page and start column command per page).
+					FLUSH_MODE_PAGE,
+					//! @brief		One column/page window covering all the dirty pages is programmed using
+					//!				horizontal addressing mode, and then the whole rectangle is streamed in one
+					//!				data transaction. Best for full-screen and multi-page updates.
+					FLUSH_MODE_WINDOW,
+					//! @brief		Only the bytes that really differ from the SSD1306 RAM are sent, with
+					//!				whichever mix of page and window transfers costs the least bus time.
+					//!				Needs a TransferPlanner, see SetTransferPlanner(). Same as #FLUSH_MODE_PAGE
+					//!				without one.
+					FLUSH_MODE_PLANNED
+				} flushMode_t;
+
+				//! @brief		Called when a flush started with FlushAsync() has finished.
+				//! @details	On LINUX this is called from the port's worker thread. The flush counts as
+				//!				in progress (IsBusy() is true, Wait() blocks) until the callback has returned,
+				//!				but the callback itself can start the next flush with FlushAsync().
+				typedef void (*flushCallback_t)(Ssd1306 *ssd1306, void *context);
+			
 				//===============================================================================================//
 				//================================== PUBLIC METHOD DECLARATIONS =================================//
 				//===============================================================================================//
 			
+				//! @brief		Constructor.
+				//! @param		i2cAddress		7-bit I2C address of this SSD1306, e.g. #SSD1306_I2C_ADD_SA0_1
+				//!								for the second panel on a bus.
+				Ssd1306(uint8 i2cAddress = SSD1306_I2C_ADD);
+			
 				//! @brief		Initialises OLED screen with common settings when Vcc supplied internally.
+				//! @details	Enables Vddb and the I2C port, then OledInit() with #PROFILE_VCC_INT.
 				void OledInitVccInt();
 			
 				//! @brief		Initialises OLED screen with common settings when Vcc supplied externally.
+				//! @details	OledInit() with #PROFILE_VCC_EXT.
 				void OledInitVccExt();
+
+				//! @brief		Resets the SSD1306, sets it up with a panel profile, clears the screen and
+				//!				turns the display on.
+				//! @details	The profile is checked, and turned into a command table, at compile time. The
+				//!				table goes out in one command transaction, the cleared RAM in one data
+				//!				transaction, then display on in a third. Leaves the SSD1306 in page
+				//!				addressing mode.
+				//! @tparam		profile		A constexpr ssd1306PanelProfile_t. It's multiplex ratio must be
+				//!							numRows - 1.
+				template<const ssd1306PanelProfile_t &profile>
+				void OledInit();
 			
 				//! @public
 				void EnableI2c();
 
+				//! @brief		Sets the 7-bit I2C address of this SSD1306.
+				//! @details	Two panels can share a bus if their SA0 pins are different, each one with it's
+				//!				own Ssd1306 object. Use a DisplayScheduler to interleave their flushes.
+				//! @public
+				void SetI2cAddress(uint8 i2cAddress);
+
+				//! @brief		Returns the 7-bit I2C address of this SSD1306.
+				//! @public
+				uint8 GetI2cAddress();
+
+				//! @brief		Sets the max. length (in bytes, including the control byte) of the transactions
+				//!				FlushAsync() and StartScheduledFlush() send.
+				//! @details	Longer data transactions are split, which the SSD1306 carries on from where the
+				//!				last one stopped. Shorter transactions let other panels on the same bus have a
+				//!				turn sooner, but each split costs another address and control byte. Defaults to
+				//!				#portASYNC_MAX_TRANSACTION_SIZE, and is limited to #ssd1306MIN_TRANSACTION_SIZE
+				//!				and above. Lowered by DisplayScheduler::AddPanel().
+				//! @public
+				void SetMaxTransactionSize(uint16 maxTransactionSize);
+
+				//! @brief		Returns the max. transaction length set with SetMaxTransactionSize().
+				//! @public
+				uint16 GetMaxTransactionSize();
+
 				//! @brief		Sets the I2C port to use for communication
 				//! @details	Module supports multiple SSD1306 IC communication
 				//!				on one or more I2C port(s)
 				//! @public
 				void SetI2cPort(Port::i2cPort_t i2cPort);
 
+				//! @brief		Returns the port object, for platform-specific configuration
+				//!				(e.g. Port::SetBusNumber() on Linux).
+				//! @public
+				Port& GetPort();
+
+				//! @brief		Returns the transport object, for transport-specific configuration
+				//!				(e.g. SpidevTransport::Open()).
+				//! @public
+				Transport& GetTransport();
+
 				//! @brief		Enables power to the Vddb line.
 				//! @details	P-ch MOSFET controls power to pin.
 				//! @sa			DisableVddb()
@@ -216,13 +431,123 @@ namespace MbeddedNinja
 				void SetInverseDisplay(bool isInverse);
 
 				//! @brief		Full-screen fade in.
+				//! @details	Blocks for about 90ms. Animator::StartFadeIn() does the same without blocking.
 				void FadeIn();
 
 				//! @brief		Full-screen fade out.
+				//! @details	Blocks for about 90ms. Animator::StartFadeOut() does the same without blocking.
 				void FadeOut();
 
+				//! @brief		Sends everything that has been drawn into #frameBuffer since the last flush.
+				//! @details	Only the dirty column range of each dirty page is sent, so small updates
+				//!				(e.g. one digit of a clock) cost a small number of bytes on the bus.
+				//!				All drawing functions below draw into #frameBuffer only, call this to
+				//!				make the changes appear on the screen.
+				//! @public
+				void Flush();
+
+				//! @brief		Starts sending everything that has been drawn into #frameBuffer since the last
+				//!				flush, and returns without waiting for it to be sent.
+				//! @details	The dirty regions (and the commands that go with them) are copied out of
+				//!				#frameBuffer before this returns, so drawing into #frameBuffer while the flush
+				//!				is in progress is safe, the changes just go out on the next flush. Any other
+				//!				call which talks to the SSD1306 waits for the flush to finish first.
+				//!				On PSOC and EMULATOR, ServiceFlush() has to be called to move the flush along.
+				//! @param		callback	Called once the flush has finished. Can be NULL.
+				//! @param		context		Passed to the callback.
+				//! @returns	False if the previous flush is still in progress (nothing is started,
+				//!				the dirty regions stay dirty), otherwise true.
+				//! @public
+				bool FlushAsync(flushCallback_t callback = NULL, void *context = NULL);
+
+				//! @brief		Returns true while a flush started with FlushAsync() is in progress.
+				//! @public
+				bool IsBusy();
+
+				//! @brief		Blocks until the flush started with FlushAsync() has finished.
+				//! @public
+				void Wait();
+
+				//! @brief		Moves a flush started with FlushAsync() on to the next transaction, once the
+				//!				current one is complete.
+				//! @details	Call from the main loop, a timer or the I2C interrupt on PSOC, and on
+				//!				EMULATOR. Not needed on LINUX, where a worker thread sends the flush.
+				//! @public
+				void ServiceFlush();
+
+				//! @brief		Collects the transactions of a flush like FlushAsync(), but leaves sending them
+				//!				to the caller.
+				//! @details	Used by DisplayScheduler, which sends them one at a time with
+				//!				SendNextTransaction(), so they can be interleaved with other panels on the
+				//!				same bus. Nothing else may write to the SSD1306 until they have all been sent.
+				//! @returns	False if the transactions of the last scheduled flush (or a flush started
+				//!				with FlushAsync()) haven't all been sent yet, otherwise true.
+				//! @public
+				bool StartScheduledFlush();
+
+				//! @brief		Returns the number of bytes (including any address byte) the next transaction
+				//!				of a scheduled flush puts on the bus, or 0 if they have all been sent.
+				//! @public
+				uint16 GetNextTransactionSize();
+
+				//! @brief		Sends the next transaction of a scheduled flush, blocking until it has been sent.
+				//! @returns	A Port::transferResult_t.
+				//! @public
+				uint8 SendNextTransaction();
+
+				//! @brief		Copies the newest frame published to a mailbox into #frameBuffer.
+				//! @details	For when one thread renders frames (into FrameMailbox::GetBackBuffer()) and
+				//!				another sends them. Call from the sending side, followed by Flush() or FlushAsync().
+				//!				The frame is compared against #frameBuffer as it is copied, so only the parts
+				//!				that changed since the last frame are sent. Stale frames the renderer published
+				//!				in between are skipped.
+				//! @returns	False if no frame has been published since the last call.
+				//! @public
+				bool LoadFrame(FrameMailbox<numCols, numRows> &mailbox);
+
+				//! @brief		Sets how Flush() sends the dirty regions to the SSD1306.
+				//! @details	Defaults to #FLUSH_MODE_PAGE. Flush() switches the SSD1306 addressing mode
+				//!				as needed for the chosen flush mode.
+				//! @public
+				void SetFlushMode(flushMode_t flushMode);
+
+				//! @brief		Sets the planner used by #FLUSH_MODE_PLANNED.
+				//! @details	The planner's copy of the SSD1306 RAM is marked as unknown, so the next planned
+				//!				flush sends every dirty byte. Pass NULL to stop using it.
+				//! @public
+				void SetTransferPlanner(TransferPlanner<numCols, numRows> *planner);
+
+				//! @brief		Returns the number of bytes written to the bus so far.
+				//! @details	Counts the address and control byte of every transaction as well as the
+				//!				payload (just the payload on SPI), the same as Ssd1306Emulator. Used for the
+				//!				planner stats.
+				//! @public
+				uint32 GetNumBusBytesWritten();
+
+				//! @brief		Copies all of the counters into stats.
+				//! @details	The copy is consistent even if a background flush finishes part way through.
+				//!				Must not be called from an interrupt. Only counts when #configSSD1306_STATS is 1.
+				//! @returns	False (and stats is zeroed) if the counters are compiled out.
+				//! @public
+				bool GetStats(ssd1306Stats_t &stats);
+
+				//! @brief		Sets all the counters returned by GetStats() back to 0.
+				//! @details	Can be called from any thread, even while a FlushAsync() or DisplayScheduler
+				//!				flush is counting in the background, as the counters are only changed by
+				//!				one thread at a time. Like GetStats(), must not be called from an interrupt.
+				//! @public
+				void ClearStats();
+
+				//! @brief		Records every transaction sent from now on into a trace.
+				//! @details	See BusTrace. Transactions of FlushAsync() are all recorded when it is called.
+				//!				Pass NULL to stop recording.
+				//! @public
+				void SetBusTrace(BusTrace *trace);
+
 				//! @brief		Shows a pattern (either partial or full screen)
-				//! @details	Requires pixel array to already be formulated and passed into the function
+				//! @details	Requires pixel array to already be formulated and passed into the function.
+				//!				The pattern is clipped to the screen size. Drawn into #frameBuffer, call Flush()
+				//!				to send.
 				//! @param		pixelArray 	Monochromatic pixel array to draw on screen
 				//! @param		startPage 	Page to start on
 				//! @param		endPage 	Page to end on
@@ -237,6 +562,7 @@ namespace MbeddedNinja
 					uint8 totalCol);
 
 				//! @brief		Fills the RAM with a single byte.
+				//! @details	Drawn into #frameBuffer, call Flush() to send.
 				//! @param 		byteToFillRamWith Single byte to fill RAM with.
 				//! @public
 				void FillRam(unsigned char byteToFillRamWith);
@@ -245,7 +571,8 @@ namespace MbeddedNinja
 				void Checkerboard();
 
 				//! @brief		Shows a full-screen 1-pixel wide frame (border).
-				//! @details	The border is 1 pixel wide and draw right on the edge of the screen.
+				//! @details	The border is 1 pixel wide and draw right on the edge of the screen. Same as
+				//!				frameBuffer.DrawRect() over the whole screen, the rest of the screen is left as is.
 				void DrawFrame();
 
 				void ContinuousScroll(
@@ -266,7 +593,6 @@ namespace MbeddedNinja
 				//! @param		endPage 		Define end page address.
 				//! @param		timeInterval	Set time interval between each scroll step in terms of frame frequency.
 				//! @param		delayTime		Delay time
-				//! @note 		Currently not working correctly.
 				void HorizontalScroll(
 					unsigned char scrollDir,
 					unsigned char startPage,
@@ -274,6 +600,8 @@ namespace MbeddedNinja
 					unsigned char timeInterval,
 					unsigned char delayTime);
 					
+				//! @brief		Scrolls the whole screen once through the vertical scroll area, by moving the start line.
+				//! @details	Blocks while it scrolls. Animator::StartScroll() does the same without blocking.
 				void VerticalScroll(
 					unsigned char a,
 					unsigned char b,
@@ -284,10 +612,33 @@ namespace MbeddedNinja
 				//! @brief		Deactivates scrolling which has been started with ContinuousScroll() or HorizontalScroll().
 				void DeactivateScroll();
 
+				//! @brief		Starts a command batch.
+				//! @details	Until the matching EndCommandBatch(), commands are collected in the command queue
+				//!				rather than being sent one transaction at a time. Batches can be nested, the
+				//!				queue is committed when the outermost batch ends. Any data write commits the
+				//!				queue first, so commands and data always reach the SSD1306 in order.
+				//! @sa			EndCommandBatch(), CommitCommands()
+				//! @public
+				void BeginCommandBatch();
+
+				//! @brief		Ends a command batch started with BeginCommandBatch().
+				//! @details	Commits the queued commands if this is the outermost batch.
+				//! @public
+				void EndCommandBatch();
+
+				//! @brief		Sends any queued commands to the SSD1306 as one I2C transaction.
+				//! @public
+				void CommitCommands();
+
+				//! @brief		Returns the number of I2C transactions saved by coalescing commands.
+				//! @details	Each write of a command (or command array) would otherwise be its own transaction.
+				//! @public
+				uint32 GetNumCmdTransactionsSaved();
+
 				#if(ssd1306ENABLE_FONTS == 1)
-					//! @brief		Displays a character from one of the two font databases.
-					//! @param		fontArraySel	The font database to use (valid range 1-2).
-					//! @param		asciiChar		The ascii character to display.
+					//! @brief		Displays a character from one of the two built-in fonts.
+					//! @param		fontArraySel	The font to use (valid range 1-2), see ShowString().
+					//! @param		asciiChar		The character to display.
 					//! @param		startPage		The start page to display the character.
 					//! @param		startCol		The start column to display the character.
 					//! @note		Only defined if #ssd1306ENABLE_FONTS == 1
@@ -297,16 +648,20 @@ namespace MbeddedNinja
 						unsigned char startPage,
 						unsigned char startCol);
 
-					//! @brief		Displays a message on the screen, using the internal font database to convert
-					//!				the string to pixels.
-					//! @param		databaseNum		The font database to select from. Valid range is 1-2.
+					//! @brief		Displays a message on the screen in one of the two built-in 5x7 fonts.
+					//! @details	Same as frameBuffer.DrawString(), with fontFixed5x7 or fontSymbols5x7.
+					//!				Use frameBuffer.DrawString() directly for any other font.
+					//! @param		databaseNum		The font to use. Valid range is 1-2.
+					//!								1 is fontFixed5x7, msg is ASCII/Latin-1. 2 is fontSymbols5x7
+					//!								(Greek and Katakana), each character is the entry number
+					//!								in the font (starting at 1).
 					//! @param		*msg			Pointer to an array of characters to print.
 					//! @param		startPage		The screen page to start at.
 					//!	@param		startCol		The screen columnh to start at.
 					//! @note		Only defined if (#ssd1306ENABLE_FONTS == 1).
 					void ShowString(
 						uint8_t databaseNum,
-						char *msg,
+						const char *msg,
 						uint8_t startPage,
 						uint8_t startCol);
 				#endif
@@ -315,12 +670,102 @@ namespace MbeddedNinja
 			//====================================== PUBLIC VARIABLES =======================================//
 			//===============================================================================================//
 
-			// none
+				//! @brief		Local copy of the SSD1306 RAM, which all drawing functions draw into.
+				//! @details	Can also be written to directly, changes are sent on the next call to Flush().
+				FrameBuffer<numCols, numRows> frameBuffer;
 
 			private:
 			
 				//! @brief		Object contains all port-specific functions/variables.
 				Port port;
+
+				//! @brief		Puts the transactions on the bus.
+				Transport transport;
+
+				//! @brief		7-bit I2C address of this SSD1306.
+				uint8 i2cAddress;
+
+				//! @brief		Max. length of a captured transaction, see SetMaxTransactionSize().
+				uint16 maxTransactionSize;
+
+				//! @brief		The addressing mode the SSD1306 is currently in. Updated by SetAddressingMode().
+				addressingMode_t addressingMode;
+
+				//! @brief		The flush mode used by Flush().
+				flushMode_t flushMode;
+
+				//! @brief		Planner used by #FLUSH_MODE_PLANNED, NULL if there isn't one.
+				TransferPlanner<numCols, numRows> *planner;
+
+				//! @brief		Running total of bytes written to the bus, see GetNumBusBytesWritten().
+				uint32 numBusBytesWritten;
+
+				//! @brief		Trace every transaction is recorded into, NULL if there isn't one.
+				BusTrace *trace;
+
+				//! @brief		Commands waiting to be sent. See BeginCommandBatch().
+				uint8 cmdQueue[ssd1306CMD_QUEUE_SIZE];
+
+				//! @brief		Number of bytes in #cmdQueue.
+				uint8 cmdQueueLength;
+
+				//! @brief		Number of command writes that have been collected in #cmdQueue.
+				uint8 cmdQueueNumWrites;
+
+				//! @brief		Nesting depth of command batches. Commands are sent straight away when 0.
+				uint8 cmdBatchDepth;
+
+				//! @brief		Running total of I2C transactions saved by coalescing commands.
+				uint32 numCmdTransactionsSaved;
+
+				//! @brief		Transactions of the flush started with FlushAsync(), each one starting with it's
+				//!				control byte.
+				uint8 flushBuffer[FLUSH_BUFFER_SIZE];
+
+				//! @brief		Number of bytes used in #flushBuffer.
+				uint16 flushBufferLength;
+
+				//! @brief		Where each transaction in #flushBuffer starts, and it's length.
+				Port::ioVector_t flushTransactions[MAX_FLUSH_TRANSACTIONS];
+
+				//! @brief		Number of transactions in #flushTransactions.
+				uint8 numFlushTransactions;
+
+				//! @brief		Number of transactions of a scheduled flush sent with SendNextTransaction().
+				uint8 numFlushTransactionsSent;
+
+				//! @brief		True while FlushAsync() is collecting transactions into #flushBuffer
+				//!				rather than sending them.
+				bool isCapturingFlush;
+
+				//! @brief		Callback passed to FlushAsync(), and it's context.
+				flushCallback_t flushCallback;
+				void *flushCallbackContext;
+
+				//! @brief		Called by the port once the transactions of FlushAsync() have been sent.
+				static void FlushAsyncComplete(void *context, uint8 result);
+
+				//! @brief		Does the work of OledInit() once the profile has been turned into a table.
+				void SendInitTable(const ssd1306InitTable_t &initTable);
+
+				//! @brief		Sends the dirty regions one page at a time, using page addressing mode.
+				void FlushPages();
+
+				//! @brief		Sends the dirty regions as one window, using horizontal addressing mode.
+				void FlushWindow();
+
+				//! @brief		Changes to page addressing mode, and resets the column window.
+				void EnterPageAddressingMode();
+
+				//! @brief		Sends the transfers worked out by #planner.
+				void FlushPlanned();
+
+				//! @brief		Sends (or captures, see FlushAsync()) the dirty regions using the current flush mode.
+				void FlushDirty();
+
+				//! @brief		Collects the transactions for the dirty regions in #flushBuffer, and marks the
+				//!				frame buffer as clean.
+				void CaptureFlush();
 		
 				void Sleep(unsigned char a);
 
@@ -345,25 +790,99 @@ namespace MbeddedNinja
 				//! @param		startPage 	Start page.
 				//! @param 		endPage 	End page.
 				//! @param  	startCol	Start column.
-				//! @param		numCols		Total Columns
+				//! @param		totalCol	Total Columns
 				void FillBlock(
 					unsigned char byteToFillRamWith,
 					unsigned char startPage,
 					unsigned char endPage,
 					unsigned char startCol,
-					unsigned char numCols);
+					unsigned char totalCol);
 
 				//! @brief 		Writes a single command to the SSD1306 chip over the I2C.
-				//! @todo		Remove.
+				//! @details	Goes through the command queue, see WriteCommandArray().
 				void WriteCommand(unsigned char cmd);
 
-				void WriteCommandArray(uint8 *commandArray, uint8 numCommands);
+				//! @brief		Writes an array of commands to the SSD1306 chip.
+				//! @details	The commands are added to the command queue, and sent straight away unless
+				//!				a command batch is open.
+				void WriteCommandArray(const uint8 *commandArray, uint8 numCommands);
 				
 				//! @brief		Writes data to the SSD1306 chip over I2C.
 				//! @details	Uses data stored in buffer.
 				void WriteData(uint8 cmd);
+
+				//! @brief		Writes an array of data bytes to the SSD1306 chip in one I2C transaction.
+				void WriteDataArray(const uint8 *dataArray, uint16 numBytes);
+
+				//! @brief		Writes data gathered from several blocks of memory to the SSD1306 chip in one I2C transaction.
+				void WriteDataVectored(const Port::ioVector_t *vectors, uint8 numVectors);
+
+				//! @brief		Writes one transaction (control byte followed by the vectors) to the SSD1306.
+				//! @details	Every write to the SSD1306 goes through here. Waits for any flush started with
+				//!				FlushAsync() to finish first, or adds the transaction to #flushBuffer if called
+				//!				from FlushAsync().
+				void WriteTransaction(uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors);
+
+				//! @brief		Copies a transaction into #flushBuffer, splitting it if it is longer
+				//!				than #portASYNC_MAX_TRANSACTION_SIZE.
+				void CaptureTransaction(uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors);
+
+				//! @brief		Prints a debug message (and counts the error) if an I2C transaction failed.
+				//! @param		result	A Port::transferResult_t, as returned by the port write functions.
+				void ReportTransferResult(uint8 result);
+
+				#if(configSSD1306_STATS == 1)
+					//! @brief		The counters, see GetStats().
+					ssd1306Stats_t stats;
+
+					//! @brief		Bumped before and after every change to #stats, so it is odd while
+					//!				they are being changed. Lets GetStats() spot a torn copy.
+					volatile uint32 statsSequence;
+
+					//! @brief		Held while #stats are being changed, see Port::EnterCritical().
+					volatile uint8 statsLock;
+
+					//! @brief		Returned by Port::EnterCritical() when #statsLock was taken.
+					uint8 statsInterruptState;
+
+					//! @brief		#numBusBytesWritten when ClearStats() was called.
+					uint32 statsBusBytesAtClear;
+
+					//! @brief		Port::GetTimeUs() when the current flush started.
+					uint32 flushStartTimeUs;
+
+					//! @brief		Takes #statsLock and marks the start of a change to #stats.
+					void BeginStatsUpdate();
+
+					//! @brief		Marks the end of a change to #stats and releases #statsLock.
+					void EndStatsUpdate();
+
+					//! @brief		Counts one transaction about to be sent.
+					void CountTransaction(uint8 controlByte, uint32 numPayloadBytes);
+
+					//! @brief		Counts a finished flush, timed from #flushStartTimeUs.
+					void CountFlush();
+				#endif
 		};
 
+		//===============================================================================================//
+		//================================== TEMPLATE METHOD DEFINITIONS ================================//
+		//===============================================================================================//
+
+		// Defined here rather than in SSD1306.cpp, as the profile comes from the application
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		template<const ssd1306PanelProfile_t &profile>
+		void Ssd1306<numCols, numRows, Transport>::OledInit()
+		{
+			static_assert(PanelProfileIsValid(profile), "Panel profile has a setting the SSD1306 doesn't accept.");
+			static_assert(profile.multiplexRatio == numRows - 1, "Panel profile multiplex ratio must be numRows - 1.");
+
+			static constexpr ssd1306InitTable_t initTable = PanelProfileGetInitTable(profile);
+
+			SendInitTable(initTable);
+		}
+
 	} // namespace MSsd1306
 } // namespace MbeddedNinja
 
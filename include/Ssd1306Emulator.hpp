@@ -0,0 +1,224 @@
+//!
+//! @file 				Ssd1306Emulator.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Software model of the SSD1306, which decodes the I2C command/data stream.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_SSD1306_EMULATOR_H
+#define M_SSD1306_SSD1306_EMULATOR_H
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC DEFINES ========================================//
+		//===============================================================================================//
+
+		//! @brief		Number of columns in the SSD1306 GDDRAM.
+		#define ssd1306EmuRAM_COLS			128
+
+		//! @brief		Number of pages in the SSD1306 GDDRAM.
+		#define ssd1306EmuRAM_PAGES			8
+
+		//! @brief		Max. number of parameter bytes any SSD1306 command takes.
+		#define ssd1306EmuMAX_CMD_PARAMS	6
+
+		//===============================================================================================//
+		//=========================================== CLASS =============================================//
+		//===============================================================================================//
+
+		//! @brief		A virtual SSD1306.
+		//! @details	Is fed the bytes of each I2C or SPI transaction (by Port, when MCU_PLATFORM == EMULATOR),
+		//!				parses the control bytes (or follows the D/C# pin on SPI), executes the commands and
+		//!				writes data into a simulated GDDRAM, following the addressing rules in the datasheet.
+		//!				Also counts every byte and transaction on the bus, so the cost of driver calls can be
+		//!				measured exactly.
+		class Ssd1306Emulator
+		{
+			public:
+
+				//===============================================================================================//
+				//======================================== PUBLIC TYPEDEFS ======================================//
+				//===============================================================================================//
+
+				//! @brief		Bus traffic counters. See GetStats().
+				typedef struct
+				{
+					//! @brief		Number of transactions (start to stop) addressed to this device.
+					uint32 numTransactions;
+					//! @brief		Total bytes on the bus, including the address byte of each transaction.
+					uint32 numBusBytes;
+					//! @brief		Number of control bytes received.
+					uint32 numControlBytes;
+					//! @brief		Number of command bytes (including parameters) received.
+					uint32 numCommandBytes;
+					//! @brief		Number of display data bytes received.
+					uint32 numDataBytes;
+					//! @brief		Number of command bytes that were not recognised.
+					uint32 numUnknownCommands;
+				} stats_t;
+
+				//===============================================================================================//
+				//================================== PUBLIC METHOD DECLARATIONS =================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor.
+				//! @param		i2cAddress	7-bit I2C address the device responds to (0x3C or 0x3D).
+				Ssd1306Emulator(uint8 i2cAddress = 0x3C);
+
+				//! @brief		Puts all registers back to their reset values. GDDRAM is not cleared, like the real chip.
+				void Reset();
+
+				//! @brief		Returns the 7-bit I2C address of the device.
+				uint8 GetI2cAddress() const;
+
+				//! @brief		Start condition, addressed to this device.
+				void Start();
+
+				//! @brief		One byte of a transaction, after the address byte.
+				void WriteByte(uint8 byte);
+
+				//! @brief		Several bytes of a transaction, the same as calling WriteByte() for each one.
+				void WriteBytes(const uint8 *bytes, uint16 numBytes);
+
+				//! @brief		Stop condition.
+				void Stop();
+
+				//! @brief		CS# pulled low, at the start of an SPI transaction.
+				//! @details	There is no address or control byte on SPI, so this just counts the transaction.
+				void Select();
+
+				//! @brief		Sets the D/C# pin, which says whether SPI bytes are data (true) or commands.
+				void SetDcPin(bool isData);
+
+				//! @brief		One byte of an SPI transaction.
+				void WriteSpiByte(uint8 byte);
+
+				//! @brief		Returns a byte of the simulated GDDRAM.
+				uint8 GetRamByte(uint8 page, uint8 col) const;
+
+				//! @brief		Returns the state of a pixel as seen on the panel.
+				//! @details	seg and com are the physical SEG/COM outputs of the SSD1306. Takes the display
+				//!				on/off, entire display on, inverse, segment remap, COM scan direction, multiplex
+				//!				ratio, display offset and display start line into account. Scrolling and the
+				//!				alternative COM pin configuration are not modelled.
+				bool GetPixel(uint8 seg, uint8 com) const;
+
+				//! @brief		Returns the bus traffic counters.
+				const stats_t& GetStats() const;
+
+				//! @brief		Sets all bus traffic counters back to 0.
+				void ClearStats();
+
+				//===============================================================================================//
+				//====================================== PUBLIC VARIABLES =======================================//
+				//===============================================================================================//
+
+				// Register state, readable so tests can check what the driver has set.
+
+				//! @brief		Addressing mode (0 = horizontal, 1 = vertical, 2 = page).
+				uint8 addressingMode;
+				//! @brief		Column window, set with command 0x21.
+				uint8 colStart, colEnd;
+				//! @brief		Page window, set with command 0x22.
+				uint8 pageStart, pageEnd;
+				//! @brief		Current column and page address pointers.
+				uint8 col, page;
+				//! @brief		Display start line (0-63).
+				uint8 startLine;
+				//! @brief		Display offset (0-63).
+				uint8 displayOffset;
+				//! @brief		Multiplex ratio register. Number of COM lines used is this + 1.
+				uint8 multiplexRatio;
+				//! @brief		Contrast (0x00-0xFF).
+				uint8 contrast;
+				//! @brief		Raw values of other single parameter registers.
+				uint8 clockDivide, prechargePeriod, vcomhLevel, comPinConfig, chargePump;
+				//! @brief		True if column address 0 is mapped to SEG127 (0xA1).
+				bool isSegmentRemapped;
+				//! @brief		True if COM outputs are scanned from COM[N-1] to COM0 (0xC8).
+				bool isComScanReversed;
+				//! @brief		True if display is inverted (0xA7).
+				bool isInverse;
+				//! @brief		True if every pixel is forced on (0xA5).
+				bool isEntireDisplayOn;
+				//! @brief		True if display is on (0xAF).
+				bool isDisplayOn;
+				//! @brief		True if scrolling is active (0x2F).
+				bool isScrollActive;
+				//! @brief		Parameters of the last scroll setup command (0x26/0x27/0x29/0x2A), and the command itself.
+				uint8 scrollCommand;
+				uint8 scrollParams[ssd1306EmuMAX_CMD_PARAMS];
+				//! @brief		Vertical scroll area, set with command 0xA3.
+				uint8 verticalScrollTopFixed, verticalScrollRows;
+
+			private:
+
+				//! @brief		Where the parser is within a transaction.
+				typedef enum
+				{
+					//! @brief		Waiting for the first byte after the address.
+					STATE_CONTROL_BYTE,
+					//! @brief		Co = 1, next byte is a single command/data byte, then another control byte.
+					STATE_SINGLE_BYTE,
+					//! @brief		Co = 0, the rest of the transaction is a stream of command/data bytes.
+					STATE_STREAM
+				} parseState_t;
+
+				//! @brief		Handles one command byte (opcode or parameter).
+				void ProcessCommandByte(uint8 byte);
+
+				//! @brief		Runs a command once all of its parameters have arrived.
+				void ExecuteCommand();
+
+				//! @brief		Writes one byte of display data to GDDRAM and advances the address pointers.
+				void ProcessDataByte(uint8 byte);
+
+				//! @brief		Returns the number of parameter bytes that follow an opcode.
+				static uint8 GetNumParams(uint8 opcode);
+
+				//! @brief		The simulated GDDRAM.
+				uint8 gddram[ssd1306EmuRAM_PAGES][ssd1306EmuRAM_COLS];
+
+				//! @brief		7-bit I2C address.
+				uint8 i2cAddress;
+
+				//! @brief		Bus traffic counters.
+				stats_t stats;
+
+				//! @brief		Parser state within the current transaction.
+				parseState_t parseState;
+
+				//! @brief		True if the bytes following the control byte (or the D/C# pin on SPI) are data (D/C# = 1).
+				bool isData;
+
+				//! @brief		Opcode of the command currently being received.
+				uint8 cmdOpcode;
+
+				//! @brief		Parameters received so far for the current command.
+				uint8 cmdParams[ssd1306EmuMAX_CMD_PARAMS];
+
+				//! @brief		Number of parameters received so far, and number expected.
+				uint8 numCmdParams, numCmdParamsExpected;
+
+				//! @brief		True if cmdOpcode is waiting for parameters.
+				bool isCmdPending;
+		};
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_SSD1306_EMULATOR_H
+
+// EOF
@@ -0,0 +1,208 @@
+//!
+//! @file 				TransferPlanner.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Works out the cheapest set of transfers to bring the SSD1306 RAM up to date.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_TRANSFER_PLANNER_H
+#define M_SSD1306_TRANSFER_PLANNER_H
+
+#include "Port.hpp"
+#include "FrameBuffer.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC TYPEDEFS =======================================//
+		//===============================================================================================//
+
+		//! @brief		Bus time of the parts of a transfer that don't depend on its length.
+		//! @details	In byte times (the time it takes to send one byte), so they can be compared with
+		//!				the number of data bytes a plan sends. Each byte of a transaction costs one byte
+		//!				time on top of these.
+		typedef struct
+		{
+			//! @brief		Fixed cost of a command transaction (e.g. moving the cursor), not counting
+			//!				the command bytes.
+			uint8 commandOverhead;
+
+			//! @brief		Fixed cost of a data transaction, not counting the data bytes.
+			uint8 dataOverhead;
+		} transferCostModel_t;
+
+		//! @brief		One transfer of a plan: a window of pages and columns, sent in one data transaction.
+		typedef struct
+		{
+			uint8 startPage;
+			uint8 endPage;
+			uint8 startCol;
+			uint8 endCol;
+		} transferWindow_t;
+
+		//! @brief		Totals over all planned flushes, see TransferPlanner::GetStats().
+		typedef struct
+		{
+			//! @brief		Number of flushes planned.
+			uint32 numFlushes;
+
+			//! @brief		Bytes the same flushes would have taken with FLUSH_MODE_PAGE (one transfer
+			//!				per dirty page range).
+			uint32 numBaselineBytes;
+
+			//! @brief		Bytes the plans were expected to take.
+			uint32 numExpectedBytes;
+
+			//! @brief		Bytes that were actually written to the bus.
+			uint32 numActualBytes;
+		} transferPlannerStats_t;
+
+		//===============================================================================================//
+		//=========================================== CLASS =============================================//
+		//===============================================================================================//
+
+		//! @brief		Plans the transfers for Ssd1306::FLUSH_MODE_PLANNED.
+		//! @details	Keeps a shadow copy of what is in the SSD1306 RAM, so it knows exactly which
+		//!				bytes in the dirty ranges of the frame buffer have really changed. It then picks
+		//!				between:
+		//!				- One transfer per run of changed bytes in page addressing mode. Runs on the same
+		//!				  page are joined if sending the bytes in between is cheaper than a new cursor setup.
+		//!				- Column/page windows in horizontal addressing mode. Each group of neighbouring
+		//!				  pages is either sent as one window or as one single-page window per run,
+		//!				  whichever is cheaper.
+		//!				The costs come from a transferCostModel_t, which defaults to what suits the
+		//!				current port (see #portTRANSACTION_OVERHEAD) and can be tuned with SetCostModel().
+		//!
+		//!				Costs NUM_PAGES*NUM_COLS bytes of RAM for the shadow, so it is optional. Pass it
+		//!				to Ssd1306::SetTransferPlanner() to use it.
+		//!	@tparam		numCols		Width of the display, in pixels.
+		//! @tparam		numRows		Height of the display, in pixels.
+		template<uint8 numCols, uint8 numRows>
+		class TransferPlanner
+		{
+			public:
+
+				//! @brief		Number of columns.
+				static constexpr uint8 NUM_COLS = numCols;
+
+				//! @brief		Number of 8-pixel high pages.
+				static constexpr uint8 NUM_PAGES = numRows/8;
+
+				//! @brief		Max. number of transfers in one plan.
+				//! @details	Runs are joined more eagerly if there would be more than this.
+				static constexpr uint8 MAX_TRANSFERS = 2*NUM_PAGES;
+
+				//! @brief		Command bytes to move the cursor in page addressing mode (page, column low/high).
+				static constexpr uint8 PAGE_CURSOR_BYTES = 3;
+
+				//! @brief		Command bytes to set a window in horizontal addressing mode (0x21 a b 0x22 c d).
+				static constexpr uint8 WINDOW_CURSOR_BYTES = 6;
+
+				//! @brief		Command bytes to change to horizontal addressing mode.
+				static constexpr uint8 WINDOW_MODE_SWITCH_BYTES = 2;
+
+				//! @brief		Command bytes to change to page addressing mode.
+				//! @details	The column window is reset as well, page addressing mode wraps at the end of it.
+				static constexpr uint8 PAGE_MODE_SWITCH_BYTES = 5;
+
+				//! @brief		Bytes every transaction takes on top of its payload (address and control byte).
+				static constexpr uint8 TRANSACTION_BYTES = 2;
+
+				//! @brief		Constructor.
+				//! @details	The shadow starts off invalid, so the first plan sends every dirty byte.
+				TransferPlanner();
+
+				//! @brief		Sets the costs used to compare plans.
+				void SetCostModel(const transferCostModel_t &costModel);
+
+				//! @brief		Returns the costs used to compare plans.
+				const transferCostModel_t& GetCostModel() const;
+
+				//! @brief		Works out the transfers for the dirty parts of a frame buffer.
+				//! @param		isWindowModeNow		True if the SSD1306 is in horizontal addressing mode.
+				//! @returns	The number of transfers (0 if nothing has really changed).
+				uint8 Plan(const FrameBuffer<numCols, numRows> &frame, bool isWindowModeNow);
+
+				//! @brief		Returns true if the last plan uses windows in horizontal addressing mode,
+				//!				false if it uses page addressing mode.
+				bool IsWindowPlan() const;
+
+				//! @brief		Returns the transfers of the last plan.
+				const transferWindow_t* GetTransfers() const;
+
+				//! @brief		Returns the number of bytes the last plan is expected to take on the bus.
+				uint32 GetExpectedBytes() const;
+
+				//! @brief		Records that the last plan has been sent, and updates the shadow.
+				//! @param		numActualBytes	Bytes that were actually written while sending it.
+				void Commit(const FrameBuffer<numCols, numRows> &frame, uint32 numActualBytes);
+
+				//! @brief		Updates the shadow after the frame buffer was flushed some other way.
+				void Sync(const FrameBuffer<numCols, numRows> &frame);
+
+				//! @brief		Marks the shadow as unknown, so the next plan sends every dirty byte.
+				void Invalidate();
+
+				//! @brief		Returns the totals over all planned flushes since the last ClearStats().
+				//! @details	Expected saving is numBaselineBytes - numExpectedBytes, actual saving is
+				//!				numBaselineBytes - numActualBytes.
+				transferPlannerStats_t GetStats() const;
+
+				//! @brief		Resets the totals returned by GetStats().
+				void ClearStats();
+
+			private:
+
+				//! @brief		Finds the runs of changed bytes in the dirty range of one page.
+				//! @details	Runs separated by no more than maxGap unchanged bytes are joined.
+				//! @param		runs		Filled with the runs (as single-page windows) if not NULL.
+				//! @param		numBytes	Incremented by the number of bytes in the runs.
+				//! @returns	The number of runs.
+				uint8 FindRuns(const FrameBuffer<numCols, numRows> &frame, uint8 page, uint16 maxGap,
+					transferWindow_t *runs, uint16 *numBytes) const;
+
+				//! @brief		Returns the smallest gap that stops the runs of the whole frame going
+				//!				over #MAX_TRANSFERS, starting from the cheapest gap for the given cursor cost.
+				uint16 FindMaxGap(const FrameBuffer<numCols, numRows> &frame, uint8 cursorBytes) const;
+
+				//! @brief		Returns true if the byte is different in the frame and the shadow.
+				bool IsChanged(const FrameBuffer<numCols, numRows> &frame, uint8 page, uint8 col) const;
+
+				//! @brief		What the SSD1306 RAM holds, as far as we know.
+				uint8 shadow[NUM_PAGES][NUM_COLS];
+
+				//! @brief		False until the shadow has been synced with a frame buffer.
+				bool isShadowValid;
+
+				//! @brief		FrameBuffer::GetInvalidateCount() when the shadow was last synced.
+				uint8 frameInvalidateCount;
+
+				transferCostModel_t costModel;
+
+				//! @brief		The last plan.
+				transferWindow_t transfers[MAX_TRANSFERS];
+				uint8 numTransfers;
+				bool isWindowPlan;
+				uint32 expectedBytes;
+				uint32 baselineBytes;
+
+				transferPlannerStats_t stats;
+		};
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_TRANSFER_PLANNER_H
+
+// EOF
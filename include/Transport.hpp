@@ -0,0 +1,729 @@
+//!
+//! @file 				Transport.hpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Transport policies, which put the bytes of each transaction on the bus.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//======================================= HEADER GAURD ==========================================//
+//===============================================================================================//
+
+// Header guard
+#ifndef M_SSD1306_TRANSPORT_H
+#define M_SSD1306_TRANSPORT_H
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+#include "Port.hpp"
+#include "Bus.hpp"
+
+#if(MCU_PLATFORM == EMULATOR)
+	// User includes
+	#include "Ssd1306Emulator.hpp"
+#endif
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		// The port layer lives in it's own namespace
+		using SSD1306Ns::Port;
+		#if(MCU_PLATFORM == PSOC)
+			using SSD1306Ns::BusPsocI2cWrite;
+		#elif(MCU_PLATFORM == LINUX)
+			using SSD1306Ns::BusI2cDevWrite;
+			using SSD1306Ns::BusSpidevOpen;
+			using SSD1306Ns::BusSpidevWrite;
+			using SSD1306Ns::BusGpioRequestOutput;
+			using SSD1306Ns::BusGpioSetLine;
+		#endif
+
+		//===============================================================================================//
+		//======================================= PUBLIC DEFINES ========================================//
+		//===============================================================================================//
+
+		//! @brief		Transports that Ssd1306 is compiled for, for each of the #ssd1306PANEL_SIZES.
+		//! @details	Like the panel sizes, the code lives in the .cpp files, so Ssd1306 is explicitly
+		//!				instantiated for each transport in this list. Add to it (or define it in your
+		//!				compiler settings) to use your own transport.
+		#ifndef ssd1306TRANSPORTS
+			#if(MCU_PLATFORM == PSOC)
+				#define ssd1306TRANSPORTS(X, numCols, numRows) \
+					X(numCols, numRows, PortTransport) \
+					X(numCols, numRows, NullTransport) \
+					X(numCols, numRows, PsocI2cTransport<Port::i2cLeft>) \
+					X(numCols, numRows, PsocI2cTransport<Port::i2cRight>)
+			#elif(MCU_PLATFORM == LINUX)
+				#define ssd1306TRANSPORTS(X, numCols, numRows) \
+					X(numCols, numRows, PortTransport) \
+					X(numCols, numRows, NullTransport) \
+					X(numCols, numRows, LinuxI2cTransport) \
+					X(numCols, numRows, SpidevTransport)
+			#else
+				#define ssd1306TRANSPORTS(X, numCols, numRows) \
+					X(numCols, numRows, PortTransport) \
+					X(numCols, numRows, NullTransport) \
+					X(numCols, numRows, EmulatorTransport)
+			#endif
+		#endif
+
+		//===============================================================================================//
+		//=========================================== CLASSES ===========================================//
+		//===============================================================================================//
+
+		// A transport is passed to Ssd1306 as a template parameter, so the write path is picked at
+		// compile time and it's inner loops can be inlined. Every transport has these functions:
+		//
+		//		void Start(Port &port);
+		//		uint8 GetOverheadBytes(Port &port);
+		//		uint8 Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors);
+		//		uint8 StartWrite(Port &port, uint8 slaveAddress, const Port::ioVector_t *transactions,
+		//			uint8 numTransactions, Port::writeCompleteCallback_t callback, void *context);
+		//		bool IsWriteBusy(Port &port);
+		//		void ServiceWrite(Port &port);
+		//		void WaitForWrite(Port &port);
+		//
+		// which work the same as the Port functions of the same name (Port::I2cMasterWriteVectored(),
+		// Port::I2cMasterStartWrite(), e.t.c). The Ssd1306's port is passed in, for transports that
+		// need it. The functions are defined inline, below the classes, for the same reason.
+
+		//! @brief		Sends everything through the Ssd1306's Port, which picks the platform, interface
+		//!				(I2C or SPI) and bus at run-time. The default transport.
+		//! @details	The only transport with background (interrupt or worker thread) writes for
+		//!				FlushAsync().
+		class PortTransport
+		{
+			public:
+
+				//! @brief		Initialises the bus.
+				void Start(Port &port);
+
+				//! @brief		Returns the bytes each transaction takes on top of it's payload.
+				uint8 GetOverheadBytes(Port &port);
+
+				//! @brief		Writes a whole transaction.
+				//! @returns	A Port::transferResult_t.
+				uint8 Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors);
+
+				//! @brief		Starts writing a list of transactions, each starting with it's control byte.
+				uint8 StartWrite(
+					Port &port,
+					uint8 slaveAddress,
+					const Port::ioVector_t *transactions,
+					uint8 numTransactions,
+					Port::writeCompleteCallback_t callback,
+					void *context);
+
+				bool IsWriteBusy(Port &port);
+				void ServiceWrite(Port &port);
+				void WaitForWrite(Port &port);
+		};
+
+		//! @brief		Base of the transports that send each transaction before returning.
+		//! @details	Provides the asynchronous functions, which just send the transactions straight
+		//!				away. So FlushAsync() works with any transport, it just isn't in the background.
+		//! @tparam		Derived		The transport, which provides Write().
+		template<class Derived>
+		class BlockingTransport
+		{
+			public:
+
+				//! @brief		Does nothing, transports that need setting up have their own Start().
+				void Start(Port &port);
+
+				//! @brief		Sends each transaction with Derived::Write(), then calls the callback.
+				uint8 StartWrite(
+					Port &port,
+					uint8 slaveAddress,
+					const Port::ioVector_t *transactions,
+					uint8 numTransactions,
+					Port::writeCompleteCallback_t callback,
+					void *context);
+
+				//! @brief		Always false, writes are finished by the time StartWrite() returns.
+				bool IsWriteBusy(Port &port);
+				void ServiceWrite(Port &port);
+				void WaitForWrite(Port &port);
+		};
+
+		//! @brief		Sends nothing, just counts the transactions and bytes.
+		//! @details	For running the driver without a panel, and for measuring the cost of the
+		//!				driver itself (see benchmark/TransportBenchmark.cpp).
+		class NullTransport : public BlockingTransport<NullTransport>
+		{
+			public:
+
+				//! @brief		Constructor.
+				NullTransport();
+
+				//! @brief		Returns 0, there is no bus.
+				uint8 GetOverheadBytes(Port &port);
+
+				//! @brief		Counts the transaction. Always succeeds.
+				uint8 Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors);
+
+				//! @brief		Returns the number of transactions written so far.
+				uint32 GetNumTransactions();
+
+				//! @brief		Returns the number of payload bytes (not counting control bytes) written so far.
+				uint32 GetNumBytes();
+
+			private:
+
+				uint32 numTransactions;
+				uint32 numBytes;
+		};
+
+		#if(MCU_PLATFORM == PSOC)
+			//! @brief		I2C through one of the PSoC I2C components, picked at compile time.
+			//! @details	Each transaction is sent with BusPsocI2cWrite(), the same as Port, but without
+			//!				checking which port to use for every transaction.
+			//! @tparam		i2cPort		Port::i2cLeft (I2cCpLeft) or Port::i2cRight (I2cCpRight).
+			template<Port::i2cPort_t i2cPort>
+			class PsocI2cTransport : public BlockingTransport<PsocI2cTransport<i2cPort> >
+			{
+				public:
+
+					//! @brief		Starts the I2C component.
+					void Start(Port &port);
+
+					//! @brief		Returns 2, the address and control byte.
+					uint8 GetOverheadBytes(Port &port);
+
+					//! @brief		Writes a whole transaction.
+					//! @returns	A Port::transferResult_t.
+					uint8 Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors);
+			};
+		#endif
+
+		#if(MCU_PLATFORM == LINUX)
+			//! @brief		I2C through the Linux i2c-dev interface (/dev/i2c-N).
+			//! @details	Each vector is copied in one go (rather than byte by byte) into a message
+			//!				after the control byte, and a whole frame goes to the kernel in one I2C_RDWR
+			//!				ioctl(). Use PortTransport for adapters that can only do SMBus, or need short
+			//!				messages.
+			class LinuxI2cTransport : public BlockingTransport<LinuxI2cTransport>
+			{
+				public:
+
+					//! @brief		Constructor.
+					LinuxI2cTransport();
+
+					//! @brief		Destructor. Closes the bus if it was opened by Open().
+					~LinuxI2cTransport();
+
+					//! @brief		Opens /dev/i2c-N.
+					//! @returns	False if it couldn't be opened.
+					bool Open(uint8 busNumber);
+
+					//! @brief		Uses an already open file descriptor, which isn't closed by the transport.
+					void SetFileDescriptor(int fd);
+
+					//! @brief		Replaces the function used to call ioctl(), to test against a mock.
+					//!				Pass NULL to restore the default.
+					void SetIoctlFunction(Port::ioctlFunction_t ioctlFunction);
+
+					//! @brief		Returns 2, the address and control byte.
+					uint8 GetOverheadBytes(Port &port);
+
+					//! @brief		Writes a whole transaction.
+					//! @returns	A Port::transferResult_t.
+					uint8 Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors);
+
+				private:
+
+					int fd;
+					bool ownsFd;
+					Port::ioctlFunction_t ioctlFunction;
+
+					//! @brief		Messages are assembled here, starting with the control byte.
+					uint8 msgBuffer[portLINUX_MSG_BUFFER_SIZE];
+			};
+
+			//! @brief		4-wire SPI through the Linux spidev interface (/dev/spidevB.C), with the D/C# pin
+			//!				on a GPIO line.
+			//! @details	Each transaction is one SPI_IOC_MESSAGE ioctl(), with one transfer per vector
+			//!				pointing straight at the caller's memory, so nothing is copied. The control byte
+			//!				only sets the D/C# pin, which is written when it changes.
+			class SpidevTransport : public BlockingTransport<SpidevTransport>
+			{
+				public:
+
+					//! @brief		Constructor.
+					SpidevTransport();
+
+					//! @brief		Destructor. Closes anything opened by Open() or OpenDcGpio().
+					~SpidevTransport();
+
+					//! @brief		Opens /dev/spidevB.C, in SPI mode 0 at the given clock.
+					//! @returns	False if it couldn't be opened or set up.
+					bool Open(uint8 busNumber, uint8 chipSelect, uint32 speedHz);
+
+					//! @brief		Requests a line of /dev/gpiochipN as an output for the D/C# pin.
+					//! @returns	False if it couldn't be requested.
+					bool OpenDcGpio(uint8 chipNumber, uint8 line);
+
+					//! @brief		Uses an already open spidev file descriptor and GPIO line handle, which
+					//!				aren't closed by the transport.
+					void SetFileDescriptors(int spiFd, int dcFd);
+
+					//! @brief		Replaces the function used to call ioctl(), to test against a mock.
+					//!				Pass NULL to restore the default.
+					void SetIoctlFunction(Port::ioctlFunction_t ioctlFunction);
+
+					//! @brief		Returns 0, there is no address or control byte on SPI.
+					uint8 GetOverheadBytes(Port &port);
+
+					//! @brief		Sets the D/C# pin from the control byte, then writes the payload.
+					//! @returns	A Port::transferResult_t.
+					uint8 Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors);
+
+				private:
+
+					int spiFd, dcFd;
+					bool ownsSpiFd, ownsDcFd;
+
+					//! @brief		Last level written to the D/C# pin (-1 if unknown).
+					int8 dcLevel;
+
+					Port::ioctlFunction_t ioctlFunction;
+			};
+		#endif
+
+		#if(MCU_PLATFORM == EMULATOR)
+			//! @brief		Feeds an Ssd1306Emulator directly, without going through Port.
+			//! @details	Each vector is handed to the emulator in one Ssd1306Emulator::WriteBytes() call.
+			class EmulatorTransport : public BlockingTransport<EmulatorTransport>
+			{
+				public:
+
+					//! @brief		Constructor.
+					EmulatorTransport();
+
+					//! @brief		Sets the emulator that gets the transactions.
+					void Attach(Ssd1306Emulator *emulator);
+
+					//! @brief		Returns 2, the address and control byte.
+					uint8 GetOverheadBytes(Port &port);
+
+					//! @brief		Writes a whole transaction. Fails at the start if the address doesn't
+					//!				match the emulator's, like a real NACK.
+					//! @returns	A Port::transferResult_t.
+					uint8 Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors);
+
+				private:
+
+					Ssd1306Emulator *emulator;
+			};
+		#endif
+
+		//===============================================================================================//
+		//====================================== INLINE FUNCTIONS =======================================//
+		//===============================================================================================//
+
+		// PortTransport
+
+		inline void PortTransport::Start(Port &port)
+		{
+			port.I2cStart();
+			port.I2cEnableInt();
+		}
+
+		inline uint8 PortTransport::GetOverheadBytes(Port &port)
+		{
+			return port.GetTransactionOverheadBytes();
+		}
+
+		inline uint8 PortTransport::Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors)
+		{
+			return port.I2cMasterWriteVectored(slaveAddress, controlByte, vectors, numVectors);
+		}
+
+		inline uint8 PortTransport::StartWrite(
+			Port &port,
+			uint8 slaveAddress,
+			const Port::ioVector_t *transactions,
+			uint8 numTransactions,
+			Port::writeCompleteCallback_t callback,
+			void *context)
+		{
+			return port.I2cMasterStartWrite(slaveAddress, transactions, numTransactions, callback, context);
+		}
+
+		inline bool PortTransport::IsWriteBusy(Port &port)
+		{
+			return port.I2cMasterIsWriteBusy();
+		}
+
+		inline void PortTransport::ServiceWrite(Port &port)
+		{
+			port.I2cMasterServiceWrite();
+		}
+
+		inline void PortTransport::WaitForWrite(Port &port)
+		{
+			port.I2cMasterWaitForWrite();
+		}
+
+		// BlockingTransport
+
+		template<class Derived>
+		inline void BlockingTransport<Derived>::Start(Port &port)
+		{
+			(void)port;
+		}
+
+		template<class Derived>
+		inline uint8 BlockingTransport<Derived>::StartWrite(
+			Port &port,
+			uint8 slaveAddress,
+			const Port::ioVector_t *transactions,
+			uint8 numTransactions,
+			Port::writeCompleteCallback_t callback,
+			void *context)
+		{
+			Port::ioVector_t payload;
+			uint8 result = Port::TRANSFER_OK;
+			uint8 i;
+
+			for(i = 0; i < numTransactions; i++)
+			{
+				// First byte of each transaction is it's control byte
+				payload.data = transactions[i].data + 1;
+				payload.numBytes = transactions[i].numBytes - 1;
+
+				result = static_cast<Derived*>(this)->Write(port, slaveAddress, transactions[i].data[0], &payload, 1);
+				if(result != Port::TRANSFER_OK)
+					break;
+			}
+
+			if(callback != NULL)
+				callback(context, result);
+
+			return Port::TRANSFER_OK;
+		}
+
+		template<class Derived>
+		inline bool BlockingTransport<Derived>::IsWriteBusy(Port &port)
+		{
+			(void)port;
+			return false;
+		}
+
+		template<class Derived>
+		inline void BlockingTransport<Derived>::ServiceWrite(Port &port)
+		{
+			(void)port;
+		}
+
+		template<class Derived>
+		inline void BlockingTransport<Derived>::WaitForWrite(Port &port)
+		{
+			(void)port;
+		}
+
+		// NullTransport
+
+		inline NullTransport::NullTransport()
+		{
+			numTransactions = 0;
+			numBytes = 0;
+		}
+
+		inline uint8 NullTransport::GetOverheadBytes(Port &port)
+		{
+			(void)port;
+			return 0;
+		}
+
+		inline uint8 NullTransport::Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors)
+		{
+			uint8 i;
+
+			(void)port;
+			(void)slaveAddress;
+			(void)controlByte;
+
+			numTransactions++;
+			for(i = 0; i < numVectors; i++)
+			{
+				numBytes += vectors[i].numBytes;
+			}
+
+			return Port::TRANSFER_OK;
+		}
+
+		inline uint32 NullTransport::GetNumTransactions()
+		{
+			return numTransactions;
+		}
+
+		inline uint32 NullTransport::GetNumBytes()
+		{
+			return numBytes;
+		}
+
+		#if(MCU_PLATFORM == PSOC)
+			// PsocI2cTransport
+
+			template<Port::i2cPort_t i2cPort>
+			inline void PsocI2cTransport<i2cPort>::Start(Port &port)
+			{
+				(void)port;
+
+				if(i2cPort == Port::i2cLeft)
+				{
+					I2cCpLeft_Start();
+					I2cCpLeft_EnableInt();
+				}
+				else
+				{
+					I2cCpRight_Start();
+					I2cCpRight_EnableInt();
+				}
+			}
+
+			template<Port::i2cPort_t i2cPort>
+			inline uint8 PsocI2cTransport<i2cPort>::GetOverheadBytes(Port &port)
+			{
+				(void)port;
+				return 2;
+			}
+
+			template<Port::i2cPort_t i2cPort>
+			inline uint8 PsocI2cTransport<i2cPort>::Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors)
+			{
+				(void)port;
+
+				return BusPsocI2cWrite<i2cPort>(slaveAddress, controlByte, vectors, numVectors);
+			}
+		#endif
+
+		#if(MCU_PLATFORM == LINUX)
+			// LinuxI2cTransport
+
+			inline LinuxI2cTransport::LinuxI2cTransport()
+			{
+				fd = -1;
+				ownsFd = false;
+				ioctlFunction = NULL;
+			}
+
+			inline LinuxI2cTransport::~LinuxI2cTransport()
+			{
+				if(ownsFd && (fd >= 0))
+					close(fd);
+			}
+
+			inline bool LinuxI2cTransport::Open(uint8 busNumber)
+			{
+				char devicePath[20];
+
+				if(ownsFd && (fd >= 0))
+					close(fd);
+
+				snprintf(devicePath, sizeof(devicePath), "/dev/i2c-%u", busNumber);
+
+				fd = open(devicePath, O_RDWR);
+				ownsFd = (fd >= 0);
+
+				return (fd >= 0);
+			}
+
+			inline void LinuxI2cTransport::SetFileDescriptor(int fd)
+			{
+				if(ownsFd && (this->fd >= 0))
+					close(this->fd);
+
+				this->fd = fd;
+				ownsFd = false;
+			}
+
+			inline void LinuxI2cTransport::SetIoctlFunction(Port::ioctlFunction_t ioctlFunction)
+			{
+				this->ioctlFunction = ioctlFunction;
+			}
+
+			inline uint8 LinuxI2cTransport::GetOverheadBytes(Port &port)
+			{
+				(void)port;
+				return 2;
+			}
+
+			inline uint8 LinuxI2cTransport::Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors)
+			{
+				(void)port;
+
+				if(fd < 0)
+					return Port::TRANSFER_ERROR_START;
+
+				// No limit on the message length other than the buffer, so each message fills it
+				return BusI2cDevWrite(fd, ioctlFunction, msgBuffer, portLINUX_MSG_BUFFER_SIZE, slaveAddress, controlByte, vectors, numVectors);
+			}
+
+			// SpidevTransport
+
+			inline SpidevTransport::SpidevTransport()
+			{
+				spiFd = -1;
+				dcFd = -1;
+				ownsSpiFd = false;
+				ownsDcFd = false;
+				dcLevel = -1;
+				ioctlFunction = NULL;
+			}
+
+			inline SpidevTransport::~SpidevTransport()
+			{
+				if(ownsSpiFd && (spiFd >= 0))
+					close(spiFd);
+				if(ownsDcFd && (dcFd >= 0))
+					close(dcFd);
+			}
+
+			inline bool SpidevTransport::Open(uint8 busNumber, uint8 chipSelect, uint32 speedHz)
+			{
+				int fd;
+
+				fd = BusSpidevOpen(busNumber, chipSelect, speedHz);
+				if(fd < 0)
+					return false;
+
+				if(ownsSpiFd && (spiFd >= 0))
+					close(spiFd);
+
+				spiFd = fd;
+				ownsSpiFd = true;
+
+				return true;
+			}
+
+			inline bool SpidevTransport::OpenDcGpio(uint8 chipNumber, uint8 line)
+			{
+				int fd;
+
+				fd = BusGpioRequestOutput(chipNumber, line);
+				if(fd < 0)
+					return false;
+
+				if(ownsDcFd && (dcFd >= 0))
+					close(dcFd);
+
+				dcFd = fd;
+				ownsDcFd = true;
+				dcLevel = 0;
+
+				return true;
+			}
+
+			inline void SpidevTransport::SetFileDescriptors(int spiFd, int dcFd)
+			{
+				if(ownsSpiFd && (this->spiFd >= 0))
+					close(this->spiFd);
+				if(ownsDcFd && (this->dcFd >= 0))
+					close(this->dcFd);
+
+				this->spiFd = spiFd;
+				this->dcFd = dcFd;
+				ownsSpiFd = false;
+				ownsDcFd = false;
+
+				// Don't know what level the line was left at
+				dcLevel = -1;
+			}
+
+			inline void SpidevTransport::SetIoctlFunction(Port::ioctlFunction_t ioctlFunction)
+			{
+				this->ioctlFunction = ioctlFunction;
+			}
+
+			inline uint8 SpidevTransport::GetOverheadBytes(Port &port)
+			{
+				(void)port;
+				return 0;
+			}
+
+			inline uint8 SpidevTransport::Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors)
+			{
+				int8 level;
+
+				(void)port;
+				(void)slaveAddress;
+
+				if((spiFd < 0) || (dcFd < 0))
+					return Port::TRANSFER_ERROR_START;
+
+				// SPI_IOC_MESSAGE doesn't return until the last transfer is complete, so the pin can
+				// change straight away
+				level = ((controlByte & portSPI_DC_BIT) != 0);
+				if(level != dcLevel)
+				{
+					if(BusGpioSetLine(dcFd, ioctlFunction, level) != Port::TRANSFER_OK)
+					{
+						dcLevel = -1;
+						return Port::TRANSFER_ERROR_START;
+					}
+
+					dcLevel = level;
+				}
+
+				return BusSpidevWrite(spiFd, ioctlFunction, vectors, numVectors);
+			}
+		#endif
+
+		#if(MCU_PLATFORM == EMULATOR)
+			// EmulatorTransport
+
+			inline EmulatorTransport::EmulatorTransport()
+			{
+				emulator = NULL;
+			}
+
+			inline void EmulatorTransport::Attach(Ssd1306Emulator *emulator)
+			{
+				this->emulator = emulator;
+			}
+
+			inline uint8 EmulatorTransport::GetOverheadBytes(Port &port)
+			{
+				(void)port;
+				return 2;
+			}
+
+			inline uint8 EmulatorTransport::Write(Port &port, uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors)
+			{
+				uint8 i;
+
+				(void)port;
+
+				// No device with this address, NACK
+				if((emulator == NULL) || (emulator->GetI2cAddress() != slaveAddress))
+					return Port::TRANSFER_ERROR_START;
+
+				emulator->Start();
+				emulator->WriteByte(controlByte);
+
+				for(i = 0; i < numVectors; i++)
+				{
+					emulator->WriteBytes(vectors[i].data, vectors[i].numBytes);
+				}
+
+				emulator->Stop();
+
+				return Port::TRANSFER_OK;
+			}
+		#endif
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_TRANSPORT_H
+
+// EOF
@@ -0,0 +1,458 @@
+//!
+//! @file 				Fixed5x7.hpp
+//! @author 			Generated by tools/FontCompiler.py
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Fixed5x7 font (8 pixels high, fixed width), compiled from fonts/Ssd1306_5x7.bdf.
+//! @details
+//!						Do not edit, re-run the font compiler instead:
+//!						tools/FontCompiler.py fonts/Ssd1306_5x7.bdf --name Fixed5x7 --fixed --chars 0x20-0xFF
+
+#ifndef M_SSD1306_FONT_FIXED5X7_H
+#define M_SSD1306_FONT_FIXED5X7_H
+
+#include "../Font.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//! @brief		Glyph bitmaps, page-major, bit 0 at the top.
+		constexpr uint8 fontFixed5x7Bitmaps[] =
+		{
+			0x00,0x00,0x4F,0x00,0x00,		// '!' Exclamation Mark
+			0x00,0x07,0x00,0x07,0x00,		// '"' Quotation Mark
+			0x14,0x7F,0x14,0x7F,0x14,		// '#' Number Sign
+			0x24,0x2A,0x7F,0x2A,0x12,		// '$' Dollar Sign
+			0x23,0x13,0x08,0x64,0x62,		// '%' Percent Sign
+			0x36,0x49,0x55,0x22,0x50,		// '&' Ampersand
+			0x00,0x05,0x03,0x00,0x00,		// ''' Apostrophe
+			0x00,0x1C,0x22,0x41,0x00,		// '(' Left Parenthesis
+			0x00,0x41,0x22,0x1C,0x00,		// ')' Right Parenthesis
+			0x14,0x08,0x3E,0x08,0x14,		// '*' Asterisk
+			0x08,0x08,0x3E,0x08,0x08,		// '+' Plus Sign
+			0x00,0x50,0x30,0x00,0x00,		// ',' Comma
+			0x08,0x08,0x08,0x08,0x08,		// '-' Hyphen-Minus
+			0x00,0x60,0x60,0x00,0x00,		// '.' Full Stop
+			0x20,0x10,0x08,0x04,0x02,		// '/' Solidus
+			0x3E,0x51,0x49,0x45,0x3E,		// '0' Digit Zero
+			0x00,0x42,0x7F,0x40,0x00,		// '1' Digit One
+			0x42,0x61,0x51,0x49,0x46,		// '2' Digit Two
+			0x21,0x41,0x45,0x4B,0x31,		// '3' Digit Three
+			0x18,0x14,0x12,0x7F,0x10,		// '4' Digit Four
+			0x27,0x45,0x45,0x45,0x39,		// '5' Digit Five
+			0x3C,0x4A,0x49,0x49,0x30,		// '6' Digit Six
+			0x01,0x71,0x09,0x05,0x03,		// '7' Digit Seven
+			0x36,0x49,0x49,0x49,0x36,		// '8' Digit Eight
+			0x06,0x49,0x49,0x29,0x1E,		// '9' Dight Nine
+			0x00,0x36,0x36,0x00,0x00,		// ':' Colon
+			0x00,0x56,0x36,0x00,0x00,		// ';' Semicolon
+			0x08,0x14,0x22,0x41,0x00,		// '<' Less-Than Sign
+			0x14,0x14,0x14,0x14,0x14,		// '=' Equals Sign
+			0x00,0x41,0x22,0x14,0x08,		// '>' Greater-Than Sign
+			0x02,0x01,0x51,0x09,0x06,		// '?' Question Mark
+			0x32,0x49,0x79,0x41,0x3E,		// '@' Commercial At
+			0x7E,0x11,0x11,0x11,0x7E,		// 'A' Latin Capital Letter A
+			0x7F,0x49,0x49,0x49,0x36,		// 'B' Latin Capital Letter B
+			0x3E,0x41,0x41,0x41,0x22,		// 'C' Latin Capital Letter C
+			0x7F,0x41,0x41,0x22,0x1C,		// 'D' Latin Capital Letter D
+			0x7F,0x49,0x49,0x49,0x41,		// 'E' Latin Capital Letter E
+			0x7F,0x09,0x09,0x09,0x01,		// 'F' Latin Capital Letter F
+			0x3E,0x41,0x49,0x49,0x7A,		// 'G' Latin Capital Letter G
+			0x7F,0x08,0x08,0x08,0x7F,		// 'H' Latin Capital Letter H
+			0x00,0x41,0x7F,0x41,0x00,		// 'I' Latin Capital Letter I
+			0x20,0x40,0x41,0x3F,0x01,		// 'J' Latin Capital Letter J
+			0x7F,0x08,0x14,0x22,0x41,		// 'K' Latin Capital Letter K
+			0x7F,0x40,0x40,0x40,0x40,		// 'L' Latin Capital Letter L
+			0x7F,0x02,0x0C,0x02,0x7F,		// 'M' Latin Capital Letter M
+			0x7F,0x04,0x08,0x10,0x7F,		// 'N' Latin Capital Letter N
+			0x3E,0x41,0x41,0x41,0x3E,		// 'O' Latin Capital Letter O
+			0x7F,0x09,0x09,0x09,0x06,		// 'P' Latin Capital Letter P
+			0x3E,0x41,0x51,0x21,0x5E,		// 'Q' Latin Capital Letter Q
+			0x7F,0x09,0x19,0x29,0x46,		// 'R' Latin Capital Letter R
+			0x46,0x49,0x49,0x49,0x31,		// 'S' Latin Capital Letter S
+			0x01,0x01,0x7F,0x01,0x01,		// 'T' Latin Capital Letter T
+			0x3F,0x40,0x40,0x40,0x3F,		// 'U' Latin Capital Letter U
+			0x1F,0x20,0x40,0x20,0x1F,		// 'V' Latin Capital Letter V
+			0x3F,0x40,0x38,0x40,0x3F,		// 'W' Latin Capital Letter W
+			0x63,0x14,0x08,0x14,0x63,		// 'X' Latin Capital Letter X
+			0x07,0x08,0x70,0x08,0x07,		// 'Y' Latin Capital Letter Y
+			0x61,0x51,0x49,0x45,0x43,		// 'Z' Latin Capital Letter Z
+			0x00,0x7F,0x41,0x41,0x00,		// '[' Left Square Bracket
+			0x02,0x04,0x08,0x10,0x20,		// U+005C Reverse Solidus
+			0x00,0x41,0x41,0x7F,0x00,		// ']' Right Square Bracket
+			0x04,0x02,0x01,0x02,0x04,		// '^' Circumflex Accent
+			0x40,0x40,0x40,0x40,0x40,		// '_' Low Line
+			0x01,0x02,0x04,0x00,0x00,		// '`' Grave Accent
+			0x20,0x54,0x54,0x54,0x78,		// 'a' Latin Small Letter A
+			0x7F,0x48,0x44,0x44,0x38,		// 'b' Latin Small Letter B
+			0x38,0x44,0x44,0x44,0x20,		// 'c' Latin Small Letter C
+			0x38,0x44,0x44,0x48,0x7F,		// 'd' Latin Small Letter D
+			0x38,0x54,0x54,0x54,0x18,		// 'e' Latin Small Letter E
+			0x08,0x7E,0x09,0x01,0x02,		// 'f' Latin Small Letter F
+			0x06,0x49,0x49,0x49,0x3F,		// 'g' Latin Small Letter G
+			0x7F,0x08,0x04,0x04,0x78,		// 'h' Latin Small Letter H
+			0x00,0x44,0x7D,0x40,0x00,		// 'i' Latin Small Letter I
+			0x20,0x40,0x44,0x3D,0x00,		// 'j' Latin Small Letter J
+			0x7F,0x10,0x28,0x44,0x00,		// 'k' Latin Small Letter K
+			0x00,0x41,0x7F,0x40,0x00,		// 'l' Latin Small Letter L
+			0x7C,0x04,0x18,0x04,0x7C,		// 'm' Latin Small Letter M
+			0x7C,0x08,0x04,0x04,0x78,		// 'n' Latin Small Letter N
+			0x38,0x44,0x44,0x44,0x38,		// 'o' Latin Small Letter O
+			0x7C,0x14,0x14,0x14,0x08,		// 'p' Latin Small Letter P
+			0x08,0x14,0x14,0x18,0x7C,		// 'q' Latin Small Letter Q
+			0x7C,0x08,0x04,0x04,0x08,		// 'r' Latin Small Letter R
+			0x48,0x54,0x54,0x54,0x20,		// 's' Latin Small Letter S
+			0x04,0x3F,0x44,0x40,0x20,		// 't' Latin Small Letter T
+			0x3C,0x40,0x40,0x20,0x7C,		// 'u' Latin Small Letter U
+			0x1C,0x20,0x40,0x20,0x1C,		// 'v' Latin Small Letter V
+			0x3C,0x40,0x30,0x40,0x3C,		// 'w' Latin Small Letter W
+			0x44,0x28,0x10,0x28,0x44,		// 'x' Latin Small Letter X
+			0x0C,0x50,0x50,0x50,0x3C,		// 'y' Latin Small Letter Y
+			0x44,0x64,0x54,0x4C,0x44,		// 'z' Latin Small Letter Z
+			0x00,0x08,0x36,0x41,0x00,		// '{' Left Curly Bracket
+			0x00,0x00,0x7F,0x00,0x00,		// '|' Vertical Line
+			0x00,0x41,0x36,0x08,0x00,		// '}' Right Curly Bracket
+			0x02,0x01,0x02,0x04,0x02,		// '~' Tilde
+			0x3E,0x55,0x55,0x41,0x22,		// U+0080 <Control>
+			0x00,0x00,0x79,0x00,0x00,		// U+00A1 Inverted Exclamation Mark
+			0x18,0x24,0x74,0x2E,0x24,		// U+00A2 Cent Sign
+			0x48,0x7E,0x49,0x42,0x40,		// U+00A3 Pound Sign
+			0x5D,0x22,0x22,0x22,0x5D,		// U+00A4 Currency Sign
+			0x15,0x16,0x7C,0x16,0x15,		// U+00A5 Yen Sign
+			0x00,0x00,0x77,0x00,0x00,		// U+00A6 Broken Bar
+			0x0A,0x55,0x55,0x55,0x28,		// U+00A7 Section Sign
+			0x00,0x01,0x00,0x01,0x00,		// U+00A8 Diaeresis
+			0x00,0x0A,0x0D,0x0A,0x04,		// U+00AA Feminine Ordinal Indicator
+			0x08,0x14,0x2A,0x14,0x22,		// U+00AB Left-Pointing Double Angle Quotation Mark
+			0x04,0x04,0x04,0x04,0x1C,		// U+00AC Not Sign
+			0x00,0x08,0x08,0x08,0x00,		// U+00AD Soft Hyphen
+			0x01,0x01,0x01,0x01,0x01,		// U+00AF Macron
+			0x00,0x02,0x05,0x02,0x00,		// U+00B0 Degree Sign
+			0x44,0x44,0x5F,0x44,0x44,		// U+00B1 Plus-Minus Sign
+			0x00,0x00,0x04,0x02,0x01,		// U+00B4 Acute Accent
+			0x7E,0x20,0x20,0x10,0x3E,		// U+00B5 Micro Sign
+			0x06,0x0F,0x7F,0x00,0x7F,		// U+00B6 Pilcrow Sign
+			0x00,0x18,0x18,0x00,0x00,		// U+00B7 Middle Dot
+			0x00,0x40,0x50,0x20,0x00,		// U+00B8 Cedilla
+			0x00,0x0A,0x0D,0x0A,0x00,		// U+00BA Masculine Ordinal Indicator
+			0x22,0x14,0x2A,0x14,0x08,		// U+00BB Right-Pointing Double Angle Quotation Mark
+			0x17,0x08,0x34,0x2A,0x7D,		// U+00BC Vulgar Fraction One Quarter
+			0x17,0x08,0x04,0x6A,0x59,		// U+00BD Vulgar Fraction One Half
+			0x30,0x48,0x45,0x40,0x20,		// U+00BF Inverted Question Mark
+			0x70,0x29,0x26,0x28,0x70,		// U+00C0 Latin Capital Letter A with Grave
+			0x70,0x28,0x26,0x29,0x70,		// U+00C1 Latin Capital Letter A with Acute
+			0x70,0x2A,0x25,0x2A,0x70,		// U+00C2 Latin Capital Letter A with Circumflex
+			0x72,0x29,0x26,0x29,0x70,		// U+00C3 Latin Capital Letter A with Tilde
+			0x70,0x29,0x24,0x29,0x70,		// U+00C4 Latin Capital Letter A with Diaeresis
+			0x70,0x2A,0x2D,0x2A,0x70,		// U+00C5 Latin Capital Letter A with Ring Above
+			0x7E,0x11,0x7F,0x49,0x49,		// U+00C6 Latin Capital Letter Ae
+			0x0E,0x51,0x51,0x71,0x11,		// U+00C7 Latin Capital Letter C with Cedilla
+			0x7C,0x55,0x56,0x54,0x44,		// U+00C8 Latin Capital Letter E with Grave
+			0x7C,0x56,0x55,0x56,0x44,		// U+00CA Latin Capital Letter E with Circumflex
+			0x7C,0x55,0x54,0x55,0x44,		// U+00CB Latin Capital Letter E with Diaeresis
+			0x00,0x45,0x7E,0x44,0x00,		// U+00CC Latin Capital Letter I with Grave
+			0x00,0x44,0x7E,0x45,0x00,		// U+00CD Latin Capital Letter I with Acute
+			0x00,0x46,0x7D,0x46,0x00,		// U+00CE Latin Capital Letter I with Circumflex
+			0x00,0x45,0x7C,0x45,0x00,		// U+00CF Latin Capital Letter I with Diaeresis
+			0x7F,0x49,0x49,0x41,0x3E,		// U+00D0 Latin Capital Letter Eth
+			0x7C,0x0A,0x11,0x22,0x7D,		// U+00D1 Latin Capital Letter N with Tilde
+			0x38,0x45,0x46,0x44,0x38,		// U+00D2 Latin Capital Letter O with Grave
+			0x38,0x44,0x46,0x45,0x38,		// U+00D3 Latin Capital Letter O with Acute
+			0x38,0x46,0x45,0x46,0x38,		// U+00D4 Latin Capital Letter O with Circumflex
+			0x38,0x46,0x45,0x46,0x39,		// U+00D5 Latin Capital Letter O with Tilde
+			0x38,0x45,0x44,0x45,0x38,		// U+00D6 Latin Capital Letter O with Diaeresis
+			0x22,0x14,0x08,0x14,0x22,		// U+00D7 Multiplcation Sign
+			0x2E,0x51,0x49,0x45,0x3A,		// U+00D8 Latin Capital Letter O with Stroke
+			0x3C,0x41,0x42,0x40,0x3C,		// U+00D9 Latin Capital Letter U with Grave
+			0x3C,0x40,0x42,0x41,0x3C,		// U+00DA Latin Capital Letter U with Acute
+			0x3C,0x42,0x41,0x42,0x3C,		// U+00DB Latin Capital Letter U with Circumflex
+			0x3C,0x41,0x40,0x41,0x3C,		// U+00DC Latin Capital Letter U with Diaeresis
+			0x0C,0x10,0x62,0x11,0x0C,		// U+00DD Latin Capital Letter Y with Acute
+			0x7F,0x12,0x12,0x12,0x0C,		// U+00DE Latin Capital Letter Thom
+			0x40,0x3E,0x01,0x49,0x36,		// U+00DF Latin Capital Letter Sharp S
+			0x20,0x55,0x56,0x54,0x78,		// U+00E0 Latin Small Letter A with Grave
+			0x20,0x54,0x56,0x55,0x78,		// U+00E1 Latin Small Letter A with Acute
+			0x20,0x56,0x55,0x56,0x78,		// U+00E2 Latin Small Letter A with Circumflex
+			0x20,0x55,0x56,0x55,0x78,		// U+00E3 Latin Small Letter A with Tilde
+			0x20,0x55,0x54,0x55,0x78,		// U+00E4 Latin Small Letter A with Diaeresis
+			0x20,0x56,0x57,0x56,0x78,		// U+00E5 Latin Small Letter A with Ring Above
+			0x24,0x54,0x78,0x54,0x58,		// U+00E6 Latin Small Letter Ae
+			0x0C,0x52,0x52,0x72,0x13,		// U+00E7 Latin Small Letter c with Cedilla
+			0x38,0x55,0x56,0x54,0x18,		// U+00E8 Latin Small Letter E with Grave
+			0x38,0x54,0x56,0x55,0x18,		// U+00E9 Latin Small Letter E with Acute
+			0x38,0x56,0x55,0x56,0x18,		// U+00EA Latin Small Letter E with Circumflex
+			0x38,0x55,0x54,0x55,0x18,		// U+00EB Latin Small Letter E with Diaeresis
+			0x00,0x49,0x7A,0x40,0x00,		// U+00EC Latin Small Letter I with Grave
+			0x00,0x48,0x7A,0x41,0x00,		// U+00ED Latin Small Letter I with Acute
+			0x00,0x4A,0x79,0x42,0x00,		// U+00EE Latin Small Letter I with Circumflex
+			0x00,0x4A,0x78,0x42,0x00,		// U+00EF Latin Small Letter I with Diaeresis
+			0x31,0x4A,0x4E,0x4A,0x30,		// U+00F0 Latin Small Letter Eth
+			0x7A,0x11,0x0A,0x09,0x70,		// U+00F1 Latin Small Letter N with Tilde
+			0x30,0x49,0x4A,0x48,0x30,		// U+00F2 Latin Small Letter O with Grave
+			0x30,0x48,0x4A,0x49,0x30,		// U+00F3 Latin Small Letter O with Acute
+			0x30,0x4A,0x49,0x4A,0x30,		// U+00F4 Latin Small Letter O with Circumflex
+			0x30,0x4A,0x49,0x4A,0x31,		// U+00F5 Latin Small Letter O with Tilde
+			0x30,0x4A,0x48,0x4A,0x30,		// U+00F6 Latin Small Letter O with Diaeresis
+			0x08,0x08,0x2A,0x08,0x08,		// U+00F7 Division Sign
+			0x38,0x64,0x54,0x4C,0x38,		// U+00F8 Latin Small Letter O with Stroke
+			0x38,0x41,0x42,0x20,0x78,		// U+00F9 Latin Small Letter U with Grave
+			0x38,0x40,0x42,0x21,0x78,		// U+00FA Latin Small Letter U with Acute
+			0x38,0x42,0x41,0x22,0x78,		// U+00FB Latin Small Letter U with Circumflex
+			0x38,0x42,0x40,0x22,0x78,		// U+00FC Latin Small Letter U with Diaeresis
+			0x0C,0x50,0x52,0x51,0x3C,		// U+00FD Latin Small Letter Y with Acute
+			0x7E,0x14,0x14,0x14,0x08,		// U+00FE Latin Small Letter Thom
+			0x0C,0x51,0x50,0x51,0x3C,		// U+00FF Latin Small Letter Y with Diaeresis
+		};
+
+		//! @brief		One glyph per character from 32 to 255: offset, width, advance.
+		constexpr fontGlyph_t fontFixed5x7Glyphs[] =
+		{
+			{0, 0, 6},		// 32: U+0020 Space
+			{0, 5, 6},		// 33: '!' Exclamation Mark
+			{5, 5, 6},		// 34: '"' Quotation Mark
+			{10, 5, 6},		// 35: '#' Number Sign
+			{15, 5, 6},		// 36: '$' Dollar Sign
+			{20, 5, 6},		// 37: '%' Percent Sign
+			{25, 5, 6},		// 38: '&' Ampersand
+			{30, 5, 6},		// 39: ''' Apostrophe
+			{35, 5, 6},		// 40: '(' Left Parenthesis
+			{40, 5, 6},		// 41: ')' Right Parenthesis
+			{45, 5, 6},		// 42: '*' Asterisk
+			{50, 5, 6},		// 43: '+' Plus Sign
+			{55, 5, 6},		// 44: ',' Comma
+			{60, 5, 6},		// 45: '-' Hyphen-Minus
+			{65, 5, 6},		// 46: '.' Full Stop
+			{70, 5, 6},		// 47: '/' Solidus
+			{75, 5, 6},		// 48: '0' Digit Zero
+			{80, 5, 6},		// 49: '1' Digit One
+			{85, 5, 6},		// 50: '2' Digit Two
+			{90, 5, 6},		// 51: '3' Digit Three
+			{95, 5, 6},		// 52: '4' Digit Four
+			{100, 5, 6},		// 53: '5' Digit Five
+			{105, 5, 6},		// 54: '6' Digit Six
+			{110, 5, 6},		// 55: '7' Digit Seven
+			{115, 5, 6},		// 56: '8' Digit Eight
+			{120, 5, 6},		// 57: '9' Dight Nine
+			{125, 5, 6},		// 58: ':' Colon
+			{130, 5, 6},		// 59: ';' Semicolon
+			{135, 5, 6},		// 60: '<' Less-Than Sign
+			{140, 5, 6},		// 61: '=' Equals Sign
+			{145, 5, 6},		// 62: '>' Greater-Than Sign
+			{150, 5, 6},		// 63: '?' Question Mark
+			{155, 5, 6},		// 64: '@' Commercial At
+			{160, 5, 6},		// 65: 'A' Latin Capital Letter A
+			{165, 5, 6},		// 66: 'B' Latin Capital Letter B
+			{170, 5, 6},		// 67: 'C' Latin Capital Letter C
+			{175, 5, 6},		// 68: 'D' Latin Capital Letter D
+			{180, 5, 6},		// 69: 'E' Latin Capital Letter E
+			{185, 5, 6},		// 70: 'F' Latin Capital Letter F
+			{190, 5, 6},		// 71: 'G' Latin Capital Letter G
+			{195, 5, 6},		// 72: 'H' Latin Capital Letter H
+			{200, 5, 6},		// 73: 'I' Latin Capital Letter I
+			{205, 5, 6},		// 74: 'J' Latin Capital Letter J
+			{210, 5, 6},		// 75: 'K' Latin Capital Letter K
+			{215, 5, 6},		// 76: 'L' Latin Capital Letter L
+			{220, 5, 6},		// 77: 'M' Latin Capital Letter M
+			{225, 5, 6},		// 78: 'N' Latin Capital Letter N
+			{230, 5, 6},		// 79: 'O' Latin Capital Letter O
+			{235, 5, 6},		// 80: 'P' Latin Capital Letter P
+			{240, 5, 6},		// 81: 'Q' Latin Capital Letter Q
+			{245, 5, 6},		// 82: 'R' Latin Capital Letter R
+			{250, 5, 6},		// 83: 'S' Latin Capital Letter S
+			{255, 5, 6},		// 84: 'T' Latin Capital Letter T
+			{260, 5, 6},		// 85: 'U' Latin Capital Letter U
+			{265, 5, 6},		// 86: 'V' Latin Capital Letter V
+			{270, 5, 6},		// 87: 'W' Latin Capital Letter W
+			{275, 5, 6},		// 88: 'X' Latin Capital Letter X
+			{280, 5, 6},		// 89: 'Y' Latin Capital Letter Y
+			{285, 5, 6},		// 90: 'Z' Latin Capital Letter Z
+			{290, 5, 6},		// 91: '[' Left Square Bracket
+			{295, 5, 6},		// 92: U+005C Reverse Solidus
+			{300, 5, 6},		// 93: ']' Right Square Bracket
+			{305, 5, 6},		// 94: '^' Circumflex Accent
+			{310, 5, 6},		// 95: '_' Low Line
+			{315, 5, 6},		// 96: '`' Grave Accent
+			{320, 5, 6},		// 97: 'a' Latin Small Letter A
+			{325, 5, 6},		// 98: 'b' Latin Small Letter B
+			{330, 5, 6},		// 99: 'c' Latin Small Letter C
+			{335, 5, 6},		// 100: 'd' Latin Small Letter D
+			{340, 5, 6},		// 101: 'e' Latin Small Letter E
+			{345, 5, 6},		// 102: 'f' Latin Small Letter F
+			{350, 5, 6},		// 103: 'g' Latin Small Letter G
+			{355, 5, 6},		// 104: 'h' Latin Small Letter H
+			{360, 5, 6},		// 105: 'i' Latin Small Letter I
+			{365, 5, 6},		// 106: 'j' Latin Small Letter J
+			{370, 5, 6},		// 107: 'k' Latin Small Letter K
+			{375, 5, 6},		// 108: 'l' Latin Small Letter L
+			{380, 5, 6},		// 109: 'm' Latin Small Letter M
+			{385, 5, 6},		// 110: 'n' Latin Small Letter N
+			{390, 5, 6},		// 111: 'o' Latin Small Letter O
+			{395, 5, 6},		// 112: 'p' Latin Small Letter P
+			{400, 5, 6},		// 113: 'q' Latin Small Letter Q
+			{405, 5, 6},		// 114: 'r' Latin Small Letter R
+			{410, 5, 6},		// 115: 's' Latin Small Letter S
+			{415, 5, 6},		// 116: 't' Latin Small Letter T
+			{420, 5, 6},		// 117: 'u' Latin Small Letter U
+			{425, 5, 6},		// 118: 'v' Latin Small Letter V
+			{430, 5, 6},		// 119: 'w' Latin Small Letter W
+			{435, 5, 6},		// 120: 'x' Latin Small Letter X
+			{440, 5, 6},		// 121: 'y' Latin Small Letter Y
+			{445, 5, 6},		// 122: 'z' Latin Small Letter Z
+			{450, 5, 6},		// 123: '{' Left Curly Bracket
+			{455, 5, 6},		// 124: '|' Vertical Line
+			{460, 5, 6},		// 125: '}' Right Curly Bracket
+			{465, 5, 6},		// 126: '~' Tilde
+			{0, 0, 0},		// 127: (none)
+			{470, 5, 6},		// 128: U+0080 <Control>
+			{0, 0, 0},		// 129: (none)
+			{0, 0, 0},		// 130: (none)
+			{0, 0, 0},		// 131: (none)
+			{0, 0, 0},		// 132: (none)
+			{0, 0, 0},		// 133: (none)
+			{0, 0, 0},		// 134: (none)
+			{0, 0, 0},		// 135: (none)
+			{0, 0, 0},		// 136: (none)
+			{0, 0, 0},		// 137: (none)
+			{0, 0, 0},		// 138: (none)
+			{0, 0, 0},		// 139: (none)
+			{0, 0, 0},		// 140: (none)
+			{0, 0, 0},		// 141: (none)
+			{0, 0, 0},		// 142: (none)
+			{0, 0, 0},		// 143: (none)
+			{0, 0, 0},		// 144: (none)
+			{0, 0, 0},		// 145: (none)
+			{0, 0, 0},		// 146: (none)
+			{0, 0, 0},		// 147: (none)
+			{0, 0, 0},		// 148: (none)
+			{0, 0, 0},		// 149: (none)
+			{0, 0, 0},		// 150: (none)
+			{0, 0, 0},		// 151: (none)
+			{0, 0, 0},		// 152: (none)
+			{0, 0, 0},		// 153: (none)
+			{0, 0, 0},		// 154: (none)
+			{0, 0, 0},		// 155: (none)
+			{0, 0, 0},		// 156: (none)
+			{0, 0, 0},		// 157: (none)
+			{0, 0, 0},		// 158: (none)
+			{0, 0, 0},		// 159: (none)
+			{0, 0, 6},		// 160: U+00A0 No-Break Space
+			{475, 5, 6},		// 161: U+00A1 Inverted Exclamation Mark
+			{480, 5, 6},		// 162: U+00A2 Cent Sign
+			{485, 5, 6},		// 163: U+00A3 Pound Sign
+			{490, 5, 6},		// 164: U+00A4 Currency Sign
+			{495, 5, 6},		// 165: U+00A5 Yen Sign
+			{500, 5, 6},		// 166: U+00A6 Broken Bar
+			{505, 5, 6},		// 167: U+00A7 Section Sign
+			{510, 5, 6},		// 168: U+00A8 Diaeresis
+			{0, 0, 0},		// 169: (none)
+			{515, 5, 6},		// 170: U+00AA Feminine Ordinal Indicator
+			{520, 5, 6},		// 171: U+00AB Left-Pointing Double Angle Quotation Mark
+			{525, 5, 6},		// 172: U+00AC Not Sign
+			{530, 5, 6},		// 173: U+00AD Soft Hyphen
+			{0, 0, 0},		// 174: (none)
+			{535, 5, 6},		// 175: U+00AF Macron
+			{540, 5, 6},		// 176: U+00B0 Degree Sign
+			{545, 5, 6},		// 177: U+00B1 Plus-Minus Sign
+			{0, 0, 0},		// 178: (none)
+			{0, 0, 0},		// 179: (none)
+			{550, 5, 6},		// 180: U+00B4 Acute Accent
+			{555, 5, 6},		// 181: U+00B5 Micro Sign
+			{560, 5, 6},		// 182: U+00B6 Pilcrow Sign
+			{565, 5, 6},		// 183: U+00B7 Middle Dot
+			{570, 5, 6},		// 184: U+00B8 Cedilla
+			{0, 0, 0},		// 185: (none)
+			{575, 5, 6},		// 186: U+00BA Masculine Ordinal Indicator
+			{580, 5, 6},		// 187: U+00BB Right-Pointing Double Angle Quotation Mark
+			{585, 5, 6},		// 188: U+00BC Vulgar Fraction One Quarter
+			{590, 5, 6},		// 189: U+00BD Vulgar Fraction One Half
+			{0, 0, 0},		// 190: (none)
+			{595, 5, 6},		// 191: U+00BF Inverted Question Mark
+			{600, 5, 6},		// 192: U+00C0 Latin Capital Letter A with Grave
+			{605, 5, 6},		// 193: U+00C1 Latin Capital Letter A with Acute
+			{610, 5, 6},		// 194: U+00C2 Latin Capital Letter A with Circumflex
+			{615, 5, 6},		// 195: U+00C3 Latin Capital Letter A with Tilde
+			{620, 5, 6},		// 196: U+00C4 Latin Capital Letter A with Diaeresis
+			{625, 5, 6},		// 197: U+00C5 Latin Capital Letter A with Ring Above
+			{630, 5, 6},		// 198: U+00C6 Latin Capital Letter Ae
+			{635, 5, 6},		// 199: U+00C7 Latin Capital Letter C with Cedilla
+			{640, 5, 6},		// 200: U+00C8 Latin Capital Letter E with Grave
+			{640, 5, 6},		// 201: U+00C9 Latin Capital Letter E with Acute
+			{645, 5, 6},		// 202: U+00CA Latin Capital Letter E with Circumflex
+			{650, 5, 6},		// 203: U+00CB Latin Capital Letter E with Diaeresis
+			{655, 5, 6},		// 204: U+00CC Latin Capital Letter I with Grave
+			{660, 5, 6},		// 205: U+00CD Latin Capital Letter I with Acute
+			{665, 5, 6},		// 206: U+00CE Latin Capital Letter I with Circumflex
+			{670, 5, 6},		// 207: U+00CF Latin Capital Letter I with Diaeresis
+			{675, 5, 6},		// 208: U+00D0 Latin Capital Letter Eth
+			{680, 5, 6},		// 209: U+00D1 Latin Capital Letter N with Tilde
+			{685, 5, 6},		// 210: U+00D2 Latin Capital Letter O with Grave
+			{690, 5, 6},		// 211: U+00D3 Latin Capital Letter O with Acute
+			{695, 5, 6},		// 212: U+00D4 Latin Capital Letter O with Circumflex
+			{700, 5, 6},		// 213: U+00D5 Latin Capital Letter O with Tilde
+			{705, 5, 6},		// 214: U+00D6 Latin Capital Letter O with Diaeresis
+			{710, 5, 6},		// 215: U+00D7 Multiplcation Sign
+			{715, 5, 6},		// 216: U+00D8 Latin Capital Letter O with Stroke
+			{720, 5, 6},		// 217: U+00D9 Latin Capital Letter U with Grave
+			{725, 5, 6},		// 218: U+00DA Latin Capital Letter U with Acute
+			{730, 5, 6},		// 219: U+00DB Latin Capital Letter U with Circumflex
+			{735, 5, 6},		// 220: U+00DC Latin Capital Letter U with Diaeresis
+			{740, 5, 6},		// 221: U+00DD Latin Capital Letter Y with Acute
+			{745, 5, 6},		// 222: U+00DE Latin Capital Letter Thom
+			{750, 5, 6},		// 223: U+00DF Latin Capital Letter Sharp S
+			{755, 5, 6},		// 224: U+00E0 Latin Small Letter A with Grave
+			{760, 5, 6},		// 225: U+00E1 Latin Small Letter A with Acute
+			{765, 5, 6},		// 226: U+00E2 Latin Small Letter A with Circumflex
+			{770, 5, 6},		// 227: U+00E3 Latin Small Letter A with Tilde
+			{775, 5, 6},		// 228: U+00E4 Latin Small Letter A with Diaeresis
+			{780, 5, 6},		// 229: U+00E5 Latin Small Letter A with Ring Above
+			{785, 5, 6},		// 230: U+00E6 Latin Small Letter Ae
+			{790, 5, 6},		// 231: U+00E7 Latin Small Letter c with Cedilla
+			{795, 5, 6},		// 232: U+00E8 Latin Small Letter E with Grave
+			{800, 5, 6},		// 233: U+00E9 Latin Small Letter E with Acute
+			{805, 5, 6},		// 234: U+00EA Latin Small Letter E with Circumflex
+			{810, 5, 6},		// 235: U+00EB Latin Small Letter E with Diaeresis
+			{815, 5, 6},		// 236: U+00EC Latin Small Letter I with Grave
+			{820, 5, 6},		// 237: U+00ED Latin Small Letter I with Acute
+			{825, 5, 6},		// 238: U+00EE Latin Small Letter I with Circumflex
+			{830, 5, 6},		// 239: U+00EF Latin Small Letter I with Diaeresis
+			{835, 5, 6},		// 240: U+00F0 Latin Small Letter Eth
+			{840, 5, 6},		// 241: U+00F1 Latin Small Letter N with Tilde
+			{845, 5, 6},		// 242: U+00F2 Latin Small Letter O with Grave
+			{850, 5, 6},		// 243: U+00F3 Latin Small Letter O with Acute
+			{855, 5, 6},		// 244: U+00F4 Latin Small Letter O with Circumflex
+			{860, 5, 6},		// 245: U+00F5 Latin Small Letter O with Tilde
+			{865, 5, 6},		// 246: U+00F6 Latin Small Letter O with Diaeresis
+			{870, 5, 6},		// 247: U+00F7 Division Sign
+			{875, 5, 6},		// 248: U+00F8 Latin Small Letter O with Stroke
+			{880, 5, 6},		// 249: U+00F9 Latin Small Letter U with Grave
+			{885, 5, 6},		// 250: U+00FA Latin Small Letter U with Acute
+			{890, 5, 6},		// 251: U+00FB Latin Small Letter U with Circumflex
+			{895, 5, 6},		// 252: U+00FC Latin Small Letter U with Diaeresis
+			{900, 5, 6},		// 253: U+00FD Latin Small Letter Y with Acute
+			{905, 5, 6},		// 254: U+00FE Latin Small Letter Thom
+			{910, 5, 6},		// 255: U+00FF Latin Small Letter Y with Diaeresis
+		};
+
+		//! @brief		The Fixed5x7 font.
+		constexpr font_t fontFixed5x7 =
+		{
+			fontFixed5x7Bitmaps,
+			fontFixed5x7Glyphs,
+			NULL,
+			0,		// numKerningPairs
+			32,		// firstChar
+			255,		// lastChar
+			32,		// defaultChar
+			8,		// height
+			1		// numPages
+		};
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_FONT_FIXED5X7_H
+
+// EOF
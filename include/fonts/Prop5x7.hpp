@@ -0,0 +1,265 @@
+//!
+//! @file 				Prop5x7.hpp
+//! @author 			Generated by tools/FontCompiler.py
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Prop5x7 font (8 pixels high, proportional), compiled from fonts/Ssd1306_5x7.bdf.
+//! @details
+//!						Do not edit, re-run the font compiler instead:
+//!						tools/FontCompiler.py fonts/Ssd1306_5x7.bdf --name Prop5x7 --chars 0x20-0x7E --kerning fonts/Prop5x7.kern
+
+#ifndef M_SSD1306_FONT_PROP5X7_H
+#define M_SSD1306_FONT_PROP5X7_H
+
+#include "../Font.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//! @brief		Glyph bitmaps, page-major, bit 0 at the top.
+		constexpr uint8 fontProp5x7Bitmaps[] =
+		{
+			0x4F,		// '!' Exclamation Mark
+			0x07,0x00,0x07,		// '"' Quotation Mark
+			0x14,0x7F,0x14,0x7F,0x14,		// '#' Number Sign
+			0x24,0x2A,0x7F,0x2A,0x12,		// '$' Dollar Sign
+			0x23,0x13,0x08,0x64,0x62,		// '%' Percent Sign
+			0x36,0x49,0x55,0x22,0x50,		// '&' Ampersand
+			0x05,0x03,		// ''' Apostrophe
+			0x1C,0x22,0x41,		// '(' Left Parenthesis
+			0x41,0x22,0x1C,		// ')' Right Parenthesis
+			0x14,0x08,0x3E,0x08,0x14,		// '*' Asterisk
+			0x08,0x08,0x3E,0x08,0x08,		// '+' Plus Sign
+			0x50,0x30,		// ',' Comma
+			0x08,0x08,0x08,0x08,0x08,		// '-' Hyphen-Minus
+			0x60,0x60,		// '.' Full Stop
+			0x20,0x10,0x08,0x04,0x02,		// '/' Solidus
+			0x3E,0x51,0x49,0x45,0x3E,		// '0' Digit Zero
+			0x42,0x7F,0x40,		// '1' Digit One
+			0x42,0x61,0x51,0x49,0x46,		// '2' Digit Two
+			0x21,0x41,0x45,0x4B,0x31,		// '3' Digit Three
+			0x18,0x14,0x12,0x7F,0x10,		// '4' Digit Four
+			0x27,0x45,0x45,0x45,0x39,		// '5' Digit Five
+			0x3C,0x4A,0x49,0x49,0x30,		// '6' Digit Six
+			0x01,0x71,0x09,0x05,0x03,		// '7' Digit Seven
+			0x36,0x49,0x49,0x49,0x36,		// '8' Digit Eight
+			0x06,0x49,0x49,0x29,0x1E,		// '9' Dight Nine
+			0x36,0x36,		// ':' Colon
+			0x56,0x36,		// ';' Semicolon
+			0x08,0x14,0x22,0x41,		// '<' Less-Than Sign
+			0x14,0x14,0x14,0x14,0x14,		// '=' Equals Sign
+			0x41,0x22,0x14,0x08,		// '>' Greater-Than Sign
+			0x02,0x01,0x51,0x09,0x06,		// '?' Question Mark
+			0x32,0x49,0x79,0x41,0x3E,		// '@' Commercial At
+			0x7E,0x11,0x11,0x11,0x7E,		// 'A' Latin Capital Letter A
+			0x7F,0x49,0x49,0x49,0x36,		// 'B' Latin Capital Letter B
+			0x3E,0x41,0x41,0x41,0x22,		// 'C' Latin Capital Letter C
+			0x7F,0x41,0x41,0x22,0x1C,		// 'D' Latin Capital Letter D
+			0x7F,0x49,0x49,0x49,0x41,		// 'E' Latin Capital Letter E
+			0x7F,0x09,0x09,0x09,0x01,		// 'F' Latin Capital Letter F
+			0x3E,0x41,0x49,0x49,0x7A,		// 'G' Latin Capital Letter G
+			0x7F,0x08,0x08,0x08,0x7F,		// 'H' Latin Capital Letter H
+			0x41,0x7F,0x41,		// 'I' Latin Capital Letter I
+			0x20,0x40,0x41,0x3F,0x01,		// 'J' Latin Capital Letter J
+			0x7F,0x08,0x14,0x22,0x41,		// 'K' Latin Capital Letter K
+			0x7F,0x40,0x40,0x40,0x40,		// 'L' Latin Capital Letter L
+			0x7F,0x02,0x0C,0x02,0x7F,		// 'M' Latin Capital Letter M
+			0x7F,0x04,0x08,0x10,0x7F,		// 'N' Latin Capital Letter N
+			0x3E,0x41,0x41,0x41,0x3E,		// 'O' Latin Capital Letter O
+			0x7F,0x09,0x09,0x09,0x06,		// 'P' Latin Capital Letter P
+			0x3E,0x41,0x51,0x21,0x5E,		// 'Q' Latin Capital Letter Q
+			0x7F,0x09,0x19,0x29,0x46,		// 'R' Latin Capital Letter R
+			0x46,0x49,0x49,0x49,0x31,		// 'S' Latin Capital Letter S
+			0x01,0x01,0x7F,0x01,0x01,		// 'T' Latin Capital Letter T
+			0x3F,0x40,0x40,0x40,0x3F,		// 'U' Latin Capital Letter U
+			0x1F,0x20,0x40,0x20,0x1F,		// 'V' Latin Capital Letter V
+			0x3F,0x40,0x38,0x40,0x3F,		// 'W' Latin Capital Letter W
+			0x63,0x14,0x08,0x14,0x63,		// 'X' Latin Capital Letter X
+			0x07,0x08,0x70,0x08,0x07,		// 'Y' Latin Capital Letter Y
+			0x61,0x51,0x49,0x45,0x43,		// 'Z' Latin Capital Letter Z
+			0x7F,0x41,0x41,		// '[' Left Square Bracket
+			0x02,0x04,0x08,0x10,0x20,		// U+005C Reverse Solidus
+			0x41,0x41,0x7F,		// ']' Right Square Bracket
+			0x04,0x02,0x01,0x02,0x04,		// '^' Circumflex Accent
+			0x40,0x40,0x40,0x40,0x40,		// '_' Low Line
+			0x01,0x02,0x04,		// '`' Grave Accent
+			0x20,0x54,0x54,0x54,0x78,		// 'a' Latin Small Letter A
+			0x7F,0x48,0x44,0x44,0x38,		// 'b' Latin Small Letter B
+			0x38,0x44,0x44,0x44,0x20,		// 'c' Latin Small Letter C
+			0x38,0x44,0x44,0x48,0x7F,		// 'd' Latin Small Letter D
+			0x38,0x54,0x54,0x54,0x18,		// 'e' Latin Small Letter E
+			0x08,0x7E,0x09,0x01,0x02,		// 'f' Latin Small Letter F
+			0x06,0x49,0x49,0x49,0x3F,		// 'g' Latin Small Letter G
+			0x7F,0x08,0x04,0x04,0x78,		// 'h' Latin Small Letter H
+			0x44,0x7D,0x40,		// 'i' Latin Small Letter I
+			0x20,0x40,0x44,0x3D,		// 'j' Latin Small Letter J
+			0x7F,0x10,0x28,0x44,		// 'k' Latin Small Letter K
+			0x41,0x7F,0x40,		// 'l' Latin Small Letter L
+			0x7C,0x04,0x18,0x04,0x7C,		// 'm' Latin Small Letter M
+			0x7C,0x08,0x04,0x04,0x78,		// 'n' Latin Small Letter N
+			0x38,0x44,0x44,0x44,0x38,		// 'o' Latin Small Letter O
+			0x7C,0x14,0x14,0x14,0x08,		// 'p' Latin Small Letter P
+			0x08,0x14,0x14,0x18,0x7C,		// 'q' Latin Small Letter Q
+			0x7C,0x08,0x04,0x04,0x08,		// 'r' Latin Small Letter R
+			0x48,0x54,0x54,0x54,0x20,		// 's' Latin Small Letter S
+			0x04,0x3F,0x44,0x40,0x20,		// 't' Latin Small Letter T
+			0x3C,0x40,0x40,0x20,0x7C,		// 'u' Latin Small Letter U
+			0x1C,0x20,0x40,0x20,0x1C,		// 'v' Latin Small Letter V
+			0x3C,0x40,0x30,0x40,0x3C,		// 'w' Latin Small Letter W
+			0x44,0x28,0x10,0x28,0x44,		// 'x' Latin Small Letter X
+			0x0C,0x50,0x50,0x50,0x3C,		// 'y' Latin Small Letter Y
+			0x44,0x64,0x54,0x4C,0x44,		// 'z' Latin Small Letter Z
+			0x08,0x36,0x41,		// '{' Left Curly Bracket
+			0x7F,		// '|' Vertical Line
+			0x41,0x36,0x08,		// '}' Right Curly Bracket
+			0x02,0x01,0x02,0x04,0x02,		// '~' Tilde
+		};
+
+		//! @brief		One glyph per character from 32 to 126: offset, width, advance.
+		constexpr fontGlyph_t fontProp5x7Glyphs[] =
+		{
+			{0, 0, 3},		// 32: U+0020 Space
+			{0, 1, 2},		// 33: '!' Exclamation Mark
+			{1, 3, 4},		// 34: '"' Quotation Mark
+			{4, 5, 6},		// 35: '#' Number Sign
+			{9, 5, 6},		// 36: '$' Dollar Sign
+			{14, 5, 6},		// 37: '%' Percent Sign
+			{19, 5, 6},		// 38: '&' Ampersand
+			{24, 2, 3},		// 39: ''' Apostrophe
+			{26, 3, 4},		// 40: '(' Left Parenthesis
+			{29, 3, 4},		// 41: ')' Right Parenthesis
+			{32, 5, 6},		// 42: '*' Asterisk
+			{37, 5, 6},		// 43: '+' Plus Sign
+			{42, 2, 3},		// 44: ',' Comma
+			{44, 5, 6},		// 45: '-' Hyphen-Minus
+			{49, 2, 3},		// 46: '.' Full Stop
+			{51, 5, 6},		// 47: '/' Solidus
+			{56, 5, 6},		// 48: '0' Digit Zero
+			{61, 3, 4},		// 49: '1' Digit One
+			{64, 5, 6},		// 50: '2' Digit Two
+			{69, 5, 6},		// 51: '3' Digit Three
+			{74, 5, 6},		// 52: '4' Digit Four
+			{79, 5, 6},		// 53: '5' Digit Five
+			{84, 5, 6},		// 54: '6' Digit Six
+			{89, 5, 6},		// 55: '7' Digit Seven
+			{94, 5, 6},		// 56: '8' Digit Eight
+			{99, 5, 6},		// 57: '9' Dight Nine
+			{104, 2, 3},		// 58: ':' Colon
+			{106, 2, 3},		// 59: ';' Semicolon
+			{108, 4, 5},		// 60: '<' Less-Than Sign
+			{112, 5, 6},		// 61: '=' Equals Sign
+			{117, 4, 5},		// 62: '>' Greater-Than Sign
+			{121, 5, 6},		// 63: '?' Question Mark
+			{126, 5, 6},		// 64: '@' Commercial At
+			{131, 5, 6},		// 65: 'A' Latin Capital Letter A
+			{136, 5, 6},		// 66: 'B' Latin Capital Letter B
+			{141, 5, 6},		// 67: 'C' Latin Capital Letter C
+			{146, 5, 6},		// 68: 'D' Latin Capital Letter D
+			{151, 5, 6},		// 69: 'E' Latin Capital Letter E
+			{156, 5, 6},		// 70: 'F' Latin Capital Letter F
+			{161, 5, 6},		// 71: 'G' Latin Capital Letter G
+			{166, 5, 6},		// 72: 'H' Latin Capital Letter H
+			{171, 3, 4},		// 73: 'I' Latin Capital Letter I
+			{174, 5, 6},		// 74: 'J' Latin Capital Letter J
+			{179, 5, 6},		// 75: 'K' Latin Capital Letter K
+			{184, 5, 6},		// 76: 'L' Latin Capital Letter L
+			{189, 5, 6},		// 77: 'M' Latin Capital Letter M
+			{194, 5, 6},		// 78: 'N' Latin Capital Letter N
+			{199, 5, 6},		// 79: 'O' Latin Capital Letter O
+			{204, 5, 6},		// 80: 'P' Latin Capital Letter P
+			{209, 5, 6},		// 81: 'Q' Latin Capital Letter Q
+			{214, 5, 6},		// 82: 'R' Latin Capital Letter R
+			{219, 5, 6},		// 83: 'S' Latin Capital Letter S
+			{224, 5, 6},		// 84: 'T' Latin Capital Letter T
+			{229, 5, 6},		// 85: 'U' Latin Capital Letter U
+			{234, 5, 6},		// 86: 'V' Latin Capital Letter V
+			{239, 5, 6},		// 87: 'W' Latin Capital Letter W
+			{244, 5, 6},		// 88: 'X' Latin Capital Letter X
+			{249, 5, 6},		// 89: 'Y' Latin Capital Letter Y
+			{254, 5, 6},		// 90: 'Z' Latin Capital Letter Z
+			{259, 3, 4},		// 91: '[' Left Square Bracket
+			{262, 5, 6},		// 92: U+005C Reverse Solidus
+			{267, 3, 4},		// 93: ']' Right Square Bracket
+			{270, 5, 6},		// 94: '^' Circumflex Accent
+			{275, 5, 6},		// 95: '_' Low Line
+			{280, 3, 4},		// 96: '`' Grave Accent
+			{283, 5, 6},		// 97: 'a' Latin Small Letter A
+			{288, 5, 6},		// 98: 'b' Latin Small Letter B
+			{293, 5, 6},		// 99: 'c' Latin Small Letter C
+			{298, 5, 6},		// 100: 'd' Latin Small Letter D
+			{303, 5, 6},		// 101: 'e' Latin Small Letter E
+			{308, 5, 6},		// 102: 'f' Latin Small Letter F
+			{313, 5, 6},		// 103: 'g' Latin Small Letter G
+			{318, 5, 6},		// 104: 'h' Latin Small Letter H
+			{323, 3, 4},		// 105: 'i' Latin Small Letter I
+			{326, 4, 5},		// 106: 'j' Latin Small Letter J
+			{330, 4, 5},		// 107: 'k' Latin Small Letter K
+			{334, 3, 4},		// 108: 'l' Latin Small Letter L
+			{337, 5, 6},		// 109: 'm' Latin Small Letter M
+			{342, 5, 6},		// 110: 'n' Latin Small Letter N
+			{347, 5, 6},		// 111: 'o' Latin Small Letter O
+			{352, 5, 6},		// 112: 'p' Latin Small Letter P
+			{357, 5, 6},		// 113: 'q' Latin Small Letter Q
+			{362, 5, 6},		// 114: 'r' Latin Small Letter R
+			{367, 5, 6},		// 115: 's' Latin Small Letter S
+			{372, 5, 6},		// 116: 't' Latin Small Letter T
+			{377, 5, 6},		// 117: 'u' Latin Small Letter U
+			{382, 5, 6},		// 118: 'v' Latin Small Letter V
+			{387, 5, 6},		// 119: 'w' Latin Small Letter W
+			{392, 5, 6},		// 120: 'x' Latin Small Letter X
+			{397, 5, 6},		// 121: 'y' Latin Small Letter Y
+			{402, 5, 6},		// 122: 'z' Latin Small Letter Z
+			{407, 3, 4},		// 123: '{' Left Curly Bracket
+			{410, 1, 2},		// 124: '|' Vertical Line
+			{411, 3, 4},		// 125: '}' Right Curly Bracket
+			{414, 5, 6},		// 126: '~' Tilde
+		};
+
+		//! @brief		Kerning pairs, sorted by left then right character.
+		constexpr fontKerningPair_t fontProp5x7KerningPairs[] =
+		{
+			{70, 44, -1},
+			{70, 46, -1},
+			{76, 84, -1},
+			{76, 86, -1},
+			{76, 89, -1},
+			{80, 44, -1},
+			{80, 46, -1},
+			{84, 44, -1},
+			{84, 46, -1},
+			{84, 97, -1},
+			{84, 101, -1},
+			{84, 111, -1},
+			{84, 114, -1},
+			{89, 44, -1},
+			{89, 46, -1},
+			{89, 97, -1},
+			{89, 101, -1},
+			{89, 111, -1},
+			{114, 44, -1},
+			{114, 46, -1},
+		};
+
+		//! @brief		The Prop5x7 font.
+		constexpr font_t fontProp5x7 =
+		{
+			fontProp5x7Bitmaps,
+			fontProp5x7Glyphs,
+			fontProp5x7KerningPairs,
+			20,		// numKerningPairs
+			32,		// firstChar
+			126,		// lastChar
+			32,		// defaultChar
+			8,		// height
+			1		// numPages
+		};
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_FONT_PROP5X7_H
+
+// EOF
@@ -0,0 +1,265 @@
+//!
+//! @file 				Symbols5x7.hpp
+//! @author 			Generated by tools/FontCompiler.py
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Symbols5x7 font (8 pixels high, fixed width), compiled from fonts/Ssd1306_5x7.bdf.
+//! @details
+//!						Do not edit, re-run the font compiler instead:
+//!						tools/FontCompiler.py fonts/Ssd1306_5x7.bdf --name Symbols5x7 --fixed --chars 0x391-0x3C9,0xFF66-0xFF9F --code-base 1
+
+#ifndef M_SSD1306_FONT_SYMBOLS5X7_H
+#define M_SSD1306_FONT_SYMBOLS5X7_H
+
+#include "../Font.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//! @brief		Glyph bitmaps, page-major, bit 0 at the top.
+		constexpr uint8 fontSymbols5x7Bitmaps[] =
+		{
+			0x7E,0x11,0x11,0x11,0x7E,		// U+0391 Greek Capital Letter Alpha
+			0x7F,0x49,0x49,0x49,0x36,		// U+0392 Greek Capital Letter Beta
+			0x7F,0x02,0x01,0x01,0x03,		// U+0393 Greek Capital Letter Gamma
+			0x70,0x4E,0x41,0x4E,0x70,		// U+0394 Greek Capital Letter Delta
+			0x7F,0x49,0x49,0x49,0x41,		// U+0395 Greek Capital Letter Epsilon
+			0x61,0x51,0x49,0x45,0x43,		// U+0396 Greek Capital Letter Zeta
+			0x7F,0x08,0x08,0x08,0x7F,		// U+0397 Greek Capital Letter Eta
+			0x3E,0x49,0x49,0x49,0x3E,		// U+0398 Greek Capital Letter Theta
+			0x00,0x41,0x7F,0x41,0x00,		// U+0399 Greek Capital Letter Iota
+			0x7F,0x08,0x14,0x22,0x41,		// U+039A Greek Capital Letter Kappa
+			0x70,0x0E,0x01,0x0E,0x70,		// U+039B Greek Capital Letter Lamda
+			0x7F,0x02,0x0C,0x02,0x7F,		// U+039C Greek Capital Letter Mu
+			0x7F,0x04,0x08,0x10,0x7F,		// U+039D Greek Capital Letter Nu
+			0x63,0x5D,0x49,0x5D,0x63,		// U+039E Greek Capital Letter Xi
+			0x3E,0x41,0x41,0x41,0x3E,		// U+039F Greek Capital Letter Omicron
+			0x41,0x3F,0x01,0x3F,0x41,		// U+03A0 Greek Capital Letter Pi
+			0x7F,0x09,0x09,0x09,0x06,		// U+03A1 Greek Capital Letter Rho
+			0x63,0x55,0x49,0x41,0x41,		// U+03A3 Greek Capital Letter Sigma
+			0x01,0x01,0x7F,0x01,0x01,		// U+03A4 Greek Capital Letter Tau
+			0x03,0x01,0x7E,0x01,0x03,		// U+03A5 Greek Capital Letter Upsilon
+			0x08,0x55,0x7F,0x55,0x08,		// U+03A6 Greek Capital Letter Phi
+			0x63,0x14,0x08,0x14,0x63,		// U+03A7 Greek Capital Letter Chi
+			0x07,0x48,0x7F,0x48,0x07,		// U+03A8 Greek Capital Letter Psi
+			0x5E,0x61,0x01,0x61,0x5E,		// U+03A9 Greek Capital Letter Omega
+			0x38,0x44,0x48,0x30,0x4C,		// U+03B1 Greek Small Letter Alpha
+			0x7C,0x2A,0x2A,0x2A,0x14,		// U+03B2 Greek Small Letter Beta
+			0x44,0x38,0x04,0x04,0x08,		// U+03B3 Greek Small Letter Gamma
+			0x30,0x4B,0x4D,0x59,0x30,		// U+03B4 Greek Small Letter Delta
+			0x28,0x54,0x54,0x44,0x20,		// U+03B5 Greek Small Letter Epsilon
+			0x00,0x18,0x55,0x52,0x22,		// U+03B6 Greek Small Letter Zeta
+			0x3E,0x04,0x02,0x02,0x7C,		// U+03B7 Greek Small Letter Eta
+			0x3C,0x4A,0x4A,0x4A,0x3C,		// U+03B8 Greek Small Letter Theta
+			0x00,0x3C,0x40,0x20,0x00,		// U+03B9 Greek Small Letter Iota
+			0x7C,0x10,0x28,0x44,0x40,		// U+03BA Greek Small Letter Kappa
+			0x41,0x32,0x0C,0x30,0x40,		// U+03BB Greek Small Letter Lamda
+			0x7E,0x20,0x20,0x10,0x3E,		// U+03BC Greek Small Letter Mu
+			0x1C,0x20,0x40,0x20,0x1C,		// U+03BD Greek Small Letter Nu
+			0x14,0x2B,0x2A,0x2A,0x60,		// U+03BE Greek Small Letter Xi
+			0x38,0x44,0x44,0x44,0x38,		// U+03BF Greek Small Letter Omicron
+			0x44,0x3C,0x04,0x7C,0x44,		// U+03C0 Greek Small Letter Pi
+			0x70,0x28,0x24,0x24,0x18,		// U+03C1 Greek Small Letter Rho
+			0x0C,0x12,0x12,0x52,0x60,		// U+03C2 Greek Small Letter Final Sigma
+			0x38,0x44,0x4C,0x54,0x24,		// U+03C3 Greek Small Letter Sigma
+			0x04,0x3C,0x44,0x20,0x00,		// U+03C4 Greek Small Letter Tau
+			0x3C,0x40,0x40,0x20,0x1C,		// U+03C5 Greek Small Letter Upsilon
+			0x18,0x24,0x7E,0x24,0x18,		// U+03C6 Greek Small Letter Phi
+			0x44,0x28,0x10,0x28,0x44,		// U+03C7 Greek Small Letter Chi
+			0x0C,0x10,0x7E,0x10,0x0C,		// U+03C8 Greek Small Letter Psi
+			0x38,0x44,0x30,0x44,0x38,		// U+03C9 Greek Small Letter Omega
+			0x0A,0x0A,0x4A,0x2A,0x1E,		// U+FF66 Katakana Letter Wo
+			0x04,0x44,0x34,0x14,0x0C,		// U+FF67 Katakana Letter Small A
+			0x20,0x10,0x78,0x04,0x00,		// U+FF68 Katakana Letter Small I
+			0x18,0x08,0x4C,0x48,0x38,		// U+FF69 Katakana Letter Small U
+			0x48,0x48,0x78,0x48,0x48,		// U+FF6A Katakana Letter Small E
+			0x48,0x28,0x18,0x7C,0x08,		// U+FF6B Katakana Letter Small O
+			0x08,0x7C,0x08,0x28,0x18,		// U+FF6C Katakana Letter Small Ya
+			0x40,0x48,0x48,0x78,0x40,		// U+FF6D Katakana Letter Small Yu
+			0x54,0x54,0x54,0x7C,0x00,		// U+FF6E Katakana Letter Small Yo
+			0x18,0x00,0x58,0x40,0x38,		// U+FF6F Katakana Letter Small Tu
+			0x08,0x08,0x08,0x08,0x08,		// U+FF70 Katakana-Hiragana Prolonged Sound Mark
+			0x01,0x41,0x3D,0x09,0x07,		// U+FF71 Katakana Letter A
+			0x10,0x08,0x7C,0x02,0x01,		// U+FF72 Katakana Letter I
+			0x0E,0x02,0x43,0x22,0x1E,		// U+FF73 Katakana Letter U
+			0x42,0x42,0x7E,0x42,0x42,		// U+FF74 Katakana Letter E
+			0x22,0x12,0x0A,0x7F,0x02,		// U+FF75 Katakana Letter O
+			0x42,0x3F,0x02,0x42,0x3E,		// U+FF76 Katakana Letter Ka
+			0x0A,0x0A,0x7F,0x0A,0x0A,		// U+FF77 Katakana Letter Ki
+			0x08,0x46,0x42,0x22,0x1E,		// U+FF78 Katakana Letter Ku
+			0x04,0x03,0x42,0x3E,0x02,		// U+FF79 Katakana Letter Ke
+			0x42,0x42,0x42,0x42,0x7E,		// U+FF7A Katakana Letter Ko
+			0x02,0x4F,0x22,0x1F,0x02,		// U+FF7B Katakana Letter Sa
+			0x4A,0x4A,0x40,0x20,0x1C,		// U+FF7C Katakana Letter Shi
+			0x42,0x22,0x12,0x2A,0x46,		// U+FF7D Katakana Letter Su
+			0x02,0x3F,0x42,0x4A,0x46,		// U+FF7E Katakana Letter Se
+			0x06,0x48,0x40,0x20,0x1E,		// U+FF7F Katakana Letter So
+			0x08,0x46,0x4A,0x32,0x1E,		// U+FF80 Katakana Letter Ta
+			0x0A,0x4A,0x3E,0x09,0x08,		// U+FF81 Katakana Letter Chi
+			0x0E,0x00,0x4E,0x20,0x1E,		// U+FF82 Katakana Letter Tsu
+			0x04,0x45,0x3D,0x05,0x04,		// U+FF83 Katakana Letter Te
+			0x00,0x7F,0x08,0x10,0x00,		// U+FF84 Katakana Letter To
+			0x44,0x24,0x1F,0x04,0x04,		// U+FF85 Katakana Letter Na
+			0x40,0x42,0x42,0x42,0x40,		// U+FF86 Katakana Letter Ni
+			0x42,0x2A,0x12,0x2A,0x06,		// U+FF87 Katakana Letter Nu
+			0x22,0x12,0x7B,0x16,0x22,		// U+FF88 Katakana Letter Ne
+			0x00,0x40,0x20,0x1F,0x00,		// U+FF89 Katakana Letter No
+			0x78,0x00,0x02,0x04,0x78,		// U+FF8A Katakana Letter Ha
+			0x3F,0x44,0x44,0x44,0x44,		// U+FF8B Katakana Letter Hi
+			0x02,0x42,0x42,0x22,0x1E,		// U+FF8C Katakana Letter Fu
+			0x04,0x02,0x04,0x08,0x30,		// U+FF8D Katakana Letter He
+			0x32,0x02,0x7F,0x02,0x32,		// U+FF8E Katakana Letter Ho
+			0x02,0x12,0x22,0x52,0x0E,		// U+FF8F Katakana Letter Ma
+			0x00,0x2A,0x2A,0x2A,0x40,		// U+FF90 Katakana Letter Mi
+			0x38,0x24,0x22,0x20,0x70,		// U+FF91 Katakana Letter Mu
+			0x40,0x28,0x10,0x28,0x06,		// U+FF92 Katakana Letter Me
+			0x0A,0x3E,0x4A,0x4A,0x4A,		// U+FF93 Katakana Letter Mo
+			0x04,0x7F,0x04,0x14,0x0C,		// U+FF94 Katakana Letter Ya
+			0x40,0x42,0x42,0x7E,0x40,		// U+FF95 Katakana Letter Yu
+			0x4A,0x4A,0x4A,0x4A,0x7E,		// U+FF96 Katakana Letter Yo
+			0x04,0x05,0x45,0x25,0x1C,		// U+FF97 Katakana Letter Ra
+			0x0F,0x40,0x20,0x1F,0x00,		// U+FF98 Katakana Letter Ri
+			0x7C,0x00,0x7E,0x40,0x30,		// U+FF99 Katakana Letter Ru
+			0x7E,0x40,0x20,0x10,0x08,		// U+FF9A Katakana Letter Re
+			0x7E,0x42,0x42,0x42,0x7E,		// U+FF9B Katakana Letter Ro
+			0x0E,0x02,0x42,0x22,0x1E,		// U+FF9C Katakana Letter Wa
+			0x42,0x42,0x40,0x20,0x18,		// U+FF9D Katakana Letter N
+			0x02,0x04,0x01,0x02,0x00,		// U+FF9E Katakana Voiced Sound Mark
+			0x07,0x05,0x07,0x00,0x00,		// U+FF9F Katakana Semi-Voiced Sound Mark
+		};
+
+		//! @brief		One glyph per character from 1 to 107: offset, width, advance.
+		constexpr fontGlyph_t fontSymbols5x7Glyphs[] =
+		{
+			{0, 5, 6},		// 1: U+0391 Greek Capital Letter Alpha
+			{5, 5, 6},		// 2: U+0392 Greek Capital Letter Beta
+			{10, 5, 6},		// 3: U+0393 Greek Capital Letter Gamma
+			{15, 5, 6},		// 4: U+0394 Greek Capital Letter Delta
+			{20, 5, 6},		// 5: U+0395 Greek Capital Letter Epsilon
+			{25, 5, 6},		// 6: U+0396 Greek Capital Letter Zeta
+			{30, 5, 6},		// 7: U+0397 Greek Capital Letter Eta
+			{35, 5, 6},		// 8: U+0398 Greek Capital Letter Theta
+			{40, 5, 6},		// 9: U+0399 Greek Capital Letter Iota
+			{45, 5, 6},		// 10: U+039A Greek Capital Letter Kappa
+			{50, 5, 6},		// 11: U+039B Greek Capital Letter Lamda
+			{55, 5, 6},		// 12: U+039C Greek Capital Letter Mu
+			{60, 5, 6},		// 13: U+039D Greek Capital Letter Nu
+			{65, 5, 6},		// 14: U+039E Greek Capital Letter Xi
+			{70, 5, 6},		// 15: U+039F Greek Capital Letter Omicron
+			{75, 5, 6},		// 16: U+03A0 Greek Capital Letter Pi
+			{80, 5, 6},		// 17: U+03A1 Greek Capital Letter Rho
+			{85, 5, 6},		// 18: U+03A3 Greek Capital Letter Sigma
+			{90, 5, 6},		// 19: U+03A4 Greek Capital Letter Tau
+			{95, 5, 6},		// 20: U+03A5 Greek Capital Letter Upsilon
+			{100, 5, 6},		// 21: U+03A6 Greek Capital Letter Phi
+			{105, 5, 6},		// 22: U+03A7 Greek Capital Letter Chi
+			{110, 5, 6},		// 23: U+03A8 Greek Capital Letter Psi
+			{115, 5, 6},		// 24: U+03A9 Greek Capital Letter Omega
+			{120, 5, 6},		// 25: U+03B1 Greek Small Letter Alpha
+			{125, 5, 6},		// 26: U+03B2 Greek Small Letter Beta
+			{130, 5, 6},		// 27: U+03B3 Greek Small Letter Gamma
+			{135, 5, 6},		// 28: U+03B4 Greek Small Letter Delta
+			{140, 5, 6},		// 29: U+03B5 Greek Small Letter Epsilon
+			{145, 5, 6},		// 30: U+03B6 Greek Small Letter Zeta
+			{150, 5, 6},		// 31: U+03B7 Greek Small Letter Eta
+			{155, 5, 6},		// 32: U+03B8 Greek Small Letter Theta
+			{160, 5, 6},		// 33: U+03B9 Greek Small Letter Iota
+			{165, 5, 6},		// 34: U+03BA Greek Small Letter Kappa
+			{170, 5, 6},		// 35: U+03BB Greek Small Letter Lamda
+			{175, 5, 6},		// 36: U+03BC Greek Small Letter Mu
+			{180, 5, 6},		// 37: U+03BD Greek Small Letter Nu
+			{185, 5, 6},		// 38: U+03BE Greek Small Letter Xi
+			{190, 5, 6},		// 39: U+03BF Greek Small Letter Omicron
+			{195, 5, 6},		// 40: U+03C0 Greek Small Letter Pi
+			{200, 5, 6},		// 41: U+03C1 Greek Small Letter Rho
+			{205, 5, 6},		// 42: U+03C2 Greek Small Letter Final Sigma
+			{210, 5, 6},		// 43: U+03C3 Greek Small Letter Sigma
+			{215, 5, 6},		// 44: U+03C4 Greek Small Letter Tau
+			{220, 5, 6},		// 45: U+03C5 Greek Small Letter Upsilon
+			{225, 5, 6},		// 46: U+03C6 Greek Small Letter Phi
+			{230, 5, 6},		// 47: U+03C7 Greek Small Letter Chi
+			{235, 5, 6},		// 48: U+03C8 Greek Small Letter Psi
+			{240, 5, 6},		// 49: U+03C9 Greek Small Letter Omega
+			{245, 5, 6},		// 50: U+FF66 Katakana Letter Wo
+			{250, 5, 6},		// 51: U+FF67 Katakana Letter Small A
+			{255, 5, 6},		// 52: U+FF68 Katakana Letter Small I
+			{260, 5, 6},		// 53: U+FF69 Katakana Letter Small U
+			{265, 5, 6},		// 54: U+FF6A Katakana Letter Small E
+			{270, 5, 6},		// 55: U+FF6B Katakana Letter Small O
+			{275, 5, 6},		// 56: U+FF6C Katakana Letter Small Ya
+			{280, 5, 6},		// 57: U+FF6D Katakana Letter Small Yu
+			{285, 5, 6},		// 58: U+FF6E Katakana Letter Small Yo
+			{290, 5, 6},		// 59: U+FF6F Katakana Letter Small Tu
+			{295, 5, 6},		// 60: U+FF70 Katakana-Hiragana Prolonged Sound Mark
+			{300, 5, 6},		// 61: U+FF71 Katakana Letter A
+			{305, 5, 6},		// 62: U+FF72 Katakana Letter I
+			{310, 5, 6},		// 63: U+FF73 Katakana Letter U
+			{315, 5, 6},		// 64: U+FF74 Katakana Letter E
+			{320, 5, 6},		// 65: U+FF75 Katakana Letter O
+			{325, 5, 6},		// 66: U+FF76 Katakana Letter Ka
+			{330, 5, 6},		// 67: U+FF77 Katakana Letter Ki
+			{335, 5, 6},		// 68: U+FF78 Katakana Letter Ku
+			{340, 5, 6},		// 69: U+FF79 Katakana Letter Ke
+			{345, 5, 6},		// 70: U+FF7A Katakana Letter Ko
+			{350, 5, 6},		// 71: U+FF7B Katakana Letter Sa
+			{355, 5, 6},		// 72: U+FF7C Katakana Letter Shi
+			{360, 5, 6},		// 73: U+FF7D Katakana Letter Su
+			{365, 5, 6},		// 74: U+FF7E Katakana Letter Se
+			{370, 5, 6},		// 75: U+FF7F Katakana Letter So
+			{375, 5, 6},		// 76: U+FF80 Katakana Letter Ta
+			{380, 5, 6},		// 77: U+FF81 Katakana Letter Chi
+			{385, 5, 6},		// 78: U+FF82 Katakana Letter Tsu
+			{390, 5, 6},		// 79: U+FF83 Katakana Letter Te
+			{395, 5, 6},		// 80: U+FF84 Katakana Letter To
+			{400, 5, 6},		// 81: U+FF85 Katakana Letter Na
+			{405, 5, 6},		// 82: U+FF86 Katakana Letter Ni
+			{410, 5, 6},		// 83: U+FF87 Katakana Letter Nu
+			{415, 5, 6},		// 84: U+FF88 Katakana Letter Ne
+			{420, 5, 6},		// 85: U+FF89 Katakana Letter No
+			{425, 5, 6},		// 86: U+FF8A Katakana Letter Ha
+			{430, 5, 6},		// 87: U+FF8B Katakana Letter Hi
+			{435, 5, 6},		// 88: U+FF8C Katakana Letter Fu
+			{440, 5, 6},		// 89: U+FF8D Katakana Letter He
+			{445, 5, 6},		// 90: U+FF8E Katakana Letter Ho
+			{450, 5, 6},		// 91: U+FF8F Katakana Letter Ma
+			{455, 5, 6},		// 92: U+FF90 Katakana Letter Mi
+			{460, 5, 6},		// 93: U+FF91 Katakana Letter Mu
+			{465, 5, 6},		// 94: U+FF92 Katakana Letter Me
+			{470, 5, 6},		// 95: U+FF93 Katakana Letter Mo
+			{475, 5, 6},		// 96: U+FF94 Katakana Letter Ya
+			{480, 5, 6},		// 97: U+FF95 Katakana Letter Yu
+			{485, 5, 6},		// 98: U+FF96 Katakana Letter Yo
+			{490, 5, 6},		// 99: U+FF97 Katakana Letter Ra
+			{495, 5, 6},		// 100: U+FF98 Katakana Letter Ri
+			{500, 5, 6},		// 101: U+FF99 Katakana Letter Ru
+			{505, 5, 6},		// 102: U+FF9A Katakana Letter Re
+			{510, 5, 6},		// 103: U+FF9B Katakana Letter Ro
+			{515, 5, 6},		// 104: U+FF9C Katakana Letter Wa
+			{520, 5, 6},		// 105: U+FF9D Katakana Letter N
+			{525, 5, 6},		// 106: U+FF9E Katakana Voiced Sound Mark
+			{530, 5, 6},		// 107: U+FF9F Katakana Semi-Voiced Sound Mark
+		};
+
+		//! @brief		The Symbols5x7 font.
+		constexpr font_t fontSymbols5x7 =
+		{
+			fontSymbols5x7Bitmaps,
+			fontSymbols5x7Glyphs,
+			NULL,
+			0,		// numKerningPairs
+			1,		// firstChar
+			107,		// lastChar
+			1,		// defaultChar
+			8,		// height
+			1		// numPages
+		};
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+#endif // #ifndef M_SSD1306_FONT_SYMBOLS5X7_H
+
+// EOF
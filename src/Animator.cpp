@@ -0,0 +1,297 @@
+//!
+//! @file 				Animator.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Runs contrast fades, start-line scrolls and blinks on an SSD1306 without blocking.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// System includes
+#include <stdint.h>		// int32_t
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/SSD1306.hpp"
+#include "../include/Animator.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//========================================== DEFINES ============================================//
+		//===============================================================================================//
+
+		//! @brief		Number of lines of GDDRAM the display start line wraps round.
+		#define animatorNUM_START_LINES			64
+
+		//===============================================================================================//
+		//===================================== GLOBAL FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		// See Doxygen documentation or function declarations in Animator.hpp for more info.
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		Animator<numCols, numRows, Transport>::Animator(Ssd1306<numCols, numRows, Transport> &ssd1306) :
+			ssd1306(ssd1306)
+		{
+			dirtyFlags = 0;
+
+			// As left by the init functions
+			contrast = ssd1306BRIGHTNESS;
+			startLine = 0;
+			isInverse = false;
+			isDisplayOn = true;
+
+			isRampRunning = false;
+			isOffAfterRamp = false;
+			isScrollRunning = false;
+			isBlinkRunning = false;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Animator<numCols, numRows, Transport>::StartContrastRamp(uint8 fromContrast, uint8 toContrast, uint16 durationMs, uint32 nowMs)
+		{
+			rampFromContrast = fromContrast;
+			rampToContrast = toContrast;
+			rampDurationMs = durationMs;
+			rampStartMs = nowMs;
+			isOffAfterRamp = false;
+			isRampRunning = true;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Animator<numCols, numRows, Transport>::StartFadeIn(uint16 durationMs, uint32 nowMs)
+		{
+			StartContrastRamp(0, ssd1306BRIGHTNESS, durationMs, nowMs);
+
+			// Contrast 0 goes out in the same transaction, so the panel doesn't flash up at full brightness
+			if(!isDisplayOn)
+			{
+				isDisplayOn = true;
+				dirtyFlags |= DIRTY_DISPLAY_ON;
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Animator<numCols, numRows, Transport>::StartFadeOut(uint16 durationMs, uint32 nowMs)
+		{
+			StartContrastRamp(ssd1306BRIGHTNESS, 0, durationMs, nowMs);
+			isOffAfterRamp = true;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Animator<numCols, numRows, Transport>::StartScroll(int8 rowsPerStep, uint16 stepIntervalMs, uint16 numSteps, uint32 nowMs)
+		{
+			scrollRowsPerStep = rowsPerStep;
+			scrollIntervalMs = (stepIntervalMs == 0) ? 1 : stepIntervalMs;
+			scrollNumSteps = numSteps;
+			scrollStartMs = nowMs;
+			scrollFromLine = startLine;
+			isScrollRunning = true;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Animator<numCols, numRows, Transport>::StartBlink(blinkMode_t blinkMode, uint16 periodMs, uint16 numBlinks, uint32 nowMs)
+		{
+			// Put back whatever the last blink changed, in case the mode is different
+			SetBlinkState(false, true);
+
+			this->blinkMode = blinkMode;
+			blinkPeriodMs = (periodMs < 2) ? 2 : periodMs;
+			blinkNumBlinks = numBlinks;
+			blinkStartMs = nowMs;
+			isBlinkRunning = true;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Animator<numCols, numRows, Transport>::StopContrastRamp()
+		{
+			isRampRunning = false;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Animator<numCols, numRows, Transport>::StopScroll()
+		{
+			isScrollRunning = false;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Animator<numCols, numRows, Transport>::StopBlink()
+		{
+			if(!isBlinkRunning)
+				return;
+
+			isBlinkRunning = false;
+			SetBlinkState(false, true);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		bool Animator<numCols, numRows, Transport>::IsRunning()
+		{
+			return isRampRunning || isScrollRunning || isBlinkRunning || (dirtyFlags != 0);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		uint8 Animator<numCols, numRows, Transport>::GetStartLine()
+		{
+			return startLine;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		bool Animator<numCols, numRows, Transport>::Tick(uint32 nowMs)
+		{
+			if(isRampRunning)
+				UpdateContrastRamp(nowMs);
+			if(isScrollRunning)
+				UpdateScroll(nowMs);
+			if(isBlinkRunning)
+				UpdateBlink(nowMs);
+
+			if(dirtyFlags == 0)
+				return false;
+
+			// Sending now would wait for the flush to finish, so leave it for the next tick
+			if(ssd1306.IsBusy())
+				return false;
+
+			// Everything that changed goes in one transaction. Display on goes first and display off
+			// last, so the other changes are never seen half done.
+			ssd1306.BeginCommandBatch();
+			if((dirtyFlags & DIRTY_DISPLAY_ON) && isDisplayOn)
+				ssd1306.ActivateDisplay();
+			if(dirtyFlags & DIRTY_CONTRAST)
+				ssd1306.SetContrastControl(contrast);
+			if(dirtyFlags & DIRTY_START_LINE)
+				ssd1306.SetStartLine(startLine);
+			if(dirtyFlags & DIRTY_INVERSE)
+				ssd1306.SetInverseDisplay(isInverse);
+			if((dirtyFlags & DIRTY_DISPLAY_ON) && !isDisplayOn)
+				ssd1306.DeactivateDisplay();
+			ssd1306.EndCommandBatch();
+
+			dirtyFlags = 0;
+
+			return true;
+		}
+
+		//===============================================================================================//
+		//===================================== PRIVATE FUNCTIONS =======================================//
+		//===============================================================================================//
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Animator<numCols, numRows, Transport>::UpdateContrastRamp(uint32 nowMs)
+		{
+			uint32 elapsedMs;
+			uint8 newContrast;
+
+			elapsedMs = nowMs - rampStartMs;
+
+			if(elapsedMs >= rampDurationMs)
+			{
+				newContrast = rampToContrast;
+				isRampRunning = false;
+
+				if(isOffAfterRamp && isDisplayOn)
+				{
+					isDisplayOn = false;
+					dirtyFlags |= DIRTY_DISPLAY_ON;
+				}
+			}
+			else
+			{
+				newContrast = (uint8)((int32_t)rampFromContrast +
+					((int32_t)rampToContrast - (int32_t)rampFromContrast)*(int32_t)elapsedMs/(int32_t)rampDurationMs);
+			}
+
+			if(newContrast != contrast)
+			{
+				contrast = newContrast;
+				dirtyFlags |= DIRTY_CONTRAST;
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Animator<numCols, numRows, Transport>::UpdateScroll(uint32 nowMs)
+		{
+			uint32 numSteps;
+			uint8 newStartLine;
+
+			numSteps = (nowMs - scrollStartMs)/scrollIntervalMs;
+
+			if((scrollNumSteps != 0) && (numSteps >= scrollNumSteps))
+			{
+				numSteps = scrollNumSteps;
+				isScrollRunning = false;
+			}
+
+			// Only the number of steps mod 64 matters, which keeps the sum small
+			numSteps %= animatorNUM_START_LINES;
+			newStartLine = (uint8)(((int32_t)scrollFromLine + (int32_t)numSteps*scrollRowsPerStep) & (animatorNUM_START_LINES - 1));
+
+			if(newStartLine != startLine)
+			{
+				startLine = newStartLine;
+				dirtyFlags |= DIRTY_START_LINE;
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Animator<numCols, numRows, Transport>::UpdateBlink(uint32 nowMs)
+		{
+			uint32 numHalfPeriods;
+			bool isBlinkOff;
+
+			numHalfPeriods = (nowMs - blinkStartMs)/(blinkPeriodMs/2);
+
+			if((blinkNumBlinks != 0) && (numHalfPeriods >= 2*(uint32)blinkNumBlinks))
+			{
+				isBlinkRunning = false;
+				SetBlinkState(false, true);
+				return;
+			}
+
+			// Off for the first half of each period
+			isBlinkOff = ((numHalfPeriods & 1) == 0);
+
+			if(blinkMode == BLINK_INVERT)
+				SetBlinkState(isBlinkOff, true);
+			else
+				SetBlinkState(false, !isBlinkOff);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Animator<numCols, numRows, Transport>::SetBlinkState(bool isInverse, bool isDisplayOn)
+		{
+			if(isInverse != this->isInverse)
+			{
+				this->isInverse = isInverse;
+				dirtyFlags |= DIRTY_INVERSE;
+			}
+
+			if(isDisplayOn != this->isDisplayOn)
+			{
+				this->isDisplayOn = isDisplayOn;
+				dirtyFlags |= DIRTY_DISPLAY_ON;
+			}
+		}
+
+		//===============================================================================================//
+		//=================================== EXPLICIT INSTANTIATIONS ===================================//
+		//===============================================================================================//
+
+		#define animatorINSTANTIATE_TRANSPORT(numCols, numRows, Transport)		template class Animator<numCols, numRows, Transport>;
+		#define animatorINSTANTIATE(numCols, numRows)		ssd1306TRANSPORTS(animatorINSTANTIATE_TRANSPORT, numCols, numRows)
+		ssd1306PANEL_SIZES(animatorINSTANTIATE)
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+// EOF
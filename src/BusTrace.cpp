@@ -0,0 +1,253 @@
+//!
+//! @file 				BusTrace.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Records the transactions the driver puts on the bus into a compact binary trace.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// System includes
+#if((MCU_PLATFORM == LINUX) || (MCU_PLATFORM == EMULATOR))
+	#include <stdio.h>
+#endif
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/BusTrace.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//========================================== DEFINES ============================================//
+		//===============================================================================================//
+
+		//! @brief		First 4 bytes of every trace.
+		static const uint8 busTraceMagic[4] = { 'S', 'S', 'D', 'T' };
+
+		//===============================================================================================//
+		//===================================== GLOBAL FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		// See Doxygen documentation or function declarations in BusTrace.hpp for more info.
+
+		BusTrace::BusTrace(uint8 *storage, uint32 storageSize)
+		{
+			this->storage = storage;
+			this->storageSize = storageSize;
+			Clear();
+		}
+
+		void BusTrace::Clear()
+		{
+			uint8 i;
+
+			length = 0;
+			numRecords = 0;
+			numDropped = 0;
+			lastTimeUs = Port::GetTimeUs();
+
+			// Too small for even the header, everything will be dropped
+			if(storageSize < busTraceHEADER_SIZE)
+				return;
+
+			for(i = 0; i < sizeof(busTraceMagic); i++)
+				storage[length++] = busTraceMagic[i];
+			storage[length++] = busTraceVERSION;
+			while(length < busTraceHEADER_SIZE)
+				storage[length++] = 0;
+		}
+
+		void BusTrace::Record(uint8 slaveAddress, uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors)
+		{
+			uint32 nowUs, deltaUs;
+			uint32 numBytes = 0;
+			uint32 recordSize;
+			uint16 byteIndex;
+			uint8 i;
+
+			nowUs = Port::GetTimeUs();
+			deltaUs = nowUs - lastTimeUs;
+
+			for(i = 0; i < numVectors; i++)
+			{
+				numBytes += vectors[i].numBytes;
+			}
+
+			// Once one has been dropped, the rest are too, so the trace has no gaps
+			recordSize = GetVarintSize(deltaUs) + 2 + GetVarintSize(numBytes) + numBytes;
+			if((length == 0) || (numDropped != 0) || (recordSize > storageSize - length))
+			{
+				numDropped++;
+				return;
+			}
+
+			WriteVarint(deltaUs);
+			storage[length++] = slaveAddress;
+			storage[length++] = controlByte;
+			WriteVarint(numBytes);
+			for(i = 0; i < numVectors; i++)
+			{
+				for(byteIndex = 0; byteIndex < vectors[i].numBytes; byteIndex++)
+				{
+					storage[length++] = vectors[i].data[byteIndex];
+				}
+			}
+
+			lastTimeUs = nowUs;
+			numRecords++;
+		}
+
+		const uint8* BusTrace::GetData() const
+		{
+			return storage;
+		}
+
+		uint32 BusTrace::GetLength() const
+		{
+			return length;
+		}
+
+		uint32 BusTrace::GetNumRecords() const
+		{
+			return numRecords;
+		}
+
+		uint32 BusTrace::GetNumDropped() const
+		{
+			return numDropped;
+		}
+
+		#if((MCU_PLATFORM == LINUX) || (MCU_PLATFORM == EMULATOR))
+			bool BusTrace::Save(const char *fileName) const
+			{
+				FILE *file;
+				bool isOk;
+
+				file = fopen(fileName, "wb");
+				if(file == NULL)
+					return false;
+
+				isOk = (fwrite(storage, 1, length, file) == length);
+
+				if(fclose(file) != 0)
+					isOk = false;
+
+				return isOk;
+			}
+		#endif
+
+		void BusTrace::WriteVarint(uint32 value)
+		{
+			while(value >= 0x80)
+			{
+				storage[length++] = (uint8)(value | 0x80);
+				value >>= 7;
+			}
+			storage[length++] = (uint8)value;
+		}
+
+		uint8 BusTrace::GetVarintSize(uint32 value)
+		{
+			uint8 size = 1;
+
+			while(value >= 0x80)
+			{
+				value >>= 7;
+				size++;
+			}
+
+			return size;
+		}
+
+		//===============================================================================================//
+		//======================================= BusTraceReader ========================================//
+		//===============================================================================================//
+
+		BusTraceReader::BusTraceReader(const uint8 *data, uint32 length)
+		{
+			this->data = data;
+			this->length = length;
+			Rewind();
+		}
+
+		bool BusTraceReader::IsValid() const
+		{
+			uint8 i;
+
+			if(length < busTraceHEADER_SIZE)
+				return false;
+
+			for(i = 0; i < sizeof(busTraceMagic); i++)
+			{
+				if(data[i] != busTraceMagic[i])
+					return false;
+			}
+
+			return (data[sizeof(busTraceMagic)] == busTraceVERSION);
+		}
+
+		bool BusTraceReader::Next(busTraceRecord_t &record)
+		{
+			uint32 deltaUs;
+			uint32 numBytes;
+
+			if(!IsValid())
+				return false;
+
+			if(!ReadVarint(deltaUs) || (length - position < 2))
+				return false;
+
+			record.slaveAddress = data[position++];
+			record.controlByte = data[position++];
+
+			if(!ReadVarint(numBytes) || (numBytes > length - position))
+				return false;
+
+			timeUs += deltaUs;
+			record.timeUs = timeUs;
+			record.data = &data[position];
+			record.numBytes = numBytes;
+			position += numBytes;
+
+			return true;
+		}
+
+		void BusTraceReader::Rewind()
+		{
+			position = busTraceHEADER_SIZE;
+			timeUs = 0;
+		}
+
+		bool BusTraceReader::ReadVarint(uint32 &value)
+		{
+			uint8 shift = 0;
+			uint8 byte;
+
+			value = 0;
+			do
+			{
+				// 5 bytes is enough for 32 bits
+				if((position >= length) || (shift > 28))
+					return false;
+
+				byte = data[position++];
+				value |= (uint32)(byte & 0x7F) << shift;
+				shift += 7;
+			} while(byte & 0x80);
+
+			return true;
+		}
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+// EOF
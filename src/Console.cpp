@@ -0,0 +1,320 @@
+//!
+//! @file 				Console.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Scrolling text console on an SSD1306, using the display start line to scroll.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/Font.hpp"
+#include "../include/SSD1306.hpp"
+#include "../include/Console.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//===================================== GLOBAL FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		// See Doxygen documentation or function declarations in Console.hpp for more info.
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		Console<numCols, numRows, Transport>::Console(Ssd1306<numCols, numRows, Transport> &ssd1306, const font_t &font, char *history, uint16 historySize) :
+			ssd1306(ssd1306),
+			font(font)
+		{
+			this->history = history;
+			numHistoryLines = historySize/consoleLINE_SIZE;
+
+			// The lines in view would share history entries, so don't use it at all
+			if(numHistoryLines < NUM_LINES)
+			{
+				numHistoryLines = 0;
+				#if(configDEBUG_SSD1306_ERROR == 1)
+					ssd1306.GetPort().PrintDebug("Console: Error. History is smaller than one screen, console does nothing.\r\n");
+				#endif
+			}
+
+			updateIntervalMs = consoleUPDATE_INTERVAL_MS;
+			lastUpdateMs = 0;
+			hasUpdated = false;
+
+			Clear();
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Console<numCols, numRows, Transport>::Putc(char character)
+		{
+			const fontGlyph_t *glyph;
+			char *text;
+			int16 width;
+
+			if((character == '\r') || (numHistoryLines == 0))
+				return;
+
+			if(character == '\n')
+			{
+				NewLine();
+				return;
+			}
+
+			glyph = FontGetGlyph(font, (uint8)character);
+
+			width = lastLineWidth;
+			if(lastLineLength != 0)
+			{
+				text = GetLine(lastLine);
+				width += FontGetKerning(font, (uint8)text[lastLineLength - 1], (uint8)character);
+				if(width < 0)
+					width = 0;
+
+				// Wrap if the glyph would be cut off, or the line is full
+				if((width + glyph->width > numCols) || (lastLineLength == consoleLINE_SIZE - 1))
+				{
+					NewLine();
+					width = 0;
+				}
+			}
+
+			text = GetLine(lastLine);
+			text[lastLineLength++] = character;
+			text[lastLineLength] = '\0';
+
+			width += glyph->advance;
+			lastLineWidth = (width > numCols) ? numCols : (uint8)width;
+
+			// Lines before it may not have been drawn yet either
+			if(lastLine < firstChangedLine)
+				firstChangedLine = lastLine;
+			isChanged = true;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Console<numCols, numRows, Transport>::Puts(const char *msg)
+		{
+			while(*msg != '\0')
+				Putc(*msg++);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Console<numCols, numRows, Transport>::Clear()
+		{
+			lastLine = 0;
+			lastLineLength = 0;
+			lastLineWidth = 0;
+			scrollBack = 0;
+			firstChangedLine = NO_LINE;
+
+			if(numHistoryLines != 0)
+				GetLine(0)[0] = '\0';
+
+			Redraw();
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Console<numCols, numRows, Transport>::ScrollBack(uint16 numLines)
+		{
+			scrollBack = (numLines > 0xFFFF - scrollBack) ? 0xFFFF : scrollBack + numLines;
+			LimitScrollBack();
+			isChanged = true;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Console<numCols, numRows, Transport>::ScrollForward(uint16 numLines)
+		{
+			scrollBack = (numLines < scrollBack) ? scrollBack - numLines : 0;
+			isChanged = true;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Console<numCols, numRows, Transport>::ScrollToEnd()
+		{
+			ScrollForward(scrollBack);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		uint16 Console<numCols, numRows, Transport>::GetScrollBack()
+		{
+			return scrollBack;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		bool Console<numCols, numRows, Transport>::IsValid()
+		{
+			return (numHistoryLines != 0);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Console<numCols, numRows, Transport>::SetUpdateInterval(uint16 intervalMs)
+		{
+			updateIntervalMs = intervalMs;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Console<numCols, numRows, Transport>::Redraw()
+		{
+			uint8 page;
+
+			// Blank pages aren't drawn again, so blank them all now
+			for(page = 0; page < NUM_LINES; page++)
+			{
+				ssd1306.frameBuffer.FillBytes(page, 0, 0x00, numCols);
+				pageLines[page] = NO_LINE;
+			}
+
+			// Not a valid start line, so the next update sends it
+			startLine = 0xFF;
+
+			isChanged = true;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		bool Console<numCols, numRows, Transport>::Tick(uint32 nowMs)
+		{
+			uint8 newStartLine;
+
+			if(!isChanged || (numHistoryLines == 0))
+				return false;
+
+			if(hasUpdated && (nowMs - lastUpdateMs < updateIntervalMs))
+				return false;
+
+			// Flush() would wait for the flush to finish, so leave it for the next tick
+			if(ssd1306.IsBusy())
+				return false;
+
+			newStartLine = Draw();
+
+			// The start line goes out in the same transaction as the cursor commands for the new
+			// line, ahead of it's data, so the line is drawn in at the bottom of the panel
+			ssd1306.BeginCommandBatch();
+			if(newStartLine != startLine)
+			{
+				ssd1306.SetStartLine(newStartLine);
+				startLine = newStartLine;
+			}
+			ssd1306.Flush();
+			ssd1306.EndCommandBatch();
+
+			isChanged = false;
+			lastUpdateMs = nowMs;
+			hasUpdated = true;
+
+			return true;
+		}
+
+		//===============================================================================================//
+		//===================================== PRIVATE FUNCTIONS =======================================//
+		//===============================================================================================//
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		char* Console<numCols, numRows, Transport>::GetLine(uint32 line)
+		{
+			return &history[(line % numHistoryLines)*consoleLINE_SIZE];
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Console<numCols, numRows, Transport>::NewLine()
+		{
+			lastLine++;
+			lastLineLength = 0;
+			lastLineWidth = 0;
+			GetLine(lastLine)[0] = '\0';
+
+			// Keep the view on the same lines while scrolled back
+			if(scrollBack != 0)
+			{
+				scrollBack++;
+				LimitScrollBack();
+			}
+
+			isChanged = true;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		uint32 Console<numCols, numRows, Transport>::GetOldestLine()
+		{
+			return (lastLine >= numHistoryLines) ? lastLine - numHistoryLines + 1 : 0;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Console<numCols, numRows, Transport>::LimitScrollBack()
+		{
+			uint32 maxScrollBack;
+
+			// Far enough back for the oldest line to be at the top of the panel
+			if(lastLine - GetOldestLine() >= NUM_LINES - 1)
+				maxScrollBack = lastLine - GetOldestLine() - (NUM_LINES - 1);
+			else
+				maxScrollBack = 0;
+
+			if(scrollBack > maxScrollBack)
+				scrollBack = (uint16)maxScrollBack;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		uint8 Console<numCols, numRows, Transport>::Draw()
+		{
+			uint32 bottomLine, topLine, line;
+			uint8 row, page, col;
+
+			bottomLine = lastLine - scrollBack;
+			topLine = (bottomLine >= NUM_LINES - 1) ? bottomLine - (NUM_LINES - 1) : 0;
+
+			for(row = 0; row < NUM_LINES; row++)
+			{
+				line = topLine + row;
+
+				// Each line has a fixed page in the ring when scrolling with the start line,
+				// otherwise the lines move up the frame buffer
+				page = IS_HARDWARE_SCROLL ? (uint8)(line % NUM_LINES) : row;
+
+				if(line > bottomLine)
+				{
+					if(pageLines[page] != NO_LINE)
+					{
+						ssd1306.frameBuffer.FillBytes(page, 0, 0x00, numCols);
+						pageLines[page] = NO_LINE;
+					}
+					continue;
+				}
+
+				if((pageLines[page] == line) && (line < firstChangedLine))
+					continue;
+
+				// Only the bytes that differ from what is already there get marked dirty
+				col = ssd1306.frameBuffer.DrawString(font, GetLine(line), page, 0);
+				if(col < numCols)
+					ssd1306.frameBuffer.FillBytes(page, col, 0x00, numCols - col);
+
+				pageLines[page] = line;
+			}
+
+			firstChangedLine = NO_LINE;
+
+			return IS_HARDWARE_SCROLL ? (uint8)((topLine % NUM_LINES)*8) : 0;
+		}
+
+		//===============================================================================================//
+		//=================================== EXPLICIT INSTANTIATIONS ===================================//
+		//===============================================================================================//
+
+		#define consoleINSTANTIATE_TRANSPORT(numCols, numRows, Transport)		template class Console<numCols, numRows, Transport>;
+		#define consoleINSTANTIATE(numCols, numRows)		ssd1306TRANSPORTS(consoleINSTANTIATE_TRANSPORT, numCols, numRows)
+		ssd1306PANEL_SIZES(consoleINSTANTIATE)
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+// EOF
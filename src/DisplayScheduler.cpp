@@ -0,0 +1,479 @@
+//!
+//! @file 				DisplayScheduler.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Flushes many SSD1306's spread over several buses, sharing each bus fairly.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// System includes
+#include <stdint.h>		// uint64_t
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/SSD1306.hpp"
+#include "../include/DisplayScheduler.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//====================================== PANEL FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		// Used through DisplayScheduler::panel_t, so panels of any size can be mixed
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		static bool SchedulerStartFlush(void *ssd1306)
+		{
+			return ((Ssd1306<numCols, numRows, Transport>*)ssd1306)->StartScheduledFlush();
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		static uint16 SchedulerGetNextSize(void *ssd1306)
+		{
+			return ((Ssd1306<numCols, numRows, Transport>*)ssd1306)->GetNextTransactionSize();
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		static uint8 SchedulerSendNext(void *ssd1306)
+		{
+			return ((Ssd1306<numCols, numRows, Transport>*)ssd1306)->SendNextTransaction();
+		}
+
+		//===============================================================================================//
+		//===================================== GLOBAL FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		// See Doxygen documentation or function declarations in DisplayScheduler.hpp for more info.
+
+		DisplayScheduler::DisplayScheduler()
+		{
+			uint8 bus;
+
+			numPanels = 0;
+
+			for(bus = 0; bus < schedulerMAX_BUSES; bus++)
+			{
+				currentPanel[bus] = 0;
+				isTurnStarted[bus] = false;
+			}
+
+			#if(MCU_PLATFORM == LINUX)
+				for(bus = 0; bus < schedulerMAX_BUSES; bus++)
+				{
+					workers[bus].scheduler = this;
+					workers[bus].bus = bus;
+					isWorkerStarted[bus] = false;
+				}
+				isExit = false;
+
+				pthread_mutex_init(&mutex, NULL);
+				pthread_cond_init(&cond, NULL);
+			#endif
+
+			ClearStats();
+		}
+
+		DisplayScheduler::~DisplayScheduler()
+		{
+			Wait();
+
+			#if(MCU_PLATFORM == LINUX)
+				uint8 bus;
+
+				Lock();
+				isExit = true;
+				pthread_cond_broadcast(&cond);
+				Unlock();
+
+				for(bus = 0; bus < schedulerMAX_BUSES; bus++)
+				{
+					if(isWorkerStarted[bus])
+						pthread_join(workerThreads[bus], NULL);
+				}
+
+				pthread_cond_destroy(&cond);
+				pthread_mutex_destroy(&mutex);
+			#endif
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		int8 DisplayScheduler::AddPanel(Ssd1306<numCols, numRows, Transport> &ssd1306, uint8 bus, uint8 weight)
+		{
+			panel_t *panel;
+			int8 panelIndex;
+
+			if(bus >= schedulerMAX_BUSES)
+				return -1;
+
+			Lock();
+
+			if(numPanels >= schedulerMAX_PANELS)
+			{
+				Unlock();
+				return -1;
+			}
+
+			panelIndex = numPanels;
+			panel = &panels[panelIndex];
+
+			// Keeps each turn to about one quantum, so long flushes are interleaved with the
+			// other panels on the bus. Never raised, the caller may have set a smaller limit
+			// for the bus adapter.
+			if(ssd1306.GetMaxTransactionSize() > schedulerQUANTUM_BYTES)
+				ssd1306.SetMaxTransactionSize(schedulerQUANTUM_BYTES);
+
+			panel->ssd1306 = &ssd1306;
+			panel->startFlush = &SchedulerStartFlush<numCols, numRows, Transport>;
+			panel->getNextSize = &SchedulerGetNextSize<numCols, numRows, Transport>;
+			panel->sendNext = &SchedulerSendNext<numCols, numRows, Transport>;
+			panel->bus = bus;
+			panel->weight = (weight == 0) ? 1 : weight;
+			panel->isPending = false;
+			panel->deficit = 0;
+
+			numPanels++;
+
+			Unlock();
+
+			return panelIndex;
+		}
+
+		bool DisplayScheduler::RequestFlush(uint8 panelIndex)
+		{
+			panel_t *panel;
+
+			if(panelIndex >= numPanels)
+				return false;
+
+			panel = &panels[panelIndex];
+
+			Lock();
+
+			if(panel->isPending)
+			{
+				Unlock();
+				return false;
+			}
+
+			#if(MCU_PLATFORM == LINUX)
+				// Nothing would ever send the frame without a worker, so leave the changes dirty
+				if(!StartWorker(panel->bus))
+				{
+					Unlock();
+					return false;
+				}
+			#endif
+
+			// Worker for this bus never touches a panel that isn't pending, so it's safe to
+			// collect the changes here
+			if(!panel->startFlush(panel->ssd1306))
+			{
+				Unlock();
+				return false;
+			}
+
+			panel->isPending = (panel->getNextSize(panel->ssd1306) != 0);
+
+			#if(MCU_PLATFORM == LINUX)
+				if(panel->isPending)
+					pthread_cond_broadcast(&cond);
+			#endif
+
+			Unlock();
+
+			return true;
+		}
+
+		uint8 DisplayScheduler::RequestFlushAll()
+		{
+			uint8 panelIndex;
+			uint8 numQueued = 0;
+
+			for(panelIndex = 0; panelIndex < numPanels; panelIndex++)
+			{
+				if(RequestFlush(panelIndex))
+					numQueued++;
+			}
+
+			return numQueued;
+		}
+
+		bool DisplayScheduler::IsPanelBusy(uint8 panelIndex)
+		{
+			bool isBusy;
+
+			if(panelIndex >= numPanels)
+				return false;
+
+			Lock();
+			isBusy = panels[panelIndex].isPending;
+			Unlock();
+
+			return isBusy;
+		}
+
+		void DisplayScheduler::Wait()
+		{
+			#if(MCU_PLATFORM == LINUX)
+				Lock();
+				while(IsAnyPending())
+					pthread_cond_wait(&cond, &mutex);
+				Unlock();
+			#else
+				while(Service())
+				{
+					// Keep going until every bus is idle
+				}
+			#endif
+		}
+
+		bool DisplayScheduler::Service()
+		{
+			#if(MCU_PLATFORM == LINUX)
+				// Worker threads do the sending
+				return false;
+			#else
+				uint8 bus;
+				int8 panelIndex;
+				bool isAnySent = false;
+
+				// One transaction per bus, as if the buses were running at the same time
+				for(bus = 0; bus < schedulerMAX_BUSES; bus++)
+				{
+					panelIndex = SelectPanel(bus);
+					if(panelIndex < 0)
+						continue;
+
+					SendTransaction(panelIndex, panels[panelIndex].getNextSize(panels[panelIndex].ssd1306));
+					isAnySent = true;
+				}
+
+				return isAnySent;
+			#endif
+		}
+
+		schedulerBusStats_t DisplayScheduler::GetBusStats(uint8 bus)
+		{
+			schedulerBusStats_t stats;
+
+			Lock();
+			stats = busStats[bus];
+			Unlock();
+
+			return stats;
+		}
+
+		uint16 DisplayScheduler::GetBusFps(uint8 bus)
+		{
+			schedulerBusStats_t stats;
+			uint32 elapsedMs;
+
+			stats = GetBusStats(bus);
+			elapsedMs = Port::GetTimeMs() - stats.startTimeMs;
+
+			if(elapsedMs == 0)
+				return 0;
+
+			// Rounded to the nearest frame
+			return (uint16)(((uint64_t)stats.numFrames*1000 + elapsedMs/2)/elapsedMs);
+		}
+
+		void DisplayScheduler::ClearStats()
+		{
+			uint8 bus;
+			uint32 nowMs;
+
+			nowMs = Port::GetTimeMs();
+
+			Lock();
+			for(bus = 0; bus < schedulerMAX_BUSES; bus++)
+			{
+				busStats[bus].numFrames = 0;
+				busStats[bus].numTransactions = 0;
+				busStats[bus].numBytes = 0;
+				busStats[bus].numErrors = 0;
+				busStats[bus].startTimeMs = nowMs;
+			}
+			Unlock();
+		}
+
+		//===============================================================================================//
+		//===================================== PRIVATE FUNCTIONS =======================================//
+		//===============================================================================================//
+
+		int8 DisplayScheduler::SelectPanel(uint8 bus)
+		{
+			panel_t *panel;
+			uint16 numBytes;
+			bool isAnyOnBus = false;
+			uint8 panelIndex;
+
+			for(panelIndex = 0; panelIndex < numPanels; panelIndex++)
+			{
+				if((panels[panelIndex].bus == bus) && panels[panelIndex].isPending)
+				{
+					isAnyOnBus = true;
+					break;
+				}
+			}
+
+			if(!isAnyOnBus)
+				return -1;
+
+			// Deficit round robin. Each panel gets a quantum of bytes when it's turn starts, and
+			// sends transactions until the next one doesn't fit. Unused bytes carry over to the
+			// next turn, so a transaction bigger than the quantum goes after a few turns. Ends,
+			// as the deficits of the waiting panels grow every time round.
+			while(true)
+			{
+				panel = &panels[currentPanel[bus]];
+
+				if((panel->bus == bus) && panel->isPending)
+				{
+					if(!isTurnStarted[bus])
+					{
+						panel->deficit += (uint32)schedulerQUANTUM_BYTES*panel->weight;
+						isTurnStarted[bus] = true;
+					}
+
+					numBytes = panel->getNextSize(panel->ssd1306);
+					if(numBytes <= panel->deficit)
+					{
+						panel->deficit -= numBytes;
+						return currentPanel[bus];
+					}
+				}
+				else if(panel->bus == bus)
+				{
+					// Idle panels don't save up bus time
+					panel->deficit = 0;
+				}
+
+				currentPanel[bus] = (currentPanel[bus] + 1) % numPanels;
+				isTurnStarted[bus] = false;
+			}
+		}
+
+		void DisplayScheduler::SendTransaction(uint8 panelIndex, uint16 numBytes)
+		{
+			panel_t *panel = &panels[panelIndex];
+			schedulerBusStats_t *stats = &busStats[panel->bus];
+			uint8 result;
+
+			result = panel->sendNext(panel->ssd1306);
+
+			Lock();
+
+			stats->numTransactions++;
+			stats->numBytes += numBytes;
+			if(result != Port::TRANSFER_OK)
+				stats->numErrors++;
+
+			if(panel->getNextSize(panel->ssd1306) == 0)
+			{
+				panel->isPending = false;
+				stats->numFrames++;
+
+				#if(MCU_PLATFORM == LINUX)
+					// Wake up Wait()
+					pthread_cond_broadcast(&cond);
+				#endif
+			}
+
+			Unlock();
+		}
+
+		bool DisplayScheduler::IsAnyPending()
+		{
+			uint8 panelIndex;
+
+			for(panelIndex = 0; panelIndex < numPanels; panelIndex++)
+			{
+				if(panels[panelIndex].isPending)
+					return true;
+			}
+
+			return false;
+		}
+
+		void DisplayScheduler::Lock()
+		{
+			#if(MCU_PLATFORM == LINUX)
+				pthread_mutex_lock(&mutex);
+			#endif
+		}
+
+		void DisplayScheduler::Unlock()
+		{
+			#if(MCU_PLATFORM == LINUX)
+				pthread_mutex_unlock(&mutex);
+			#endif
+		}
+
+		#if(MCU_PLATFORM == LINUX)
+			bool DisplayScheduler::StartWorker(uint8 bus)
+			{
+				if(isWorkerStarted[bus])
+					return true;
+
+				if(pthread_create(&workerThreads[bus], NULL, &DisplayScheduler::WorkerThreadMain, &workers[bus]) != 0)
+					return false;
+
+				isWorkerStarted[bus] = true;
+				return true;
+			}
+
+			void* DisplayScheduler::WorkerThreadMain(void *arg)
+			{
+				worker_t *worker = (worker_t*)arg;
+				DisplayScheduler *scheduler = worker->scheduler;
+				int8 panelIndex;
+				uint16 numBytes;
+
+				scheduler->Lock();
+
+				while(!scheduler->isExit)
+				{
+					panelIndex = scheduler->SelectPanel(worker->bus);
+					if(panelIndex < 0)
+					{
+						pthread_cond_wait(&scheduler->cond, &scheduler->mutex);
+						continue;
+					}
+
+					numBytes = scheduler->panels[panelIndex].getNextSize(scheduler->panels[panelIndex].ssd1306);
+
+					// Other buses (and RequestFlush()) carry on while this one is busy
+					scheduler->Unlock();
+					scheduler->SendTransaction(panelIndex, numBytes);
+					scheduler->Lock();
+				}
+
+				scheduler->Unlock();
+
+				return NULL;
+			}
+		#endif
+
+		//===============================================================================================//
+		//=================================== EXPLICIT INSTANTIATIONS ===================================//
+		//===============================================================================================//
+
+		#define displaySchedulerINSTANTIATE_TRANSPORT(numCols, numRows, Transport)		template int8 DisplayScheduler::AddPanel<numCols, numRows, Transport>(Ssd1306<numCols, numRows, Transport>&, uint8, uint8);
+		#define displaySchedulerINSTANTIATE(numCols, numRows)		ssd1306TRANSPORTS(displaySchedulerINSTANTIATE_TRANSPORT, numCols, numRows)
+		ssd1306PANEL_SIZES(displaySchedulerINSTANTIATE)
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+// EOF
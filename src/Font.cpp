@@ -0,0 +1,91 @@
+//!
+//! @file 				Font.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Runtime descriptor for the page-packed fonts made by tools/FontCompiler.py.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/Font.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//===================================== GLOBAL FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		// See Doxygen documentation or function declarations in Font.hpp for more info.
+
+		const fontGlyph_t* FontGetGlyph(const font_t &font, uint8 character)
+		{
+			const fontGlyph_t *glyph;
+
+			if((character >= font.firstChar) && (character <= font.lastChar))
+			{
+				glyph = &font.glyphs[character - font.firstChar];
+				if(glyph->advance != 0)
+					return glyph;
+			}
+
+			// The font compiler makes sure the default character exists
+			return &font.glyphs[font.defaultChar - font.firstChar];
+		}
+
+		int8 FontGetKerning(const font_t &font, uint8 left, uint8 right)
+		{
+			uint16 low = 0;
+			uint16 high = font.numKerningPairs;
+			uint16 mid;
+			uint16 key = ((uint16)left << 8) | right;
+			uint16 midKey;
+
+			// Binary search, the pairs are sorted by left then right
+			while(low < high)
+			{
+				mid = low + (high - low)/2;
+				midKey = ((uint16)font.kerningPairs[mid].left << 8) | font.kerningPairs[mid].right;
+
+				if(midKey == key)
+					return font.kerningPairs[mid].adjust;
+				else if(midKey < key)
+					low = mid + 1;
+				else
+					high = mid;
+			}
+
+			return 0;
+		}
+
+		uint16 FontGetStringWidth(const font_t &font, const char *msg)
+		{
+			int16 width = 0;
+			uint8 prevChar = 0;
+
+			while(*msg != 0)
+			{
+				if(prevChar != 0)
+					width += FontGetKerning(font, prevChar, (uint8)*msg);
+
+				width += FontGetGlyph(font, (uint8)*msg)->advance;
+				prevChar = (uint8)*msg;
+				msg++;
+			}
+
+			return (width < 0) ? 0 : (uint16)width;
+		}
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+// EOF
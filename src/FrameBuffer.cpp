@@ -0,0 +1,935 @@
+//!
+//! @file 				FrameBuffer.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Host-side (MCU RAM) copy of the SSD1306 GDDRAM, with dirty-region tracking.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// System includes
+#include <stdint.h>		// uint64_t
+#include <string.h>		// memcpy()
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/Font.hpp"
+#include "../include/GlyphCache.hpp"
+#include "../include/FrameBuffer.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//========================================== DEFINES ============================================//
+		//===============================================================================================//
+
+		//! @brief		Value of dirtyStartCol for a clean page (always greater than any dirtyEndCol).
+		#define frameBufferCLEAN_START_COL		(0xFF)
+
+		//===============================================================================================//
+		//===================================== GLOBAL FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		// See Doxygen documentation or function declarations in FrameBuffer.hpp for more info.
+
+		template<uint8 numCols, uint8 numRows>
+		FrameBuffer<numCols, numRows>::FrameBuffer()
+		{
+			uint8 page, col;
+
+			for(page = 0; page < NUM_PAGES; page++)
+			{
+				for(col = 0; col < NUM_COLS; col++)
+				{
+					buffer[page][col] = 0x00;
+				}
+			}
+
+			// Contents of the SSD1306 RAM are unknown at power-up
+			invalidateCount = 0;
+			Invalidate();
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::WriteByte(uint8 page, uint8 col, uint8 byteToWrite)
+		{
+			if((page >= NUM_PAGES) || (col >= NUM_COLS))
+				return;
+
+			if(buffer[page][col] != byteToWrite)
+			{
+				buffer[page][col] = byteToWrite;
+				MarkDirty(page, col, col);
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::WriteBytes(uint8 page, uint8 startCol, const uint8 *bytesToWrite, uint8 numBytes)
+		{
+			uint8 i;
+
+			if((page >= NUM_PAGES) || (startCol >= NUM_COLS))
+				return;
+
+			// Clip at the right-hand edge of the display
+			if(numBytes > (NUM_COLS - startCol))
+				numBytes = NUM_COLS - startCol;
+
+			for(i = 0; i < numBytes; i++)
+			{
+				if(buffer[page][startCol + i] != bytesToWrite[i])
+				{
+					buffer[page][startCol + i] = bytesToWrite[i];
+					MarkDirty(page, startCol + i, startCol + i);
+				}
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::WriteBytesMasked(uint8 page, uint8 startCol, const uint8 *bytesToWrite, uint8 mask, uint8 numBytes)
+		{
+			uint8 newByte;
+			uint8 i;
+
+			if((page >= NUM_PAGES) || (startCol >= NUM_COLS))
+				return;
+
+			// Clip at the right-hand edge of the display
+			if(numBytes > (NUM_COLS - startCol))
+				numBytes = NUM_COLS - startCol;
+
+			for(i = 0; i < numBytes; i++)
+			{
+				newByte = (buffer[page][startCol + i] & ~mask) | (bytesToWrite[i] & mask);
+				if(buffer[page][startCol + i] != newByte)
+				{
+					buffer[page][startCol + i] = newByte;
+					MarkDirty(page, startCol + i, startCol + i);
+				}
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::FillBytes(uint8 page, uint8 startCol, uint8 byteToFillWith, uint8 numBytes)
+		{
+			uint8 i;
+
+			if((page >= NUM_PAGES) || (startCol >= NUM_COLS))
+				return;
+
+			// Clip at the right-hand edge of the display
+			if(numBytes > (NUM_COLS - startCol))
+				numBytes = NUM_COLS - startCol;
+
+			for(i = 0; i < numBytes; i++)
+			{
+				if(buffer[page][startCol + i] != byteToFillWith)
+				{
+					buffer[page][startCol + i] = byteToFillWith;
+					MarkDirty(page, startCol + i, startCol + i);
+				}
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::Fill(uint8 byteToFillWith)
+		{
+			uint8 page;
+
+			for(page = 0; page < NUM_PAGES; page++)
+			{
+				FillBytes(page, 0, byteToFillWith, NUM_COLS);
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		uint8 FrameBuffer<numCols, numRows>::DrawString(const font_t &font, const char *msg, uint8 startPage, uint8 startCol)
+		{
+			uint8 run[NUM_COLS];
+			const fontGlyph_t *glyph;
+			const uint8 *bitmap;
+			const char *c;
+			uint8 prevChar;
+			uint8 maxLength;
+			uint8 runLength = 0;
+			uint8 page;
+			uint8 i;
+			int16 col;
+
+			if((startPage >= NUM_PAGES) || (startCol >= NUM_COLS))
+				return startCol;
+
+			maxLength = NUM_COLS - startCol;
+
+			// Each page of the text goes into the frame buffer (and out on the bus) as one run
+			for(page = 0; (page < font.numPages) && ((startPage + page) < NUM_PAGES); page++)
+			{
+				for(i = 0; i < maxLength; i++)
+					run[i] = 0x00;
+
+				col = 0;
+				prevChar = 0;
+
+				for(c = msg; (*c != 0) && (col < maxLength); c++)
+				{
+					if(prevChar != 0)
+					{
+						col += FontGetKerning(font, prevChar, (uint8)*c);
+						if(col < 0)
+							col = 0;
+					}
+
+					glyph = FontGetGlyph(font, (uint8)*c);
+					bitmap = &font.bitmaps[glyph->offset + page*glyph->width];
+
+					// OR rather than copy, so glyphs pulled together by kerning can overlap
+					for(i = 0; (i < glyph->width) && ((col + i) < maxLength); i++)
+						run[col + i] |= bitmap[i];
+
+					col += glyph->advance;
+					prevChar = (uint8)*c;
+				}
+
+				runLength = (col < maxLength) ? (uint8)col : maxLength;
+				WriteBytes(startPage + page, startCol, run, runLength);
+			}
+
+			return startCol + runLength;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::DrawBitmap(uint8 startRow, uint8 startCol, const uint8 *bitmap, uint8 width, uint8 height)
+		{
+			uint8 run[NUM_COLS];
+			uint8 numColsDrawn;
+			uint8 shift;
+			uint8 numSrcPages;
+			uint8 numDestPages;
+			uint8 firstPage;
+			uint8 page;
+			uint8 col;
+
+			if((startRow >= NUM_ROWS) || (startCol >= NUM_COLS) || (height == 0))
+				return;
+
+			// Clip at the right-hand edge, width is still the stride of the bitmap
+			numColsDrawn = (width > (NUM_COLS - startCol)) ? (NUM_COLS - startCol) : width;
+
+			firstPage = startRow/8;
+			shift = startRow%8;
+			numSrcPages = (height + 7)/8;
+			numDestPages = (shift + height + 7)/8;
+
+			for(page = 0; (page < numDestPages) && ((firstPage + page) < NUM_PAGES); page++)
+			{
+				// Bottom of the source page above, and top of the source page at the same index
+				for(col = 0; col < numColsDrawn; col++)
+				{
+					run[col] =
+						((page < numSrcPages) ? (uint8)(bitmap[page*width + col] << shift) : 0x00) |
+						(((page > 0) && (shift != 0)) ? (uint8)(bitmap[(page - 1)*width + col] >> (8 - shift)) : 0x00);
+				}
+
+				WriteBytesMasked(firstPage + page, startCol, run, GetRowMask(firstPage + page, startRow, height), numColsDrawn);
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::Blit(int16 startRow, int16 startCol, const uint8 *bitmap, uint8 width, uint8 height, rasterOp_t op, const uint8 *mask)
+		{
+			uint64_t heightMask;
+			uint64_t src;
+			uint64_t srcMask;
+			uint64_t dest;
+			uint64_t newDest;
+			uint64_t changed;
+			uint8 numSrcPages;
+			uint8 page;
+			int16 srcCol;
+			int16 col;
+
+			// A whole column has to fit in one 64-bit word
+			if(height > 64)
+				height = 64;
+
+			if((width == 0) || (height == 0) ||
+				(startRow >= NUM_ROWS) || ((startRow + height) <= 0) ||
+				(startCol >= NUM_COLS) || ((startCol + width) <= 0))
+				return;
+
+			numSrcPages = (height + 7)/8;
+			heightMask = (height == 64) ? ~(uint64_t)0 : (((uint64_t)1 << height) - 1);
+
+			for(srcCol = (startCol < 0) ? -startCol : 0; (srcCol < width) && ((startCol + srcCol) < NUM_COLS); srcCol++)
+			{
+				col = startCol + srcCol;
+
+				// Source column (and mask) as one word, bit 0 is the top row of the bitmap
+				src = 0;
+				srcMask = 0;
+				for(page = 0; page < numSrcPages; page++)
+				{
+					src |= (uint64_t)bitmap[page*width + srcCol] << (8*page);
+					if(mask != NULL)
+						srcMask |= (uint64_t)mask[page*width + srcCol] << (8*page);
+				}
+
+				if(mask == NULL)
+					srcMask = heightMask;
+				else
+					srcMask &= heightMask;
+
+				// Move it to the right rows, anything shifted off either end is clipped
+				if(startRow >= 0)
+				{
+					src <<= startRow;
+					srcMask <<= startRow;
+				}
+				else
+				{
+					src >>= -startRow;
+					srcMask >>= -startRow;
+				}
+
+				if(NUM_ROWS < 64)
+					srcMask &= ((uint64_t)1 << NUM_ROWS) - 1;
+
+				if(srcMask == 0)
+					continue;
+
+				dest = 0;
+				for(page = 0; page < NUM_PAGES; page++)
+					dest |= (uint64_t)buffer[page][col] << (8*page);
+
+				switch(op)
+				{
+					case ROP_OR:
+						newDest = dest | (src & srcMask);
+						break;
+					case ROP_AND:
+						newDest = dest & (src | ~srcMask);
+						break;
+					case ROP_XOR:
+						newDest = dest ^ (src & srcMask);
+						break;
+					case ROP_NOT:
+						newDest = (dest & ~srcMask) | (~src & srcMask);
+						break;
+					case ROP_COPY:
+					default:
+						newDest = (dest & ~srcMask) | (src & srcMask);
+						break;
+				}
+
+				// Only write back (and dirty) the bytes that changed
+				changed = newDest ^ dest;
+				for(page = 0; (page < NUM_PAGES) && (changed != 0); page++)
+				{
+					if(changed & 0xFF)
+					{
+						buffer[page][col] = (uint8)(newDest >> (8*page));
+						MarkDirty(page, col, col);
+					}
+					changed >>= 8;
+				}
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		uint8 FrameBuffer<numCols, numRows>::DrawStringAtRow(const font_t &font, const char *msg, uint8 startRow, uint8 startCol, const GlyphCache *cache)
+		{
+			uint8 run[NUM_COLS];
+			const fontGlyph_t *glyph;
+			const uint8 *bitmap;
+			const char *c;
+			uint8 prevChar;
+			uint8 maxLength;
+			uint8 runLength = 0;
+			uint8 shift;
+			uint8 numDestPages;
+			uint8 firstPage;
+			uint8 page;
+			uint8 i;
+			int16 col;
+
+			if((startRow >= NUM_ROWS) || (startCol >= NUM_COLS))
+				return startCol;
+
+			maxLength = NUM_COLS - startCol;
+			firstPage = startRow/8;
+			shift = startRow%8;
+			numDestPages = (shift + font.height + 7)/8;
+
+			if((cache != NULL) && !cache->Matches(font, shift))
+				cache = NULL;
+
+			for(page = 0; (page < numDestPages) && ((firstPage + page) < NUM_PAGES); page++)
+			{
+				for(i = 0; i < maxLength; i++)
+					run[i] = 0x00;
+
+				col = 0;
+				prevChar = 0;
+
+				for(c = msg; (*c != 0) && (col < maxLength); c++)
+				{
+					if(prevChar != 0)
+					{
+						col += FontGetKerning(font, prevChar, (uint8)*c);
+						if(col < 0)
+							col = 0;
+					}
+
+					glyph = FontGetGlyph(font, (uint8)*c);
+
+					if(cache != NULL)
+					{
+						// Already shifted, just copy
+						bitmap = &cache->GetGlyph(glyph)[page*glyph->width];
+						for(i = 0; (i < glyph->width) && ((col + i) < maxLength); i++)
+							run[col + i] |= bitmap[i];
+					}
+					else
+					{
+						bitmap = &font.bitmaps[glyph->offset];
+						for(i = 0; (i < glyph->width) && ((col + i) < maxLength); i++)
+						{
+							if(page < font.numPages)
+								run[col + i] |= (uint8)(bitmap[page*glyph->width + i] << shift);
+							if((page > 0) && (shift != 0))
+								run[col + i] |= (uint8)(bitmap[(page - 1)*glyph->width + i] >> (8 - shift));
+						}
+					}
+
+					col += glyph->advance;
+					prevChar = (uint8)*c;
+				}
+
+				runLength = (col < maxLength) ? (uint8)col : maxLength;
+				WriteBytesMasked(firstPage + page, startCol, run, GetRowMask(firstPage + page, startRow, font.height), runLength);
+			}
+
+			return startCol + runLength;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::SetPixel(uint8 row, uint8 col, colour_t colour)
+		{
+			PlotPixel(row, col, colour);
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		bool FrameBuffer<numCols, numRows>::GetPixel(uint8 row, uint8 col) const
+		{
+			if((row >= NUM_ROWS) || (col >= NUM_COLS))
+				return false;
+
+			return (buffer[row/8][col] >> (row%8)) & 0x01;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::DrawHLine(uint8 row, uint8 startCol, uint8 length, colour_t colour)
+		{
+			if(length == 0)
+				return;
+
+			FillRowSpan(row, startCol, (int16)startCol + length - 1, colour);
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::DrawVLine(uint8 startRow, uint8 col, uint8 length, colour_t colour)
+		{
+			if(length == 0)
+				return;
+
+			FillColumnSpan(col, startRow, (int16)startRow + length - 1, colour);
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::DrawLine(uint8 startRow, uint8 startCol, uint8 endRow, uint8 endCol, colour_t colour)
+		{
+			int16 row = startRow;
+			int16 col = startCol;
+			int16 runStart;
+			int16 rowStep = (endRow > startRow) ? 1 : -1;
+			int16 colStep = (endCol > startCol) ? 1 : -1;
+			int16 rowDelta = (endRow > startRow) ? (endRow - startRow) : (startRow - endRow);
+			int16 colDelta = (endCol > startCol) ? (endCol - startCol) : (startCol - endCol);
+			int16 error;
+			int16 i;
+
+			if(colDelta >= rowDelta)
+			{
+				// Shallow, the row changes at most once per column. Draw each row's run in one go.
+				error = colDelta/2;
+				runStart = col;
+				for(i = 0; i <= colDelta; i++)
+				{
+					error -= rowDelta;
+					if((error < 0) || (i == colDelta))
+					{
+						if(runStart <= col)
+							FillRowSpan(row, runStart, col, colour);
+						else
+							FillRowSpan(row, col, runStart, colour);
+
+						row += rowStep;
+						error += colDelta;
+						runStart = col + colStep;
+					}
+					col += colStep;
+				}
+			}
+			else
+			{
+				// Steep, the column changes at most once per row. Draw each column's run in one go.
+				error = rowDelta/2;
+				runStart = row;
+				for(i = 0; i <= rowDelta; i++)
+				{
+					error -= colDelta;
+					if((error < 0) || (i == rowDelta))
+					{
+						if(runStart <= row)
+							FillColumnSpan(col, runStart, row, colour);
+						else
+							FillColumnSpan(col, row, runStart, colour);
+
+						col += colStep;
+						error += rowDelta;
+						runStart = row + rowStep;
+					}
+					row += rowStep;
+				}
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::DrawRect(uint8 startRow, uint8 startCol, uint8 height, uint8 width, colour_t colour)
+		{
+			int16 endRow = (int16)startRow + height - 1;
+			int16 endCol = (int16)startCol + width - 1;
+
+			if((height == 0) || (width == 0))
+				return;
+
+			FillRowSpan(startRow, startCol, endCol, colour);
+			if(height > 1)
+				FillRowSpan(endRow, startCol, endCol, colour);
+
+			// Sides don't include the corners, so COLOUR_INVERT doesn't invert them twice
+			if(height > 2)
+			{
+				FillColumnSpan(startCol, startRow + 1, endRow - 1, colour);
+				if(width > 1)
+					FillColumnSpan(endCol, startRow + 1, endRow - 1, colour);
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::FillRect(uint8 startRow, uint8 startCol, uint8 height, uint8 width, colour_t colour)
+		{
+			uint8 page;
+			uint8 mask;
+
+			if((height == 0) || (width == 0) || (startRow >= NUM_ROWS) || (startCol >= NUM_COLS))
+				return;
+
+			if(width > (NUM_COLS - startCol))
+				width = NUM_COLS - startCol;
+
+			for(page = startRow/8; page < NUM_PAGES; page++)
+			{
+				mask = GetRowMask(page, startRow, height);
+				if(mask == 0x00)
+					break;
+
+				ApplyMask(page, startCol, width, mask, colour);
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::DrawCircle(uint8 centreRow, uint8 centreCol, uint8 radius, colour_t colour)
+		{
+			int16 centreRows[4] = { centreRow, centreRow, centreRow, centreRow };
+			int16 centreCols[4] = { centreCol, centreCol, centreCol, centreCol };
+			int16 x = radius;
+			int16 y = 0;
+			int16 error = 1 - x;
+
+			if(radius == 0)
+			{
+				PlotPixel(centreRow, centreCol, colour);
+				return;
+			}
+
+			// The four points on the axes
+			PlotPixel(centreRow - radius, centreCol, colour);
+			PlotPixel(centreRow + radius, centreCol, colour);
+			PlotPixel(centreRow, centreCol - radius, colour);
+			PlotPixel(centreRow, centreCol + radius, colour);
+
+			// Midpoint circle algorithm, one octant, mirrored into the other seven
+			while(true)
+			{
+				y++;
+				if(error < 0)
+					error += 2*y + 1;
+				else
+				{
+					x--;
+					error += 2*(y - x) + 1;
+				}
+
+				if(x < y)
+					break;
+
+				PlotArcPoints(centreRows, centreCols, x, y, colour);
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::FillCircle(uint8 centreRow, uint8 centreCol, uint8 radius, colour_t colour)
+		{
+			int16 x = radius;
+			int16 y = 0;
+			int16 error = 1 - x;
+
+			// Same steps as DrawCircle(), but each column is filled between the top and bottom of
+			// the circle. Columns centre +/- y are filled while stepping, columns centre +/- x just
+			// before x moves on (if they haven't been done as a y column).
+			while(x >= y)
+			{
+				FillColumnSpan((int16)centreCol - y, (int16)centreRow - x, (int16)centreRow + x, colour);
+				if(y != 0)
+					FillColumnSpan((int16)centreCol + y, (int16)centreRow - x, (int16)centreRow + x, colour);
+
+				y++;
+				if(error < 0)
+					error += 2*y + 1;
+				else
+				{
+					if(x > (y - 1))
+					{
+						FillColumnSpan((int16)centreCol - x, (int16)centreRow - (y - 1), (int16)centreRow + (y - 1), colour);
+						FillColumnSpan((int16)centreCol + x, (int16)centreRow - (y - 1), (int16)centreRow + (y - 1), colour);
+					}
+					x--;
+					error += 2*(y - x) + 1;
+				}
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::DrawRoundRect(uint8 startRow, uint8 startCol, uint8 height, uint8 width, uint8 radius, colour_t colour)
+		{
+			int16 endRow = (int16)startRow + height - 1;
+			int16 endCol = (int16)startCol + width - 1;
+			int16 centreRows[4];
+			int16 centreCols[4];
+			int16 x;
+			int16 y;
+			int16 error;
+
+			if((height == 0) || (width == 0))
+				return;
+
+			if(radius > (height - 1)/2)
+				radius = (height - 1)/2;
+			if(radius > (width - 1)/2)
+				radius = (width - 1)/2;
+
+			if(radius == 0)
+			{
+				DrawRect(startRow, startCol, height, width, colour);
+				return;
+			}
+
+			// Straight edges, up to and including the points where the corners start
+			FillRowSpan(startRow, startCol + radius, endCol - radius, colour);
+			FillRowSpan(endRow, startCol + radius, endCol - radius, colour);
+			FillColumnSpan(startCol, startRow + radius, endRow - radius, colour);
+			FillColumnSpan(endCol, startRow + radius, endRow - radius, colour);
+
+			// Top-left, top-right, bottom-left, bottom-right corner centres
+			centreRows[0] = centreRows[1] = startRow + radius;
+			centreRows[2] = centreRows[3] = endRow - radius;
+			centreCols[0] = centreCols[2] = startCol + radius;
+			centreCols[1] = centreCols[3] = endCol - radius;
+
+			x = radius;
+			y = 0;
+			error = 1 - x;
+			while(true)
+			{
+				y++;
+				if(error < 0)
+					error += 2*y + 1;
+				else
+				{
+					x--;
+					error += 2*(y - x) + 1;
+				}
+
+				if(x < y)
+					break;
+
+				PlotArcPoints(centreRows, centreCols, x, y, colour);
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		uint8 FrameBuffer<numCols, numRows>::ReadByte(uint8 page, uint8 col) const
+		{
+			if((page >= NUM_PAGES) || (col >= NUM_COLS))
+				return 0x00;
+
+			return buffer[page][col];
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		const uint8* FrameBuffer<numCols, numRows>::GetPage(uint8 page) const
+		{
+			return &buffer[page][0];
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		bool FrameBuffer<numCols, numRows>::IsDirty() const
+		{
+			uint8 page;
+
+			for(page = 0; page < NUM_PAGES; page++)
+			{
+				if(dirtyStartCol[page] <= dirtyEndCol[page])
+					return true;
+			}
+
+			return false;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		bool FrameBuffer<numCols, numRows>::GetDirtyRange(uint8 page, uint8 *startCol, uint8 *endCol) const
+		{
+			if((page >= NUM_PAGES) || (dirtyStartCol[page] > dirtyEndCol[page]))
+				return false;
+
+			*startCol = dirtyStartCol[page];
+			*endCol = dirtyEndCol[page];
+			return true;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::ClearDirty()
+		{
+			uint8 page;
+
+			for(page = 0; page < NUM_PAGES; page++)
+			{
+				dirtyStartCol[page] = frameBufferCLEAN_START_COL;
+				dirtyEndCol[page] = 0;
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::Invalidate()
+		{
+			uint8 page;
+
+			for(page = 0; page < NUM_PAGES; page++)
+			{
+				dirtyStartCol[page] = 0;
+				dirtyEndCol[page] = NUM_COLS - 1;
+			}
+
+			invalidateCount++;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		uint8 FrameBuffer<numCols, numRows>::GetInvalidateCount() const
+		{
+			return invalidateCount;
+		}
+
+		//===============================================================================================//
+		//====================================== PRIVATE FUNCTIONS ======================================//
+		//===============================================================================================//
+
+		template<uint8 numCols, uint8 numRows>
+		uint8 FrameBuffer<numCols, numRows>::GetRowMask(uint8 page, uint8 startRow, uint8 height)
+		{
+			uint16 first = startRow;
+			uint16 last = (uint16)startRow + height;
+			uint16 pageTop = (uint16)page*8;
+
+			// Clip the row range to this page
+			if(first < pageTop)
+				first = pageTop;
+			if(last > (pageTop + 8))
+				last = pageTop + 8;
+			if(first >= last)
+				return 0x00;
+
+			return (uint8)(((1u << (last - first)) - 1) << (first - pageTop));
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::ApplyMask(uint8 page, uint8 startCol, uint8 numBytes, uint8 mask, colour_t colour)
+		{
+			uint8 *bytes = &buffer[page][startCol];
+			uint32 mask32 = 0x01010101u*mask;
+			uint32 oldWord;
+			uint32 newWord;
+			uint8 oldByte;
+			uint8 newByte;
+			int16 firstChanged = -1;
+			int16 lastChanged = -1;
+			uint8 i;
+			uint8 j;
+
+			if(mask == 0x00)
+				return;
+
+			// Four columns at a time. memcpy() keeps this safe on cores that don't do unaligned
+			// loads, and compiles down to plain word loads/stores where they do.
+			for(i = 0; (i + 4) <= numBytes; i += 4)
+			{
+				memcpy(&oldWord, &bytes[i], 4);
+
+				if(colour == COLOUR_ON)
+					newWord = oldWord | mask32;
+				else if(colour == COLOUR_OFF)
+					newWord = oldWord & ~mask32;
+				else
+					newWord = oldWord ^ mask32;
+
+				if(newWord != oldWord)
+				{
+					memcpy(&bytes[i], &newWord, 4);
+
+					// Find which of the four bytes changed, so the dirty range stays exact
+					for(j = 0; j < 4; j++)
+					{
+						if(bytes[i + j] != ((const uint8*)&oldWord)[j])
+						{
+							if(firstChanged < 0)
+								firstChanged = i + j;
+							lastChanged = i + j;
+						}
+					}
+				}
+			}
+
+			// Up to three columns left over
+			for(; i < numBytes; i++)
+			{
+				oldByte = bytes[i];
+
+				if(colour == COLOUR_ON)
+					newByte = oldByte | mask;
+				else if(colour == COLOUR_OFF)
+					newByte = oldByte & ~mask;
+				else
+					newByte = oldByte ^ mask;
+
+				if(newByte != oldByte)
+				{
+					bytes[i] = newByte;
+					if(firstChanged < 0)
+						firstChanged = i;
+					lastChanged = i;
+				}
+			}
+
+			if(firstChanged >= 0)
+				MarkDirty(page, startCol + firstChanged, startCol + lastChanged);
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::FillRowSpan(int16 row, int16 startCol, int16 endCol, colour_t colour)
+		{
+			if((row < 0) || (row >= NUM_ROWS) || (endCol < 0) || (startCol >= NUM_COLS) || (startCol > endCol))
+				return;
+
+			if(startCol < 0)
+				startCol = 0;
+			if(endCol >= NUM_COLS)
+				endCol = NUM_COLS - 1;
+
+			ApplyMask(row/8, startCol, endCol - startCol + 1, 1 << (row%8), colour);
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::FillColumnSpan(int16 col, int16 startRow, int16 endRow, colour_t colour)
+		{
+			uint8 page;
+
+			if((col < 0) || (col >= NUM_COLS) || (endRow < 0) || (startRow >= NUM_ROWS) || (startRow > endRow))
+				return;
+
+			if(startRow < 0)
+				startRow = 0;
+			if(endRow >= NUM_ROWS)
+				endRow = NUM_ROWS - 1;
+
+			for(page = startRow/8; page <= endRow/8; page++)
+				ApplyMask(page, col, 1, GetRowMask(page, startRow, endRow - startRow + 1), colour);
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::PlotPixel(int16 row, int16 col, colour_t colour)
+		{
+			if((row < 0) || (row >= NUM_ROWS) || (col < 0) || (col >= NUM_COLS))
+				return;
+
+			ApplyMask(row/8, col, 1, 1 << (row%8), colour);
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::PlotArcPoints(const int16 *centreRows, const int16 *centreCols, int16 x, int16 y, colour_t colour)
+		{
+			uint8 quadrant;
+			int16 rowSign;
+			int16 colSign;
+
+			for(quadrant = 0; quadrant < 4; quadrant++)
+			{
+				rowSign = (quadrant & 0x02) ? 1 : -1;
+				colSign = (quadrant & 0x01) ? 1 : -1;
+
+				PlotPixel(centreRows[quadrant] + rowSign*y, centreCols[quadrant] + colSign*x, colour);
+
+				// On the diagonal both octants give the same point
+				if(x != y)
+					PlotPixel(centreRows[quadrant] + rowSign*x, centreCols[quadrant] + colSign*y, colour);
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameBuffer<numCols, numRows>::MarkDirty(uint8 page, uint8 startCol, uint8 endCol)
+		{
+			if(startCol < dirtyStartCol[page])
+				dirtyStartCol[page] = startCol;
+
+			if(endCol > dirtyEndCol[page])
+				dirtyEndCol[page] = endCol;
+		}
+
+		//===============================================================================================//
+		//=================================== EXPLICIT INSTANTIATIONS ===================================//
+		//===============================================================================================//
+
+		#define frameBufferINSTANTIATE(numCols, numRows)		template class FrameBuffer<numCols, numRows>;
+		ssd1306PANEL_SIZES(frameBufferINSTANTIATE)
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+// EOF
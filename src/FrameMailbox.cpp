@@ -0,0 +1,123 @@
+//!
+//! @file 				FrameMailbox.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Lock-free triple buffer for passing frames from a renderer to the flusher.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/FrameBuffer.hpp"
+#include "../include/FrameMailbox.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		using SSD1306Ns::Port;
+
+		//===============================================================================================//
+		//========================================== DEFINES ============================================//
+		//===============================================================================================//
+
+		//! @brief		Set in FrameMailbox::middleState when the middle frame hasn't been taken yet.
+		#define frameMailboxNEW_FRAME_BIT		(0x04)
+
+		//! @brief		Masks the frame index out of FrameMailbox::middleState.
+		#define frameMailboxINDEX_MASK			(0x03)
+
+		//===============================================================================================//
+		//===================================== GLOBAL FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		// See Doxygen documentation or function declarations in FrameMailbox.hpp for more info.
+
+		template<uint8 numCols, uint8 numRows>
+		FrameMailbox<numCols, numRows>::FrameMailbox()
+		{
+			backIndex = 0;
+			middleState = 1;
+			frontIndex = 2;
+
+			numFramesProduced = 0;
+			numFramesSent = 0;
+			numFramesDropped = 0;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		FrameBuffer<numCols, numRows>& FrameMailbox<numCols, numRows>::GetBackBuffer()
+		{
+			return frames[backIndex];
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void FrameMailbox<numCols, numRows>::Publish()
+		{
+			uint8 oldState;
+
+			// Hand over the finished frame, and take back whatever was in the middle
+			oldState = Port::AtomicExchange(&middleState, backIndex | frameMailboxNEW_FRAME_BIT);
+			backIndex = oldState & frameMailboxINDEX_MASK;
+
+			// Consumer never saw the frame that was in the middle
+			if(oldState & frameMailboxNEW_FRAME_BIT)
+				numFramesDropped++;
+
+			numFramesProduced++;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		const FrameBuffer<numCols, numRows>* FrameMailbox<numCols, numRows>::Acquire()
+		{
+			uint8 oldState;
+
+			// Only the producer sets the bit and only the consumer clears it, so if it's
+			// set here it is still set at the exchange below
+			if(!(middleState & frameMailboxNEW_FRAME_BIT))
+				return NULL;
+
+			oldState = Port::AtomicExchange(&middleState, frontIndex);
+			frontIndex = oldState & frameMailboxINDEX_MASK;
+
+			numFramesSent++;
+
+			return &frames[frontIndex];
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		uint32 FrameMailbox<numCols, numRows>::GetNumFramesProduced() const
+		{
+			return numFramesProduced;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		uint32 FrameMailbox<numCols, numRows>::GetNumFramesSent() const
+		{
+			return numFramesSent;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		uint32 FrameMailbox<numCols, numRows>::GetNumFramesDropped() const
+		{
+			return numFramesDropped;
+		}
+
+		//===============================================================================================//
+		//=================================== EXPLICIT INSTANTIATIONS ===================================//
+		//===============================================================================================//
+
+		#define frameMailboxINSTANTIATE(numCols, numRows)		template class FrameMailbox<numCols, numRows>;
+		ssd1306PANEL_SIZES(frameMailboxINSTANTIATE)
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+// EOF
@@ -0,0 +1,111 @@
+//!
+//! @file 				GlyphCache.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Copy of a font with every glyph shifted down to a given row within a page.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/Font.hpp"
+#include "../include/GlyphCache.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//===================================== GLOBAL FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		// See Doxygen documentation or function declarations in GlyphCache.hpp for more info.
+
+		GlyphCache::GlyphCache(uint8 *storage, uint16 storageSize)
+		{
+			this->storage = storage;
+			this->storageSize = storageSize;
+			font = NULL;
+			shift = 0;
+		}
+
+		uint16 GlyphCache::GetRequiredSize(const font_t &font)
+		{
+			const fontGlyph_t *glyph;
+			uint32 bitmapsSize = 0;
+			uint32 glyphEnd;
+			uint16 i;
+
+			// The font doesn't store the size of the bitmaps, so find the end of the last glyph
+			for(i = 0; i <= (font.lastChar - font.firstChar); i++)
+			{
+				glyph = &font.glyphs[i];
+				glyphEnd = glyph->offset + (uint32)glyph->width*font.numPages;
+				if(glyphEnd > bitmapsSize)
+					bitmapsSize = glyphEnd;
+			}
+
+			// Every glyph takes the same number of bytes per page, so offsets are multiples of numPages
+			bitmapsSize = bitmapsSize/font.numPages*(font.numPages + 1);
+
+			return (bitmapsSize > 0xFFFF) ? 0xFFFF : (uint16)bitmapsSize;
+		}
+
+		bool GlyphCache::Build(const font_t &font, uint8 shift)
+		{
+			const fontGlyph_t *glyph;
+			const uint8 *src;
+			uint8 *dest;
+			uint8 page;
+			uint8 col;
+			uint16 i;
+
+			this->font = NULL;
+
+			if((shift > 7) || (GetRequiredSize(font) > storageSize))
+				return false;
+
+			for(i = 0; i <= (font.lastChar - font.firstChar); i++)
+			{
+				glyph = &font.glyphs[i];
+				src = &font.bitmaps[glyph->offset];
+				dest = &storage[glyph->offset/font.numPages*(font.numPages + 1)];
+
+				// Glyphs that share a bitmap are just shifted twice into the same place
+				for(page = 0; page <= font.numPages; page++)
+				{
+					for(col = 0; col < glyph->width; col++)
+					{
+						dest[page*glyph->width + col] =
+							((page < font.numPages) ? (uint8)(src[page*glyph->width + col] << shift) : 0x00) |
+							(((page > 0) && (shift != 0)) ? (uint8)(src[(page - 1)*glyph->width + col] >> (8 - shift)) : 0x00);
+					}
+				}
+			}
+
+			this->font = &font;
+			this->shift = shift;
+			return true;
+		}
+
+		bool GlyphCache::Matches(const font_t &font, uint8 shift) const
+		{
+			return (this->font == &font) && (this->shift == shift);
+		}
+
+		const uint8* GlyphCache::GetGlyph(const fontGlyph_t *glyph) const
+		{
+			return &storage[glyph->offset/font->numPages*(font->numPages + 1)];
+		}
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+// EOF
@@ -3,7 +3,7 @@
 //! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
 //! @edited 			n/a
 //! @created			2013/06/11
-//! @last-modified 	2014/01/14
+//! @last-modified 	2026/10/16
 //! @brief 				Contains port specific functions for the SSD1306 library.
 //! @details
 //!						See the README in the repo root dir for more info.
@@ -13,22 +13,48 @@
 //===============================================================================================//
 
 #include "Config.h"
-#if(configINCLUDE_CAP_SENSE == 1)
+#include "../include/Port.hpp"
+#include "../include/Bus.hpp"
 
-#ifdef __cplusplus
-extern "C" {
-#endif
-	// PSoC includes
-	#include <device.h>
-#ifdef __cplusplus
-}
-#endif
+#if((MCU_PLATFORM != PSOC) || (configINCLUDE_CAP_SENSE == 1))
+
+#if(MCU_PLATFORM == PSOC)
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+		// PSoC includes
+		#include <device.h>
+	#ifdef __cplusplus
+	}
+	#endif
+
+	// User includes
+	#include "PublicObjects.h"
+	#include "./CapSense/include/CapSense.h"
+	#include "./UartDebug/include/UartDebug.h"
+#elif(MCU_PLATFORM == LINUX)
+	// System includes
+	#include <errno.h>
+	#include <fcntl.h>
+	#include <stdio.h>
+	#include <string.h>
+	#include <time.h>
+	#include <unistd.h>
+	#include <sys/ioctl.h>
+	#include <linux/gpio.h>
+	#include <linux/i2c.h>
+	#include <linux/i2c-dev.h>
+	#include <linux/spi/spidev.h>
+#elif(MCU_PLATFORM == EMULATOR)
+	// System includes
+	#include <stdio.h>
+	#include <time.h>
+
+	// User includes
+	#include "../include/Ssd1306Emulator.hpp"
 
-// User includes
-#include "PublicObjects.h"
-#include "./CapSense/include/CapSense.h"
-#include "./SSD1306/include/SSD1306.h"
-#include "./UartDebug/include/UartDebug.h"
+	using MbeddedNinja::MSsd1306::Ssd1306Emulator;
+#endif
 
 
 //===============================================================================================//
@@ -43,6 +69,17 @@ extern "C" {
 namespace SSD1306Ns
 {
 
+	#if(MCU_PLATFORM == PSOC)
+		//! @brief		Milli-seconds counted by PortSysTickCallback(), see Port::GetTimeMs().
+		static volatile uint32 portTimeMs = 0;
+
+		//! @brief		Called from the SysTick interrupt every milli-second.
+		static void PortSysTickCallback()
+		{
+			portTimeMs++;
+		}
+	#endif
+
 	//===============================================================================================//
 	//===================================== GLOBAL FUNCTIONS ========================================//
 	//===============================================================================================//
@@ -55,11 +92,237 @@ namespace SSD1306Ns
 		
 		#if(MCU_PLATFORM == PSOC)
 			i2cPort = i2cLeft;
+		#elif(MCU_PLATFORM == LINUX)
+			uint8 i;
+
+			i2cPort = i2cLeft;
+
+			// Default bus mapping, change with SetBusNumber()
+			busNumbers[i2cLeft] = 0;
+			busNumbers[i2cRight] = 1;
+
+			fds[i2cLeft] = -1;
+			fds[i2cRight] = -1;
+			ownsFd[i2cLeft] = false;
+			ownsFd[i2cRight] = false;
+			supportsI2c[i2cLeft] = true;
+			supportsI2c[i2cRight] = true;
+
+			maxMessageSize = portLINUX_DEFAULT_MAX_MSG_SIZE;
+			ioctlFunction = NULL;
+			byteBufferLength = 0;
+			byteBufferAddress = 0;
+
+			pthread_mutex_init(&asyncMutex, NULL);
+			pthread_cond_init(&asyncCond, NULL);
+			isAsyncThreadStarted = false;
+			isAsyncThreadExit = false;
+
+			// Default SPI mapping, change with SetSpiDevice(). There is no default D/C# pin.
+			spiBusNumbers[i2cLeft] = 0;
+			spiBusNumbers[i2cRight] = 0;
+			spiChipSelects[i2cLeft] = 0;
+			spiChipSelects[i2cRight] = 1;
+			spiSpeedHz = portLINUX_SPI_DEFAULT_SPEED_HZ;
+
+			for(i = i2cLeft; i <= i2cRight; i++)
+			{
+				spiFds[i] = -1;
+				ownsSpiFd[i] = false;
+				dcFds[i] = -1;
+				ownsDcFd[i] = false;
+				dcChipNumbers[i] = 0;
+				dcLines[i] = 0;
+				isDcGpioSet[i] = false;
+			}
+		#elif(MCU_PLATFORM == EMULATOR)
+			uint8 i;
+
+			i2cPort = i2cLeft;
+
+			for(i = 0; i < portEMULATOR_MAX_DEVICES; i++)
+			{
+				emulators[i2cLeft][i] = NULL;
+				emulators[i2cRight][i] = NULL;
+			}
+
+			currentEmulator = NULL;
+			totalDelayUs = 0;
 		#else
 			#warning No port-specific code for Port::Port() 
 		#endif
+
+		asyncTransactions = NULL;
+		asyncNumTransactions = 0;
+		asyncIndex = 0;
+		asyncSlaveAddress = 0;
+		asyncCallback = NULL;
+		asyncContext = NULL;
+		isAsyncBusy = false;
+		isAsyncCompleting = false;
+
+		interfaceType = INTERFACE_I2C;
+		dcLevels[i2cLeft] = -1;
+		dcLevels[i2cRight] = -1;
+	}
+
+	void Port::SetInterface(interface_t interfaceType)
+	{
+		this->interfaceType = interfaceType;
+	}
+
+	Port::interface_t Port::GetInterface()
+	{
+		return interfaceType;
+	}
+
+	uint8 Port::GetTransactionOverheadBytes()
+	{
+		// SPI has no address, and the control byte is replaced by the D/C# pin
+		if(interfaceType == INTERFACE_SPI)
+			return 0;
+
+		return 2;
 	}
 	
+	#if(MCU_PLATFORM == EMULATOR)
+		bool Port::AttachEmulator(i2cPort_t i2cPort, Ssd1306Emulator *emulator)
+		{
+			uint8 i;
+
+			for(i = 0; i < portEMULATOR_MAX_DEVICES; i++)
+			{
+				if(emulators[i2cPort][i] == NULL)
+				{
+					emulators[i2cPort][i] = emulator;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		uint32 Port::GetTotalDelayUs()
+		{
+			return totalDelayUs;
+		}
+	#endif
+	
+	#if(MCU_PLATFORM == LINUX)
+		Port::~Port()
+		{
+			uint8 i;
+
+			// Let the worker thread finish what it's sending, then stop it
+			if(isAsyncThreadStarted)
+			{
+				pthread_mutex_lock(&asyncMutex);
+				isAsyncThreadExit = true;
+				pthread_cond_broadcast(&asyncCond);
+				pthread_mutex_unlock(&asyncMutex);
+				pthread_join(asyncThread, NULL);
+			}
+
+			pthread_cond_destroy(&asyncCond);
+			pthread_mutex_destroy(&asyncMutex);
+
+			for(i = i2cLeft; i <= i2cRight; i++)
+			{
+				if(ownsFd[i] && (fds[i] >= 0))
+					close(fds[i]);
+				if(ownsSpiFd[i] && (spiFds[i] >= 0))
+					close(spiFds[i]);
+				if(ownsDcFd[i] && (dcFds[i] >= 0))
+					close(dcFds[i]);
+			}
+		}
+
+		void Port::SetBusNumber(i2cPort_t i2cPort, uint8 busNumber)
+		{
+			if(ownsFd[i2cPort] && (fds[i2cPort] >= 0))
+				close(fds[i2cPort]);
+
+			fds[i2cPort] = -1;
+			ownsFd[i2cPort] = false;
+			busNumbers[i2cPort] = busNumber;
+		}
+
+		void Port::SetFileDescriptor(i2cPort_t i2cPort, int fd, bool supportsI2c)
+		{
+			if(ownsFd[i2cPort] && (fds[i2cPort] >= 0))
+				close(fds[i2cPort]);
+
+			fds[i2cPort] = fd;
+			ownsFd[i2cPort] = false;
+			this->supportsI2c[i2cPort] = supportsI2c;
+		}
+
+		void Port::SetMaxMessageSize(uint16 maxMessageSize)
+		{
+			// Need room for the control byte and at least one byte of data
+			if(maxMessageSize < 2)
+				maxMessageSize = 2;
+
+			this->maxMessageSize = maxMessageSize;
+		}
+
+		void Port::SetIoctlFunction(ioctlFunction_t ioctlFunction)
+		{
+			this->ioctlFunction = ioctlFunction;
+		}
+
+		void Port::SetSpiDevice(i2cPort_t i2cPort, uint8 busNumber, uint8 chipSelect)
+		{
+			if(ownsSpiFd[i2cPort] && (spiFds[i2cPort] >= 0))
+				close(spiFds[i2cPort]);
+
+			spiFds[i2cPort] = -1;
+			ownsSpiFd[i2cPort] = false;
+			spiBusNumbers[i2cPort] = busNumber;
+			spiChipSelects[i2cPort] = chipSelect;
+		}
+
+		void Port::SetSpiFileDescriptor(i2cPort_t i2cPort, int fd)
+		{
+			if(ownsSpiFd[i2cPort] && (spiFds[i2cPort] >= 0))
+				close(spiFds[i2cPort]);
+
+			spiFds[i2cPort] = fd;
+			ownsSpiFd[i2cPort] = false;
+		}
+
+		void Port::SetSpiSpeedHz(uint32 speedHz)
+		{
+			spiSpeedHz = speedHz;
+		}
+
+		void Port::SetDcGpio(i2cPort_t i2cPort, uint8 chipNumber, uint8 line)
+		{
+			if(ownsDcFd[i2cPort] && (dcFds[i2cPort] >= 0))
+				close(dcFds[i2cPort]);
+
+			dcFds[i2cPort] = -1;
+			ownsDcFd[i2cPort] = false;
+			dcChipNumbers[i2cPort] = chipNumber;
+			dcLines[i2cPort] = line;
+			isDcGpioSet[i2cPort] = true;
+			dcLevels[i2cPort] = -1;
+		}
+
+		void Port::SetDcFileDescriptor(i2cPort_t i2cPort, int fd)
+		{
+			if(ownsDcFd[i2cPort] && (dcFds[i2cPort] >= 0))
+				close(dcFds[i2cPort]);
+
+			dcFds[i2cPort] = fd;
+			ownsDcFd[i2cPort] = false;
+			isDcGpioSet[i2cPort] = true;
+
+			// Don't know what level the line was left at
+			dcLevels[i2cPort] = -1;
+		}
+	#endif
+	
 
 	// I2C Wrapper Functions
 
@@ -67,8 +330,29 @@ namespace SSD1306Ns
 	void Port::I2cStart()
 	{
 		#if(MCU_PLATFORM == PSOC)
-			I2cCpLeft_Start();
-			I2cCpRight_Start();
+			if(interfaceType == INTERFACE_SPI)
+			{
+				SpimCpLeft_Start();
+				SpimCpRight_Start();
+			}
+			else
+			{
+				I2cCpLeft_Start();
+				I2cCpRight_Start();
+			}
+		#elif(MCU_PLATFORM == LINUX)
+			// Open the bus now rather than on the first transfer, so errors show up early
+			if(interfaceType == INTERFACE_SPI)
+			{
+				if(GetSpiFileDescriptor() < 0)
+					PrintDebug("SSD1306: Error. Could not open SPI device.\r\n");
+				if(GetDcFileDescriptor() < 0)
+					PrintDebug("SSD1306: Error. Could not get D/C GPIO line.\r\n");
+			}
+			else if(GetFileDescriptor() < 0)
+				PrintDebug("SSD1306: Error. Could not open I2C bus.\r\n");
+		#elif(MCU_PLATFORM == EMULATOR)
+			// Nothing to do
 		#else
 			#warning No port-specific code for Port::I2cStart() 
 		#endif
@@ -78,8 +362,16 @@ namespace SSD1306Ns
 	void Port::I2cEnableInt()
 	{
 		#if(MCU_PLATFORM == PSOC)
-			I2cCpLeft_EnableInt();
-			I2cCpRight_EnableInt();
+			// The SPI component enables it's own interrupt (if it has a software buffer) when started
+			if(interfaceType == INTERFACE_I2C)
+			{
+				I2cCpLeft_EnableInt();
+				I2cCpRight_EnableInt();
+			}
+		#elif(MCU_PLATFORM == LINUX)
+			// Nothing to do, the kernel driver handles interrupts
+		#elif(MCU_PLATFORM == EMULATOR)
+			// Nothing to do
 		#else
 			#warning No port-specific code for Port::I2cEnableInt() 
 		#endif
@@ -96,6 +388,22 @@ namespace SSD1306Ns
 				return I2cCpRight_MasterSendStart(slaveAddress, readWrite);
 			else
 				return 0;
+		#elif(MCU_PLATFORM == LINUX)
+			// The kernel needs whole messages, so bytes are collected until the stop
+			(void)readWrite;
+			byteBufferAddress = slaveAddress;
+			byteBufferLength = 0;
+			return 0;
+		#elif(MCU_PLATFORM == EMULATOR)
+			(void)readWrite;
+			currentEmulator = FindEmulator(slaveAddress);
+
+			// No device with this address, NACK
+			if(currentEmulator == NULL)
+				return TRANSFER_ERROR_START;
+
+			currentEmulator->Start();
+			return 0;
 		#else
 			#warning No port-specific code for Port::I2cMasterSendStart() 
 		#endif
@@ -112,6 +420,18 @@ namespace SSD1306Ns
 				return I2cCpRight_MasterWriteByte(byteToWrite);
 			else
 				return 0;
+		#elif(MCU_PLATFORM == LINUX)
+			if(byteBufferLength >= portLINUX_MSG_BUFFER_SIZE)
+				return TRANSFER_ERROR_BYTE;
+
+			byteBuffer[byteBufferLength++] = byteToWrite;
+			return 0;
+		#elif(MCU_PLATFORM == EMULATOR)
+			if(currentEmulator == NULL)
+				return TRANSFER_ERROR_BYTE;
+
+			currentEmulator->WriteByte(byteToWrite);
+			return 0;
 		#else
 			#warning No port-specific code for Port::I2cMasterWriteByte() 
 		#endif
@@ -128,11 +448,334 @@ namespace SSD1306Ns
 				return I2cCpRight_MasterSendStop();
 			else
 				return 0;
+		#elif(MCU_PLATFORM == LINUX)
+			uint8 result;
+
+			if(byteBufferLength == 0)
+				return 0;
+
+			// First byte written is the control byte
+			result = I2cMasterWriteBuffer(byteBufferAddress, byteBuffer[0], &byteBuffer[1], byteBufferLength - 1);
+			byteBufferLength = 0;
+			return result;
+		#elif(MCU_PLATFORM == EMULATOR)
+			if(currentEmulator != NULL)
+				currentEmulator->Stop();
+
+			currentEmulator = NULL;
+			return 0;
 		#else
 			#warning No port-specific code for Port::I2cMasterSendStop() 
 		#endif
 	}
 
+	uint8 Port::I2cMasterWriteBuffer(uint8 slaveAddress, uint8 controlByte, const uint8 *buffer, uint16 numBytes)
+	{
+		ioVector_t vector;
+
+		vector.data = buffer;
+		vector.numBytes = numBytes;
+
+		return I2cMasterWriteVectored(slaveAddress, controlByte, &vector, 1);
+	}
+
+	//! @details	Supports two I2C ports. The port is checked once, and then the
+	//!				inner loops call the PSoC API directly.
+	//! @private
+	uint8 Port::I2cMasterWriteVectored(uint8 slaveAddress, uint8 controlByte, const ioVector_t *vectors, uint8 numVectors)
+	{
+		// SPI has no addresses, and the control byte becomes the D/C# pin
+		if(interfaceType == INTERFACE_SPI)
+			return SpiWriteVectored((controlByte & portSPI_DC_BIT) != 0, vectors, numVectors);
+
+		#if(MCU_PLATFORM == PSOC)
+			if(i2cPort == i2cLeft)
+				return BusPsocI2cWrite<i2cLeft>(slaveAddress, controlByte, vectors, numVectors);
+			else if(i2cPort == i2cRight)
+				return BusPsocI2cWrite<i2cRight>(slaveAddress, controlByte, vectors, numVectors);
+
+			return TRANSFER_OK;
+		#elif(MCU_PLATFORM == LINUX)
+			int fd;
+
+			fd = GetFileDescriptor();
+			if(fd < 0)
+				return TRANSFER_ERROR_START;
+
+			// Adapters that can only do SMBus (e.g. i2c-stub) get a different path
+			if(!supportsI2c[i2cPort])
+				return SendSmbusBlocks(fd, slaveAddress, controlByte, vectors, numVectors);
+
+			return BusI2cDevWrite(fd, ioctlFunction, msgBuffer, maxMessageSize, slaveAddress, controlByte, vectors, numVectors);
+		#elif(MCU_PLATFORM == EMULATOR)
+			Ssd1306Emulator *emulator;
+			uint8 vectorIndex;
+			uint16 byteIndex;
+
+			emulator = FindEmulator(slaveAddress);
+
+			// No device with this address, NACK
+			if(emulator == NULL)
+				return TRANSFER_ERROR_START;
+
+			emulator->Start();
+			emulator->WriteByte(controlByte);
+
+			for(vectorIndex = 0; vectorIndex < numVectors; vectorIndex++)
+			{
+				for(byteIndex = 0; byteIndex < vectors[vectorIndex].numBytes; byteIndex++)
+				{
+					emulator->WriteByte(vectors[vectorIndex].data[byteIndex]);
+				}
+			}
+
+			emulator->Stop();
+
+			return TRANSFER_OK;
+		#else
+			#warning No port-specific code for Port::I2cMasterWriteVectored() 
+		#endif
+	}
+
+	//! @details	Supports two SPI ports. The port is checked once, and then the
+	//!				inner loops call the PSoC API directly.
+	uint8 Port::SpiWriteVectored(bool isData, const ioVector_t *vectors, uint8 numVectors)
+	{
+		#if(MCU_PLATFORM == PSOC)
+			uint8 vectorIndex;
+			uint16 byteIndex;
+			uint8 result;
+
+			result = SetDcPin(isData);
+			if(result != TRANSFER_OK)
+				return result;
+
+			// WriteTxData() waits while the TX FIFO is full
+			if(i2cPort == i2cLeft)
+			{
+				for(vectorIndex = 0; vectorIndex < numVectors; vectorIndex++)
+				{
+					for(byteIndex = 0; byteIndex < vectors[vectorIndex].numBytes; byteIndex++)
+					{
+						SpimCpLeft_WriteTxData(vectors[vectorIndex].data[byteIndex]);
+					}
+				}
+			}
+			else if(i2cPort == i2cRight)
+			{
+				for(vectorIndex = 0; vectorIndex < numVectors; vectorIndex++)
+				{
+					for(byteIndex = 0; byteIndex < vectors[vectorIndex].numBytes; byteIndex++)
+					{
+						SpimCpRight_WriteTxData(vectors[vectorIndex].data[byteIndex]);
+					}
+				}
+			}
+
+			return TRANSFER_OK;
+		#elif(MCU_PLATFORM == LINUX)
+			uint8 result;
+			int fd;
+
+			fd = GetSpiFileDescriptor();
+			if(fd < 0)
+				return TRANSFER_ERROR_START;
+
+			result = SetDcPin(isData);
+			if(result != TRANSFER_OK)
+				return result;
+
+			return BusSpidevWrite(fd, ioctlFunction, vectors, numVectors);
+		#elif(MCU_PLATFORM == EMULATOR)
+			Ssd1306Emulator *emulator;
+			uint8 vectorIndex;
+			uint16 byteIndex;
+
+			// Nothing on the bus, there is no ACK on SPI but this is as close as it gets
+			emulator = emulators[i2cPort][0];
+			if(emulator == NULL)
+				return TRANSFER_ERROR_START;
+
+			SetDcPin(isData);
+			emulator->Select();
+
+			for(vectorIndex = 0; vectorIndex < numVectors; vectorIndex++)
+			{
+				for(byteIndex = 0; byteIndex < vectors[vectorIndex].numBytes; byteIndex++)
+				{
+					emulator->WriteSpiByte(vectors[vectorIndex].data[byteIndex]);
+				}
+			}
+
+			return TRANSFER_OK;
+		#else
+			#warning No port-specific code for Port::SpiWriteVectored() 
+		#endif
+	}
+
+	uint8 Port::I2cMasterStartWrite(
+		uint8 slaveAddress,
+		const ioVector_t *transactions,
+		uint8 numTransactions,
+		writeCompleteCallback_t callback,
+		void *context)
+	{
+		if(I2cMasterIsWriteBusy())
+			return TRANSFER_BUSY;
+
+		asyncSlaveAddress = slaveAddress;
+		asyncTransactions = transactions;
+		asyncNumTransactions = numTransactions;
+		asyncIndex = 0;
+		asyncCallback = callback;
+		asyncContext = context;
+
+		if(numTransactions == 0)
+		{
+			if(callback != NULL)
+				callback(context, TRANSFER_OK);
+			return TRANSFER_OK;
+		}
+
+		// If started from the callback of the last write, that write is finished now
+		#if(MCU_PLATFORM == PSOC)
+			isAsyncCompleting = false;
+			isAsyncBusy = true;
+			StartAsyncTransaction();
+		#elif(MCU_PLATFORM == LINUX)
+			pthread_mutex_lock(&asyncMutex);
+
+			if(!isAsyncThreadStarted)
+			{
+				if(pthread_create(&asyncThread, NULL, &Port::AsyncThreadMain, this) != 0)
+				{
+					pthread_mutex_unlock(&asyncMutex);
+					return TRANSFER_ERROR_START;
+				}
+				isAsyncThreadStarted = true;
+			}
+
+			isAsyncCompleting = false;
+			isAsyncBusy = true;
+			pthread_cond_broadcast(&asyncCond);
+			pthread_mutex_unlock(&asyncMutex);
+		#elif(MCU_PLATFORM == EMULATOR)
+			isAsyncCompleting = false;
+			isAsyncBusy = true;
+			StartAsyncTransaction();
+		#else
+			#warning No port-specific code for Port::I2cMasterStartWrite() 
+		#endif
+
+		return TRANSFER_OK;
+	}
+
+	bool Port::I2cMasterIsWriteBusy()
+	{
+		#if(MCU_PLATFORM == LINUX)
+			bool isBusy;
+
+			pthread_mutex_lock(&asyncMutex);
+			isBusy = isAsyncBusy;
+			// Only the callback, on the worker thread, sees the write as finished while it's running
+			if(isAsyncCompleting && pthread_equal(pthread_self(), asyncThread))
+				isBusy = false;
+			pthread_mutex_unlock(&asyncMutex);
+
+			return isBusy;
+		#else
+			// Nothing else runs while the callback does (bar interrupts), so it must be asking
+			return isAsyncBusy && !isAsyncCompleting;
+		#endif
+	}
+
+	void Port::I2cMasterServiceWrite()
+	{
+		#if(MCU_PLATFORM == PSOC)
+			uint32 status;
+
+			// Callback is still running, it may start the next write
+			if(!isAsyncBusy || isAsyncCompleting)
+				return;
+
+			if(interfaceType == INTERFACE_SPI)
+			{
+				// Nothing can go wrong, just wait for the last byte to go out
+				if(!IsSpiIdle())
+					return;
+			}
+			else if(i2cPort == i2cLeft)
+			{
+				status = I2cCpLeft_MasterStatus();
+				if(!(status & I2cCpLeft_MSTAT_WR_CMPLT))
+					return;
+
+				if(status & I2cCpLeft_MSTAT_ERR_XFER)
+				{
+					FinishAsyncWrite((status & I2cCpLeft_MSTAT_ERR_ADDR_NAK) ? TRANSFER_ERROR_START : TRANSFER_ERROR_BYTE);
+					return;
+				}
+			}
+			else if(i2cPort == i2cRight)
+			{
+				status = I2cCpRight_MasterStatus();
+				if(!(status & I2cCpRight_MSTAT_WR_CMPLT))
+					return;
+
+				if(status & I2cCpRight_MSTAT_ERR_XFER)
+				{
+					FinishAsyncWrite((status & I2cCpRight_MSTAT_ERR_ADDR_NAK) ? TRANSFER_ERROR_START : TRANSFER_ERROR_BYTE);
+					return;
+				}
+			}
+
+			if(++asyncIndex >= asyncNumTransactions)
+				FinishAsyncWrite(TRANSFER_OK);
+			else
+				StartAsyncTransaction();
+		#elif(MCU_PLATFORM == LINUX)
+			// Worker thread does all the work
+		#elif(MCU_PLATFORM == EMULATOR)
+			uint8 result;
+
+			if(!isAsyncBusy || isAsyncCompleting)
+				return;
+
+			// The emulator has no interrupt, the "hardware" sends the current transaction now
+			result = I2cMasterWriteBuffer(
+				asyncSlaveAddress,
+				asyncTransactions[asyncIndex].data[0],
+				asyncTransactions[asyncIndex].data + 1,
+				asyncTransactions[asyncIndex].numBytes - 1);
+
+			if(result != TRANSFER_OK)
+				FinishAsyncWrite(result);
+			else if(++asyncIndex >= asyncNumTransactions)
+				FinishAsyncWrite(TRANSFER_OK);
+			else
+				StartAsyncTransaction();
+		#else
+			#warning No port-specific code for Port::I2cMasterServiceWrite() 
+		#endif
+	}
+
+	void Port::I2cMasterWaitForWrite()
+	{
+		#if(MCU_PLATFORM == LINUX)
+			pthread_mutex_lock(&asyncMutex);
+			// Called from a callback, nothing would finish the write while waiting
+			if(!isAsyncThreadStarted || !pthread_equal(pthread_self(), asyncThread))
+			{
+				while(isAsyncBusy)
+					pthread_cond_wait(&asyncCond, &asyncMutex);
+			}
+			pthread_mutex_unlock(&asyncMutex);
+		#else
+			while(isAsyncBusy && !isAsyncCompleting)
+				I2cMasterServiceWrite();
+		#endif
+	}
+
 
 	//! @brief		I/O wrapper function. Pulls the reset pin low, putting SSD1306 into reset
 	//! @details	
@@ -150,6 +793,17 @@ namespace SSD1306Ns
 				CapSense_SetCapDevice(RIGHT_LIN);
 				CapSense_SetGpio(LOW);
 			}
+		#elif(MCU_PLATFORM == LINUX)
+			// Reset is normally tied to an RC circuit on I2C OLED modules, nothing to do
+		#elif(MCU_PLATFORM == EMULATOR)
+			uint8 i;
+
+			// Reset line is shared by every device on the port
+			for(i = 0; i < portEMULATOR_MAX_DEVICES; i++)
+			{
+				if(emulators[i2cPort][i] != NULL)
+					emulators[i2cPort][i]->Reset();
+			}
 		#else
 			#warning No port-specific code for Port::PullResetLow() 
 		#endif
@@ -168,11 +822,51 @@ namespace SSD1306Ns
 				CapSense_SetCapDevice(RIGHT_LIN);
 				CapSense_SetGpio(HIGH);
 			}
+		#elif(MCU_PLATFORM == LINUX)
+			// Reset is normally tied to an RC circuit on I2C OLED modules, nothing to do
+		#elif(MCU_PLATFORM == EMULATOR)
+			// Registers were reset when the line went low, nothing to do
 		#else
 			#warning No port-specific code for Port::PullResetHigh() 
 		#endif
 	}
 
+	//! @brief		I/O wrapper function. Enables power to the Vddb line of both screens.
+	//! @details	P-ch MOSFET controls power to pin.
+	//! @public
+	void Port::EnableVddb()
+	{
+		#if(MCU_PLATFORM == PSOC)
+			// Enable OLED screens Vddb (P-ch MOSFETs)
+			PinCpRightVddbEnN_Write(0);
+			PinCpLeftVddbEnN_Write(0);
+		#elif(MCU_PLATFORM == LINUX)
+			// Vddb is not switched on Linux boards, nothing to do
+		#elif(MCU_PLATFORM == EMULATOR)
+			// Nothing to do
+		#else
+			#warning No port-specific code for Port::EnableVddb() 
+		#endif
+	}
+
+	//! @brief		I/O wrapper function. Disables power to the Vddb line of both screens.
+	//! @details	P-ch MOSFET controls power to pin.
+	//! @public
+	void Port::DisableVddb()
+	{
+		#if(MCU_PLATFORM == PSOC)
+			// Disable OLED screens Vddb (P-ch MOSFETs)
+			PinCpRightVddbEnN_Write(1);
+			PinCpLeftVddbEnN_Write(1);
+		#elif(MCU_PLATFORM == LINUX)
+			// Vddb is not switched on Linux boards, nothing to do
+		#elif(MCU_PLATFORM == EMULATOR)
+			// Nothing to do
+		#else
+			#warning No port-specific code for Port::DisableVddb() 
+		#endif
+	}
+
 	//! @brief		Wrapper function for micro-second delay
 	//! @private
 	void Port::DelayUs(uint16 delayTimeUs)
@@ -180,6 +874,10 @@ namespace SSD1306Ns
 		#if(MCU_PLATFORM == PSOC)
 			// Call Cypress API function
 			CyDelayUs(delayTimeUs);
+		#elif(MCU_PLATFORM == LINUX)
+			usleep(delayTimeUs);
+		#elif(MCU_PLATFORM == EMULATOR)
+			totalDelayUs += delayTimeUs;
 		#else
 			#warning No port-specific code for Port::DelayUs() 
 		#endif
@@ -193,6 +891,10 @@ namespace SSD1306Ns
 		#if(MCU_PLATFORM == PSOC)
 			// Call milli-second delay Cypress API function
 			CyDelay(delayTimeMs);
+		#elif(MCU_PLATFORM == LINUX)
+			usleep((useconds_t)delayTimeMs*1000);
+		#elif(MCU_PLATFORM == EMULATOR)
+			totalDelayUs += (uint32)delayTimeMs*1000;
 		#else
 			#warning No port-specific code for Port::DelayMs() 
 		#endif
@@ -202,11 +904,454 @@ namespace SSD1306Ns
 	{
 		#if(MCU_PLATFORM == PSOC)
 			UartDebug_PutString(msg);
+		#elif((MCU_PLATFORM == LINUX) || (MCU_PLATFORM == EMULATOR))
+			fputs(msg, stderr);
 		#else
 			#warning No port-specific code for Port::PrintDebug() 
 		#endif
 	}
 
+	uint8 Port::AtomicExchange(volatile uint8 *value, uint8 newValue)
+	{
+		#if(MCU_PLATFORM == PSOC)
+			uint8 interruptState;
+			uint8 oldValue;
+
+			// Single core, so masking interrupts is enough
+			interruptState = CyEnterCriticalSection();
+			oldValue = *value;
+			*value = newValue;
+			CyExitCriticalSection(interruptState);
+
+			return oldValue;
+		#elif((MCU_PLATFORM == LINUX) || (MCU_PLATFORM == EMULATOR))
+			return __atomic_exchange_n(value, newValue, __ATOMIC_ACQ_REL);
+		#else
+			#warning No port-specific code for Port::AtomicExchange() 
+		#endif
+	}
+
+	uint32 Port::GetTimeMs()
+	{
+		#if(MCU_PLATFORM == PSOC)
+			static bool isSysTickStarted = false;
+
+			if(!isSysTickStarted)
+			{
+				// Ticks every milli-second by default
+				CySysTickStart();
+				CySysTickSetCallback(0, &PortSysTickCallback);
+				isSysTickStarted = true;
+			}
+
+			return portTimeMs;
+		#elif((MCU_PLATFORM == LINUX) || (MCU_PLATFORM == EMULATOR))
+			struct timespec now;
+
+			clock_gettime(CLOCK_MONOTONIC, &now);
+
+			return (uint32)((uint64_t)now.tv_sec*1000 + now.tv_nsec/1000000);
+		#else
+			#warning No port-specific code for Port::GetTimeMs() 
+		#endif
+	}
+
+	uint32 Port::GetTimeUs()
+	{
+		#if(MCU_PLATFORM == PSOC)
+			uint32 timeMs;
+			uint32 ticksLeft;
+			uint32 reload;
+
+			// Makes sure SysTick is running
+			GetTimeMs();
+
+			// Read again if the milli-second count moved on in between
+			do
+			{
+				timeMs = portTimeMs;
+				ticksLeft = CySysTickGetValue();
+			} while(timeMs != portTimeMs);
+
+			// SysTick counts down from the reload value once every milli-second
+			reload = CySysTickGetReload();
+
+			return timeMs*1000 + (uint32)(((uint64_t)(reload - ticksLeft)*1000)/(reload + 1));
+		#elif((MCU_PLATFORM == LINUX) || (MCU_PLATFORM == EMULATOR))
+			struct timespec now;
+
+			clock_gettime(CLOCK_MONOTONIC, &now);
+
+			return (uint32)((uint64_t)now.tv_sec*1000000 + now.tv_nsec/1000);
+		#else
+			#warning No port-specific code for Port::GetTimeUs() 
+		#endif
+	}
+
+	void Port::MemoryBarrier()
+	{
+		#if(MCU_PLATFORM == PSOC)
+			// Single core, this just stops the compiler and CPU re-ordering memory accesses
+			__DMB();
+		#elif((MCU_PLATFORM == LINUX) || (MCU_PLATFORM == EMULATOR))
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		#else
+			#warning No port-specific code for Port::MemoryBarrier() 
+		#endif
+	}
+
+	uint8 Port::EnterCritical(volatile uint8 *lock)
+	{
+		#if(MCU_PLATFORM == PSOC)
+			(void)lock;
+			// Single core, so masking interrupts is enough
+			return CyEnterCriticalSection();
+		#elif((MCU_PLATFORM == LINUX) || (MCU_PLATFORM == EMULATOR))
+			while(__atomic_exchange_n(lock, 1, __ATOMIC_ACQUIRE) != 0)
+			{
+				// Holder is only ever a few instructions away from releasing it
+			}
+			return 0;
+		#else
+			#warning No port-specific code for Port::EnterCritical() 
+		#endif
+	}
+
+	void Port::ExitCritical(volatile uint8 *lock, uint8 state)
+	{
+		#if(MCU_PLATFORM == PSOC)
+			(void)lock;
+			CyExitCriticalSection(state);
+		#elif((MCU_PLATFORM == LINUX) || (MCU_PLATFORM == EMULATOR))
+			(void)state;
+			__atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+		#else
+			#warning No port-specific code for Port::ExitCritical() 
+		#endif
+	}
+
+	//===============================================================================================//
+	//===================================== PRIVATE FUNCTIONS =======================================//
+	//===============================================================================================//
+
+	void Port::StartAsyncTransaction()
+	{
+		#if(MCU_PLATFORM == PSOC)
+			uint8 *data = (uint8*)asyncTransactions[asyncIndex].data;
+			uint8 numBytes = (uint8)asyncTransactions[asyncIndex].numBytes;
+
+			if(interfaceType == INTERFACE_SPI)
+			{
+				// The last transaction has gone out (I2cMasterServiceWrite() waited for it), so the
+				// D/C# pin can change. The SPI component sends the bytes from it's interrupt if it has
+				// a software TX buffer at least as big as a transaction, otherwise PutArray() waits.
+				SetDcPin((data[0] & portSPI_DC_BIT) != 0);
+
+				if(i2cPort == i2cLeft)
+					SpimCpLeft_PutArray(data + 1, numBytes - 1);
+				else if(i2cPort == i2cRight)
+					SpimCpRight_PutArray(data + 1, numBytes - 1);
+				return;
+			}
+
+			// The I2C component sends the buffer from it's interrupt
+			if(i2cPort == i2cLeft)
+			{
+				I2cCpLeft_MasterClearStatus();
+				if(I2cCpLeft_MasterWriteBuf(asyncSlaveAddress, data, numBytes, I2cCpLeft_MODE_COMPLETE_XFER) != I2cCpLeft_MSTR_NO_ERROR)
+					FinishAsyncWrite(TRANSFER_ERROR_START);
+			}
+			else if(i2cPort == i2cRight)
+			{
+				I2cCpRight_MasterClearStatus();
+				if(I2cCpRight_MasterWriteBuf(asyncSlaveAddress, data, numBytes, I2cCpRight_MODE_COMPLETE_XFER) != I2cCpRight_MSTR_NO_ERROR)
+					FinishAsyncWrite(TRANSFER_ERROR_START);
+			}
+		#elif(MCU_PLATFORM == LINUX)
+			// Worker thread sends the transactions back-to-back
+		#elif(MCU_PLATFORM == EMULATOR)
+			// Sent by the next call to I2cMasterServiceWrite()
+		#else
+			#warning No port-specific code for Port::StartAsyncTransaction() 
+		#endif
+	}
+
+	void Port::FinishAsyncWrite(uint8 result)
+	{
+		writeCompleteCallback_t callback = asyncCallback;
+		void *context = asyncContext;
+
+		// Stays busy until the callback has returned, so nothing else sees the write as finished
+		// (and starts the next one) while the callback is still running. The callback can start
+		// the next write itself, which clears #isAsyncCompleting.
+		#if(MCU_PLATFORM == LINUX)
+			pthread_mutex_lock(&asyncMutex);
+			isAsyncCompleting = true;
+			pthread_mutex_unlock(&asyncMutex);
+		#else
+			isAsyncCompleting = true;
+		#endif
+
+		if(callback != NULL)
+			callback(context, result);
+
+		#if(MCU_PLATFORM == LINUX)
+			pthread_mutex_lock(&asyncMutex);
+			if(isAsyncCompleting)
+			{
+				isAsyncCompleting = false;
+				isAsyncBusy = false;
+				pthread_cond_broadcast(&asyncCond);
+			}
+			pthread_mutex_unlock(&asyncMutex);
+		#else
+			if(isAsyncCompleting)
+			{
+				isAsyncCompleting = false;
+				isAsyncBusy = false;
+			}
+		#endif
+	}
+
+	uint8 Port::SetDcPin(bool isData)
+	{
+		if(dcLevels[i2cPort] == (int8)isData)
+			return TRANSFER_OK;
+
+		#if(MCU_PLATFORM == PSOC)
+			// Bytes still in the FIFO have to go out with the old level
+			while(!IsSpiIdle());
+
+			if(i2cPort == i2cLeft)
+				PinCpLeftDc_Write(isData);
+			else if(i2cPort == i2cRight)
+				PinCpRightDc_Write(isData);
+		#elif(MCU_PLATFORM == LINUX)
+			// SPI_IOC_MESSAGE doesn't return until the transfer is complete, so no need to wait
+			int fd;
+
+			fd = GetDcFileDescriptor();
+			if(fd < 0)
+				return TRANSFER_ERROR_START;
+
+			if(BusGpioSetLine(fd, ioctlFunction, isData) != TRANSFER_OK)
+			{
+				dcLevels[i2cPort] = -1;
+				return TRANSFER_ERROR_START;
+			}
+		#elif(MCU_PLATFORM == EMULATOR)
+			if(emulators[i2cPort][0] != NULL)
+				emulators[i2cPort][0]->SetDcPin(isData);
+		#else
+			#warning No port-specific code for Port::SetDcPin() 
+		#endif
+
+		dcLevels[i2cPort] = isData;
+
+		return TRANSFER_OK;
+	}
+
+	#if(MCU_PLATFORM == PSOC)
+		bool Port::IsSpiIdle()
+		{
+			// The software buffer (if any) has to be empty, as well as the FIFO and shift register
+			if(i2cPort == i2cLeft)
+				return (SpimCpLeft_GetTxBufferSize() == 0) && (SpimCpLeft_ReadTxStatus() & SpimCpLeft_STS_SPI_IDLE);
+			else if(i2cPort == i2cRight)
+				return (SpimCpRight_GetTxBufferSize() == 0) && (SpimCpRight_ReadTxStatus() & SpimCpRight_STS_SPI_IDLE);
+
+			return true;
+		}
+	#endif
+
+	#if(MCU_PLATFORM == LINUX)
+		void* Port::AsyncThreadMain(void *arg)
+		{
+			Port *port = (Port*)arg;
+			uint8 result;
+			uint8 i;
+
+			pthread_mutex_lock(&port->asyncMutex);
+
+			while(true)
+			{
+				while(!port->isAsyncBusy && !port->isAsyncThreadExit)
+					pthread_cond_wait(&port->asyncCond, &port->asyncMutex);
+
+				if(!port->isAsyncBusy)
+					break;
+
+				pthread_mutex_unlock(&port->asyncMutex);
+
+				result = TRANSFER_OK;
+				for(i = 0; i < port->asyncNumTransactions; i++)
+				{
+					result = port->I2cMasterWriteBuffer(
+						port->asyncSlaveAddress,
+						port->asyncTransactions[i].data[0],
+						port->asyncTransactions[i].data + 1,
+						port->asyncTransactions[i].numBytes - 1);
+
+					if(result != TRANSFER_OK)
+						break;
+				}
+
+				port->FinishAsyncWrite(result);
+
+				pthread_mutex_lock(&port->asyncMutex);
+			}
+
+			pthread_mutex_unlock(&port->asyncMutex);
+
+			return NULL;
+		}
+
+		int Port::GetFileDescriptor()
+		{
+			char devicePath[20];
+			unsigned long funcs;
+			int fd;
+
+			if(fds[i2cPort] >= 0)
+				return fds[i2cPort];
+
+			snprintf(devicePath, sizeof(devicePath), "/dev/i2c-%u", busNumbers[i2cPort]);
+
+			fd = open(devicePath, O_RDWR);
+			if(fd < 0)
+				return -1;
+
+			// Work out if the adapter can do plain I2C, or SMBus only
+			if(BusIoctl(ioctlFunction, fd, I2C_FUNCS, &funcs) < 0)
+				funcs = I2C_FUNC_I2C;
+
+			if(!(funcs & I2C_FUNC_I2C) && !(funcs & I2C_FUNC_SMBUS_WRITE_I2C_BLOCK))
+			{
+				// Can't talk to the SSD1306 with this adapter
+				close(fd);
+				return -1;
+			}
+
+			fds[i2cPort] = fd;
+			ownsFd[i2cPort] = true;
+			supportsI2c[i2cPort] = ((funcs & I2C_FUNC_I2C) != 0);
+
+			return fd;
+		}
+
+		int Port::GetSpiFileDescriptor()
+		{
+			int fd;
+
+			if(spiFds[i2cPort] >= 0)
+				return spiFds[i2cPort];
+
+			fd = BusSpidevOpen(spiBusNumbers[i2cPort], spiChipSelects[i2cPort], spiSpeedHz);
+			if(fd < 0)
+				return -1;
+
+			spiFds[i2cPort] = fd;
+			ownsSpiFd[i2cPort] = true;
+
+			return fd;
+		}
+
+		int Port::GetDcFileDescriptor()
+		{
+			int fd;
+
+			if(dcFds[i2cPort] >= 0)
+				return dcFds[i2cPort];
+
+			if(!isDcGpioSet[i2cPort])
+				return -1;
+
+			fd = BusGpioRequestOutput(dcChipNumbers[i2cPort], dcLines[i2cPort]);
+			if(fd < 0)
+				return -1;
+
+			dcFds[i2cPort] = fd;
+			ownsDcFd[i2cPort] = true;
+			dcLevels[i2cPort] = 0;
+
+			return fd;
+		}
+
+		uint8 Port::SendSmbusBlocks(int fd, uint8 slaveAddress, uint8 controlByte, const ioVector_t *vectors, uint8 numVectors)
+		{
+			union i2c_smbus_data smbusData;
+			struct i2c_smbus_ioctl_data smbusArgs;
+			uint8 blockLength = 0;
+			uint8 maxBlockLength;
+			uint8 vectorIndex;
+			uint16 byteIndex;
+			bool isEmpty = true;
+
+			if(BusIoctl(ioctlFunction, fd, I2C_SLAVE, (void*)(uintptr_t)slaveAddress) < 0)
+				return TRANSFER_ERROR_START;
+
+			// Control byte is sent as the SMBus command byte, so isn't part of the block
+			maxBlockLength = portLINUX_SMBUS_BLOCK_MAX;
+			if(maxMessageSize - 1 < maxBlockLength)
+				maxBlockLength = maxMessageSize - 1;
+
+			smbusArgs.read_write = I2C_SMBUS_WRITE;
+			smbusArgs.command = controlByte;
+			smbusArgs.size = I2C_SMBUS_I2C_BLOCK_DATA;
+			smbusArgs.data = &smbusData;
+
+			for(vectorIndex = 0; vectorIndex < numVectors; vectorIndex++)
+			{
+				for(byteIndex = 0; byteIndex < vectors[vectorIndex].numBytes; byteIndex++)
+				{
+					smbusData.block[++blockLength] = vectors[vectorIndex].data[byteIndex];
+					isEmpty = false;
+
+					if(blockLength == maxBlockLength)
+					{
+						smbusData.block[0] = blockLength;
+						if(BusIoctl(ioctlFunction, fd, I2C_SMBUS, &smbusArgs) < 0)
+							return TRANSFER_ERROR_BYTE;
+						blockLength = 0;
+					}
+				}
+			}
+
+			if(blockLength != 0)
+			{
+				smbusData.block[0] = blockLength;
+				if(BusIoctl(ioctlFunction, fd, I2C_SMBUS, &smbusArgs) < 0)
+					return TRANSFER_ERROR_BYTE;
+			}
+			else if(isEmpty)
+			{
+				// A transaction with no data is still sent, as the control byte on it's own (an
+				// SMBus send byte)
+				smbusArgs.size = I2C_SMBUS_BYTE;
+				smbusArgs.data = NULL;
+				if(BusIoctl(ioctlFunction, fd, I2C_SMBUS, &smbusArgs) < 0)
+					return TRANSFER_ERROR_BYTE;
+			}
+
+			return TRANSFER_OK;
+		}
+	#endif
+
+	#if(MCU_PLATFORM == EMULATOR)
+		Ssd1306Emulator* Port::FindEmulator(uint8 slaveAddress)
+		{
+			uint8 i;
+
+			for(i = 0; i < portEMULATOR_MAX_DEVICES; i++)
+			{
+				if((emulators[i2cPort][i] != NULL) && (emulators[i2cPort][i]->GetI2cAddress() == slaveAddress))
+					return emulators[i2cPort][i];
+			}
+
+			return NULL;
+		}
+	#endif
+
 
 	//===============================================================================================//
 	//============================================ GRAVEYARD ========================================//
@@ -216,6 +1361,6 @@ namespace SSD1306Ns
 } // namespace SSD1306Ns
 
 
-#endif	// #if(configINCLUDE_CAP_SENSE == 1)
+#endif	// #if((MCU_PLATFORM != PSOC) || (configINCLUDE_CAP_SENSE == 1))
 
 // EOF
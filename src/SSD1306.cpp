@@ -3,7 +3,7 @@
 //! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
 //! @edited 			n/a
 //! @created			2012-01-25
-//! @last-modified 		2014-11-01
+//! @last-modified 		2026-10-16
 //! @brief 				Driver for the SDD1306 OLED segment/common controller.
 //! @details
 //!						See the README in the repo root dir for more info.
@@ -12,9 +12,16 @@
 //========================================== INCLUDES ===========================================//
 //===============================================================================================//
 
+// System includes
+#include <string.h>		// memset()
+
 // User includes
 #include "../include/Port.hpp"
 #include "../include/SSD1306.hpp"
+#if(ssd1306ENABLE_FONTS == 1)
+	#include "../include/fonts/Fixed5x7.hpp"
+	#include "../include/fonts/Symbols5x7.hpp"
+#endif
 
 //===============================================================================================//
 //===================================== PRE-COMPILER CHECKS =====================================//
@@ -41,27 +48,16 @@ namespace MbeddedNinja
 		//========================================== DEFINES ============================================//
 		//===============================================================================================//
 	
-		//! 7-bit, right-adjusted SSD1306 I2C address if SA0 is pulled low
-		//! 7-bit, right-adjusted SSD1306 I2C address if SA0 is pulled high
-		#define SSD1306_I2C_ADD_SA0_0	0x3C
-		#define SSD1306_I2C_ADD_SA0_1	0x3D
-	
-		// Check to make sure SA0 has a defined position
-		#if((SSD1306_I2C_SA0_0 ^ SSD1306_I2C_SA0_1) != 1)
-			#error Please set either SSD1306_I2C_SA0_0 or SSD1306_I2C_SA0_1 to 1, but not both
-		#endif
-	
-		// Assign SSD1306_I2C_ADD depending on the position of SA0
-		#if(SSD1306_I2C_SA0_0 == 1)
-			#define SSD1306_I2C_ADD SSD1306_I2C_ADD_SA0_0	//!< Calculated conditional 7-bit, right-adj I2C address of SSD1306
-		#else
-			#define SSD1306_I2C_ADD SSD1306_I2C_ADD_SA0_1 	//!< Calculated conditional 7-bit, right-adj I2C address of SSD1306
-		#endif
-
 		//! @brief		Delay (in microseconds) between asserting reset signal and de-asserting again.
 		//! @details	Delay needs to be at least 3us (as per datasheet).
 		#define ssd1306_RESET_DELAY_TIME_US				(200)
 
+		//! @brief		Number of pages of GDDRAM, whatever the size of the panel.
+		#define ssd1306_NUM_RAM_PAGES					8
+
+		//! @brief		Number of columns of GDDRAM, whatever the size of the panel.
+		#define ssd1306_NUM_RAM_COLS					128
+
 		#define ssd1306REG_VAL_ACTIVATE_DISPLAY 		0xAF
 		#define ssd1306REG_VAL_DEACTIVATE_DISPLAY 		0xAE
 
@@ -86,366 +82,11 @@ namespace MbeddedNinja
 			#define ssd1306_REG_BIT_POS_OSC_FREQ						4
 	
 		//===============================================================================================//
-		//====================================== PRIVATE VARIABLES ======================================//
+		//====================================== GLOBAL VARIABLES =======================================//
 		//===============================================================================================//
-		
-		#if(ssd1306ENABLE_FONTS == 1)
-			const unsigned char Ascii_1[240][5]={		// Refer to "Times New Roman" Font Database...
-									//   Basic Characters
-				{0x00,0x00,0x4F,0x00,0x00},		//   (  1)  ! - 0x0021 Exclamation Mark
-				{0x00,0x07,0x00,0x07,0x00},		//   (  2)  " - 0x0022 Quotation Mark
-				{0x14,0x7F,0x14,0x7F,0x14},		//   (  3)  # - 0x0023 Number Sign
-				{0x24,0x2A,0x7F,0x2A,0x12},		//   (  4)  $ - 0x0024 Dollar Sign
-				{0x23,0x13,0x08,0x64,0x62},		//   (  5)  % - 0x0025 Percent Sign
-				{0x36,0x49,0x55,0x22,0x50},		//   (  6)  & - 0x0026 Ampersand
-				{0x00,0x05,0x03,0x00,0x00},		//   (  7)  ' - 0x0027 Apostrophe
-				{0x00,0x1C,0x22,0x41,0x00},		//   (  8)  ( - 0x0028 Left Parenthesis
-				{0x00,0x41,0x22,0x1C,0x00},		//   (  9)  ) - 0x0029 Right Parenthesis
-				{0x14,0x08,0x3E,0x08,0x14},		//   ( 10)  * - 0x002A Asterisk
-				{0x08,0x08,0x3E,0x08,0x08},		//   ( 11)  + - 0x002B Plus Sign
-				{0x00,0x50,0x30,0x00,0x00},		//   ( 12)  , - 0x002C Comma
-				{0x08,0x08,0x08,0x08,0x08},		//   ( 13)  - - 0x002D Hyphen-Minus
-				{0x00,0x60,0x60,0x00,0x00},		//   ( 14)  . - 0x002E Full Stop
-				{0x20,0x10,0x08,0x04,0x02},		//   ( 15)  / - 0x002F Solidus
-				{0x3E,0x51,0x49,0x45,0x3E},		//   ( 16)  0 - 0x0030 Digit Zero
-				{0x00,0x42,0x7F,0x40,0x00},		//   ( 17)  1 - 0x0031 Digit One
-				{0x42,0x61,0x51,0x49,0x46},		//   ( 18)  2 - 0x0032 Digit Two
-				{0x21,0x41,0x45,0x4B,0x31},		//   ( 19)  3 - 0x0033 Digit Three
-				{0x18,0x14,0x12,0x7F,0x10},		//   ( 20)  4 - 0x0034 Digit Four
-				{0x27,0x45,0x45,0x45,0x39},		//   ( 21)  5 - 0x0035 Digit Five
-				{0x3C,0x4A,0x49,0x49,0x30},		//   ( 22)  6 - 0x0036 Digit Six
-				{0x01,0x71,0x09,0x05,0x03},		//   ( 23)  7 - 0x0037 Digit Seven
-				{0x36,0x49,0x49,0x49,0x36},		//   ( 24)  8 - 0x0038 Digit Eight
-				{0x06,0x49,0x49,0x29,0x1E},		//   ( 25)  9 - 0x0039 Dight Nine
-				{0x00,0x36,0x36,0x00,0x00},		//   ( 26)  : - 0x003A Colon
-				{0x00,0x56,0x36,0x00,0x00},		//   ( 27)  ; - 0x003B Semicolon
-				{0x08,0x14,0x22,0x41,0x00},		//   ( 28)  < - 0x003C Less-Than Sign
-				{0x14,0x14,0x14,0x14,0x14},		//   ( 29)  = - 0x003D Equals Sign
-				{0x00,0x41,0x22,0x14,0x08},		//   ( 30)  > - 0x003E Greater-Than Sign
-				{0x02,0x01,0x51,0x09,0x06},		//   ( 31)  ? - 0x003F Question Mark
-				{0x32,0x49,0x79,0x41,0x3E},		//   ( 32)  @ - 0x0040 Commercial At
-				{0x7E,0x11,0x11,0x11,0x7E},		//   ( 33)  A - 0x0041 Latin Capital Letter A
-				{0x7F,0x49,0x49,0x49,0x36},		//   ( 34)  B - 0x0042 Latin Capital Letter B
-				{0x3E,0x41,0x41,0x41,0x22},		//   ( 35)  C - 0x0043 Latin Capital Letter C
-				{0x7F,0x41,0x41,0x22,0x1C},		//   ( 36)  D - 0x0044 Latin Capital Letter D
-				{0x7F,0x49,0x49,0x49,0x41},		//   ( 37)  E - 0x0045 Latin Capital Letter E
-				{0x7F,0x09,0x09,0x09,0x01},		//   ( 38)  F - 0x0046 Latin Capital Letter F
-				{0x3E,0x41,0x49,0x49,0x7A},		//   ( 39)  G - 0x0047 Latin Capital Letter G
-				{0x7F,0x08,0x08,0x08,0x7F},		//   ( 40)  H - 0x0048 Latin Capital Letter H
-				{0x00,0x41,0x7F,0x41,0x00},		//   ( 41)  I - 0x0049 Latin Capital Letter I
-				{0x20,0x40,0x41,0x3F,0x01},		//   ( 42)  J - 0x004A Latin Capital Letter J
-				{0x7F,0x08,0x14,0x22,0x41},		//   ( 43)  K - 0x004B Latin Capital Letter K
-				{0x7F,0x40,0x40,0x40,0x40},		//   ( 44)  L - 0x004C Latin Capital Letter L
-				{0x7F,0x02,0x0C,0x02,0x7F},		//   ( 45)  M - 0x004D Latin Capital Letter M
-				{0x7F,0x04,0x08,0x10,0x7F},		//   ( 46)  N - 0x004E Latin Capital Letter N
-				{0x3E,0x41,0x41,0x41,0x3E},		//   ( 47)  O - 0x004F Latin Capital Letter O
-				{0x7F,0x09,0x09,0x09,0x06},		//   ( 48)  P - 0x0050 Latin Capital Letter P
-				{0x3E,0x41,0x51,0x21,0x5E},		//   ( 49)  Q - 0x0051 Latin Capital Letter Q
-				{0x7F,0x09,0x19,0x29,0x46},		//   ( 50)  R - 0x0052 Latin Capital Letter R
-				{0x46,0x49,0x49,0x49,0x31},		//   ( 51)  S - 0x0053 Latin Capital Letter S
-				{0x01,0x01,0x7F,0x01,0x01},		//   ( 52)  T - 0x0054 Latin Capital Letter T
-				{0x3F,0x40,0x40,0x40,0x3F},		//   ( 53)  U - 0x0055 Latin Capital Letter U
-				{0x1F,0x20,0x40,0x20,0x1F},		//   ( 54)  V - 0x0056 Latin Capital Letter V
-				{0x3F,0x40,0x38,0x40,0x3F},		//   ( 55)  W - 0x0057 Latin Capital Letter W
-				{0x63,0x14,0x08,0x14,0x63},		//   ( 56)  X - 0x0058 Latin Capital Letter X
-				{0x07,0x08,0x70,0x08,0x07},		//   ( 57)  Y - 0x0059 Latin Capital Letter Y
-				{0x61,0x51,0x49,0x45,0x43},		//   ( 58)  Z - 0x005A Latin Capital Letter Z
-				{0x00,0x7F,0x41,0x41,0x00},		//   ( 59)  [ - 0x005B Left Square Bracket
-				{0x02,0x04,0x08,0x10,0x20},		//   ( 60)  \ - 0x005C Reverse Solidus
-				{0x00,0x41,0x41,0x7F,0x00},		//   ( 61)  ] - 0x005D Right Square Bracket
-				{0x04,0x02,0x01,0x02,0x04},		//   ( 62)  ^ - 0x005E Circumflex Accent
-				{0x40,0x40,0x40,0x40,0x40},		//   ( 63)  _ - 0x005F Low Line
-				{0x01,0x02,0x04,0x00,0x00},		//   ( 64)  ` - 0x0060 Grave Accent
-				{0x20,0x54,0x54,0x54,0x78},		//   ( 65)  a - 0x0061 Latin Small Letter A
-				{0x7F,0x48,0x44,0x44,0x38},		//   ( 66)  b - 0x0062 Latin Small Letter B
-				{0x38,0x44,0x44,0x44,0x20},		//   ( 67)  c - 0x0063 Latin Small Letter C
-				{0x38,0x44,0x44,0x48,0x7F},		//   ( 68)  d - 0x0064 Latin Small Letter D
-				{0x38,0x54,0x54,0x54,0x18},		//   ( 69)  e - 0x0065 Latin Small Letter E
-				{0x08,0x7E,0x09,0x01,0x02},		//   ( 70)  f - 0x0066 Latin Small Letter F
-				{0x06,0x49,0x49,0x49,0x3F},		//   ( 71)  g - 0x0067 Latin Small Letter G
-				{0x7F,0x08,0x04,0x04,0x78},		//   ( 72)  h - 0x0068 Latin Small Letter H
-				{0x00,0x44,0x7D,0x40,0x00},		//   ( 73)  i - 0x0069 Latin Small Letter I
-				{0x20,0x40,0x44,0x3D,0x00},		//   ( 74)  j - 0x006A Latin Small Letter J
-				{0x7F,0x10,0x28,0x44,0x00},		//   ( 75)  k - 0x006B Latin Small Letter K
-				{0x00,0x41,0x7F,0x40,0x00},		//   ( 76)  l - 0x006C Latin Small Letter L
-				{0x7C,0x04,0x18,0x04,0x7C},		//   ( 77)  m - 0x006D Latin Small Letter M
-				{0x7C,0x08,0x04,0x04,0x78},		//   ( 78)  n - 0x006E Latin Small Letter N
-				{0x38,0x44,0x44,0x44,0x38},		//   ( 79)  o - 0x006F Latin Small Letter O
-				{0x7C,0x14,0x14,0x14,0x08},		//   ( 80)  p - 0x0070 Latin Small Letter P
-				{0x08,0x14,0x14,0x18,0x7C},		//   ( 81)  q - 0x0071 Latin Small Letter Q
-				{0x7C,0x08,0x04,0x04,0x08},		//   ( 82)  r - 0x0072 Latin Small Letter R
-				{0x48,0x54,0x54,0x54,0x20},		//   ( 83)  s - 0x0073 Latin Small Letter S
-				{0x04,0x3F,0x44,0x40,0x20},		//   ( 84)  t - 0x0074 Latin Small Letter T
-				{0x3C,0x40,0x40,0x20,0x7C},		//   ( 85)  u - 0x0075 Latin Small Letter U
-				{0x1C,0x20,0x40,0x20,0x1C},		//   ( 86)  v - 0x0076 Latin Small Letter V
-				{0x3C,0x40,0x30,0x40,0x3C},		//   ( 87)  w - 0x0077 Latin Small Letter W
-				{0x44,0x28,0x10,0x28,0x44},		//   ( 88)  x - 0x0078 Latin Small Letter X
-				{0x0C,0x50,0x50,0x50,0x3C},		//   ( 89)  y - 0x0079 Latin Small Letter Y
-				{0x44,0x64,0x54,0x4C,0x44},		//   ( 90)  z - 0x007A Latin Small Letter Z
-				{0x00,0x08,0x36,0x41,0x00},		//   ( 91)  { - 0x007B Left Curly Bracket
-				{0x00,0x00,0x7F,0x00,0x00},		//   ( 92)  | - 0x007C Vertical Line
-				{0x00,0x41,0x36,0x08,0x00},		//   ( 93)  } - 0x007D Right Curly Bracket
-				{0x02,0x01,0x02,0x04,0x02},		//   ( 94)  ~ - 0x007E Tilde
-				{0x3E,0x55,0x55,0x41,0x22},		//   ( 95)  C - 0x0080 <Control>
-				{0x00,0x00,0x00,0x00,0x00},		//   ( 96)    - 0x00A0 No-Break Space
-				{0x00,0x00,0x79,0x00,0x00},		//   ( 97)  ! - 0x00A1 Inverted Exclamation Mark
-				{0x18,0x24,0x74,0x2E,0x24},		//   ( 98)  c - 0x00A2 Cent Sign
-				{0x48,0x7E,0x49,0x42,0x40},		//   ( 99)  L - 0x00A3 Pound Sign
-				{0x5D,0x22,0x22,0x22,0x5D},		//   (100)  o - 0x00A4 Currency Sign
-				{0x15,0x16,0x7C,0x16,0x15},		//   (101)  Y - 0x00A5 Yen Sign
-				{0x00,0x00,0x77,0x00,0x00},		//   (102)  | - 0x00A6 Broken Bar
-				{0x0A,0x55,0x55,0x55,0x28},		//   (103)    - 0x00A7 Section Sign
-				{0x00,0x01,0x00,0x01,0x00},		//   (104)  " - 0x00A8 Diaeresis
-				{0x00,0x0A,0x0D,0x0A,0x04},		//   (105)    - 0x00AA Feminine Ordinal Indicator
-				{0x08,0x14,0x2A,0x14,0x22},		//   (106) << - 0x00AB Left-Pointing Double Angle Quotation Mark
-				{0x04,0x04,0x04,0x04,0x1C},		//   (107)    - 0x00AC Not Sign
-				{0x00,0x08,0x08,0x08,0x00},		//   (108)  - - 0x00AD Soft Hyphen
-				{0x01,0x01,0x01,0x01,0x01},		//   (109)    - 0x00AF Macron
-				{0x00,0x02,0x05,0x02,0x00},		//   (110)    - 0x00B0 Degree Sign
-				{0x44,0x44,0x5F,0x44,0x44},		//   (111) +- - 0x00B1 Plus-Minus Sign
-				{0x00,0x00,0x04,0x02,0x01},		//   (112)  ` - 0x00B4 Acute Accent
-				{0x7E,0x20,0x20,0x10,0x3E},		//   (113)  u - 0x00B5 Micro Sign
-				{0x06,0x0F,0x7F,0x00,0x7F},		//   (114)    - 0x00B6 Pilcrow Sign
-				{0x00,0x18,0x18,0x00,0x00},		//   (115)  . - 0x00B7 Middle Dot
-				{0x00,0x40,0x50,0x20,0x00},		//   (116)    - 0x00B8 Cedilla
-				{0x00,0x0A,0x0D,0x0A,0x00},		//   (117)    - 0x00BA Masculine Ordinal Indicator
-				{0x22,0x14,0x2A,0x14,0x08},		//   (118) >> - 0x00BB Right-Pointing Double Angle Quotation Mark
-				{0x17,0x08,0x34,0x2A,0x7D},		//   (119) /4 - 0x00BC Vulgar Fraction One Quarter
-				{0x17,0x08,0x04,0x6A,0x59},		//   (120) /2 - 0x00BD Vulgar Fraction One Half
-				{0x30,0x48,0x45,0x40,0x20},		//   (121)  ? - 0x00BF Inverted Question Mark
-				{0x70,0x29,0x26,0x28,0x70},		//   (122) `A - 0x00C0 Latin Capital Letter A with Grave
-				{0x70,0x28,0x26,0x29,0x70},		//   (123) 'A - 0x00C1 Latin Capital Letter A with Acute
-				{0x70,0x2A,0x25,0x2A,0x70},		//   (124) ^A - 0x00C2 Latin Capital Letter A with Circumflex
-				{0x72,0x29,0x26,0x29,0x70},		//   (125) ~A - 0x00C3 Latin Capital Letter A with Tilde
-				{0x70,0x29,0x24,0x29,0x70},		//   (126) "A - 0x00C4 Latin Capital Letter A with Diaeresis
-				{0x70,0x2A,0x2D,0x2A,0x70},		//   (127)  A - 0x00C5 Latin Capital Letter A with Ring Above
-				{0x7E,0x11,0x7F,0x49,0x49},		//   (128) AE - 0x00C6 Latin Capital Letter Ae
-				{0x0E,0x51,0x51,0x71,0x11},		//   (129)  C - 0x00C7 Latin Capital Letter C with Cedilla
-				{0x7C,0x55,0x56,0x54,0x44},		//   (130) `E - 0x00C8 Latin Capital Letter E with Grave
-				{0x7C,0x55,0x56,0x54,0x44},		//   (131) 'E - 0x00C9 Latin Capital Letter E with Acute
-				{0x7C,0x56,0x55,0x56,0x44},		//   (132) ^E - 0x00CA Latin Capital Letter E with Circumflex
-				{0x7C,0x55,0x54,0x55,0x44},		//   (133) "E - 0x00CB Latin Capital Letter E with Diaeresis
-				{0x00,0x45,0x7E,0x44,0x00},		//   (134) `I - 0x00CC Latin Capital Letter I with Grave
-				{0x00,0x44,0x7E,0x45,0x00},		//   (135) 'I - 0x00CD Latin Capital Letter I with Acute
-				{0x00,0x46,0x7D,0x46,0x00},		//   (136) ^I - 0x00CE Latin Capital Letter I with Circumflex
-				{0x00,0x45,0x7C,0x45,0x00},		//   (137) "I - 0x00CF Latin Capital Letter I with Diaeresis
-				{0x7F,0x49,0x49,0x41,0x3E},		//   (138)  D - 0x00D0 Latin Capital Letter Eth
-				{0x7C,0x0A,0x11,0x22,0x7D},		//   (139) ~N - 0x00D1 Latin Capital Letter N with Tilde
-				{0x38,0x45,0x46,0x44,0x38},		//   (140) `O - 0x00D2 Latin Capital Letter O with Grave
-				{0x38,0x44,0x46,0x45,0x38},		//   (141) 'O - 0x00D3 Latin Capital Letter O with Acute
-				{0x38,0x46,0x45,0x46,0x38},		//   (142) ^O - 0x00D4 Latin Capital Letter O with Circumflex
-				{0x38,0x46,0x45,0x46,0x39},		//   (143) ~O - 0x00D5 Latin Capital Letter O with Tilde
-				{0x38,0x45,0x44,0x45,0x38},		//   (144) "O - 0x00D6 Latin Capital Letter O with Diaeresis
-				{0x22,0x14,0x08,0x14,0x22},		//   (145)  x - 0x00D7 Multiplcation Sign
-				{0x2E,0x51,0x49,0x45,0x3A},		//   (146)  O - 0x00D8 Latin Capital Letter O with Stroke
-				{0x3C,0x41,0x42,0x40,0x3C},		//   (147) `U - 0x00D9 Latin Capital Letter U with Grave
-				{0x3C,0x40,0x42,0x41,0x3C},		//   (148) 'U - 0x00DA Latin Capital Letter U with Acute
-				{0x3C,0x42,0x41,0x42,0x3C},		//   (149) ^U - 0x00DB Latin Capital Letter U with Circumflex
-				{0x3C,0x41,0x40,0x41,0x3C},		//   (150) "U - 0x00DC Latin Capital Letter U with Diaeresis
-				{0x0C,0x10,0x62,0x11,0x0C},		//   (151) `Y - 0x00DD Latin Capital Letter Y with Acute
-				{0x7F,0x12,0x12,0x12,0x0C},		//   (152)  P - 0x00DE Latin Capital Letter Thom
-				{0x40,0x3E,0x01,0x49,0x36},		//   (153)  B - 0x00DF Latin Capital Letter Sharp S
-				{0x20,0x55,0x56,0x54,0x78},		//   (154) `a - 0x00E0 Latin Small Letter A with Grave
-				{0x20,0x54,0x56,0x55,0x78},		//   (155) 'a - 0x00E1 Latin Small Letter A with Acute
-				{0x20,0x56,0x55,0x56,0x78},		//   (156) ^a - 0x00E2 Latin Small Letter A with Circumflex
-				{0x20,0x55,0x56,0x55,0x78},		//   (157) ~a - 0x00E3 Latin Small Letter A with Tilde
-				{0x20,0x55,0x54,0x55,0x78},		//   (158) "a - 0x00E4 Latin Small Letter A with Diaeresis
-				{0x20,0x56,0x57,0x56,0x78},		//   (159)  a - 0x00E5 Latin Small Letter A with Ring Above
-				{0x24,0x54,0x78,0x54,0x58},		//   (160) ae - 0x00E6 Latin Small Letter Ae
-				{0x0C,0x52,0x52,0x72,0x13},		//   (161)  c - 0x00E7 Latin Small Letter c with Cedilla
-				{0x38,0x55,0x56,0x54,0x18},		//   (162) `e - 0x00E8 Latin Small Letter E with Grave
-				{0x38,0x54,0x56,0x55,0x18},		//   (163) 'e - 0x00E9 Latin Small Letter E with Acute
-				{0x38,0x56,0x55,0x56,0x18},		//   (164) ^e - 0x00EA Latin Small Letter E with Circumflex
-				{0x38,0x55,0x54,0x55,0x18},		//   (165) "e - 0x00EB Latin Small Letter E with Diaeresis
-				{0x00,0x49,0x7A,0x40,0x00},		//   (166) `i - 0x00EC Latin Small Letter I with Grave
-				{0x00,0x48,0x7A,0x41,0x00},		//   (167) 'i - 0x00ED Latin Small Letter I with Acute
-				{0x00,0x4A,0x79,0x42,0x00},		//   (168) ^i - 0x00EE Latin Small Letter I with Circumflex
-				{0x00,0x4A,0x78,0x42,0x00},		//   (169) "i - 0x00EF Latin Small Letter I with Diaeresis
-				{0x31,0x4A,0x4E,0x4A,0x30},		//   (170)    - 0x00F0 Latin Small Letter Eth
-				{0x7A,0x11,0x0A,0x09,0x70},		//   (171) ~n - 0x00F1 Latin Small Letter N with Tilde
-				{0x30,0x49,0x4A,0x48,0x30},		//   (172) `o - 0x00F2 Latin Small Letter O with Grave
-				{0x30,0x48,0x4A,0x49,0x30},		//   (173) 'o - 0x00F3 Latin Small Letter O with Acute
-				{0x30,0x4A,0x49,0x4A,0x30},		//   (174) ^o - 0x00F4 Latin Small Letter O with Circumflex
-				{0x30,0x4A,0x49,0x4A,0x31},		//   (175) ~o - 0x00F5 Latin Small Letter O with Tilde
-				{0x30,0x4A,0x48,0x4A,0x30},		//   (176) "o - 0x00F6 Latin Small Letter O with Diaeresis
-				{0x08,0x08,0x2A,0x08,0x08},		//   (177)  + - 0x00F7 Division Sign
-				{0x38,0x64,0x54,0x4C,0x38},		//   (178)  o - 0x00F8 Latin Small Letter O with Stroke
-				{0x38,0x41,0x42,0x20,0x78},		//   (179) `u - 0x00F9 Latin Small Letter U with Grave
-				{0x38,0x40,0x42,0x21,0x78},		//   (180) 'u - 0x00FA Latin Small Letter U with Acute
-				{0x38,0x42,0x41,0x22,0x78},		//   (181) ^u - 0x00FB Latin Small Letter U with Circumflex
-				{0x38,0x42,0x40,0x22,0x78},		//   (182) "u - 0x00FC Latin Small Letter U with Diaeresis
-				{0x0C,0x50,0x52,0x51,0x3C},		//   (183) 'y - 0x00FD Latin Small Letter Y with Acute
-				{0x7E,0x14,0x14,0x14,0x08},		//   (184)  p - 0x00FE Latin Small Letter Thom
-				{0x0C,0x51,0x50,0x51,0x3C},		//   (185) "y - 0x00FF Latin Small Letter Y with Diaeresis
-				{0x1E,0x09,0x09,0x29,0x5E},		//   (186)  A - 0x0104 Latin Capital Letter A with Ogonek
-				{0x08,0x15,0x15,0x35,0x4E},		//   (187)  a - 0x0105 Latin Small Letter A with Ogonek
-				{0x38,0x44,0x46,0x45,0x20},		//   (188) 'C - 0x0106 Latin Capital Letter C with Acute
-				{0x30,0x48,0x4A,0x49,0x20},		//   (189) 'c - 0x0107 Latin Small Letter C with Acute
-				{0x38,0x45,0x46,0x45,0x20},		//   (190)  C - 0x010C Latin Capital Letter C with Caron
-				{0x30,0x49,0x4A,0x49,0x20},		//   (191)  c - 0x010D Latin Small Letter C with Caron
-				{0x7C,0x45,0x46,0x45,0x38},		//   (192)  D - 0x010E Latin Capital Letter D with Caron
-				{0x20,0x50,0x50,0x7C,0x03},		//   (193) d' - 0x010F Latin Small Letter D with Caron
-				{0x1F,0x15,0x15,0x35,0x51},		//   (194)  E - 0x0118 Latin Capital Letter E with Ogonek
-				{0x0E,0x15,0x15,0x35,0x46},		//   (195)  e - 0x0119 Latin Small Letter E with Ogonek
-				{0x7C,0x55,0x56,0x55,0x44},		//   (196)  E - 0x011A Latin Capital Letter E with Caron
-				{0x38,0x55,0x56,0x55,0x18},		//   (197)  e - 0x011B Latin Small Letter E with Caron
-				{0x00,0x44,0x7C,0x40,0x00},		//   (198)  i - 0x0131 Latin Small Letter Dotless I
-				{0x7F,0x48,0x44,0x40,0x40},		//   (199)  L - 0x0141 Latin Capital Letter L with Stroke
-				{0x00,0x49,0x7F,0x44,0x00},		//   (200)  l - 0x0142 Latin Small Letter L with Stroke
-				{0x7C,0x08,0x12,0x21,0x7C},		//   (201) 'N - 0x0143 Latin Capital Letter N with Acute
-				{0x78,0x10,0x0A,0x09,0x70},		//   (202) 'n - 0x0144 Latin Small Letter N with Acute
-				{0x7C,0x09,0x12,0x21,0x7C},		//   (203)  N - 0x0147 Latin Capital Letter N with Caron
-				{0x78,0x11,0x0A,0x09,0x70},		//   (204)  n - 0x0148 Latin Small Letter N with Caron
-				{0x38,0x47,0x44,0x47,0x38},		//   (205) "O - 0x0150 Latin Capital Letter O with Double Acute
-				{0x30,0x4B,0x48,0x4B,0x30},		//   (206) "o - 0x0151 Latin Small Letter O with Double Acute
-				{0x3E,0x41,0x7F,0x49,0x49},		//   (207) OE - 0x0152 Latin Capital Ligature Oe
-				{0x38,0x44,0x38,0x54,0x58},		//   (208) oe - 0x0153 Latin Small Ligature Oe
-				{0x7C,0x15,0x16,0x35,0x48},		//   (209)  R - 0x0158 Latin Capital Letter R with Caron
-				{0x78,0x11,0x0A,0x09,0x10},		//   (210)  r - 0x0159 Latin Small Letter R with Caron
-				{0x48,0x54,0x56,0x55,0x20},		//   (211) 'S - 0x015A Latin Capital Letter S with Acute
-				{0x20,0x48,0x56,0x55,0x20},		//   (212) 's - 0x015B Latin Small Letter S with Acute
-				{0x48,0x55,0x56,0x55,0x20},		//   (213)  S - 0x0160 Latin Capital Letter S with Caron
-				{0x20,0x49,0x56,0x55,0x20},		//   (214)  s - 0x0161 Latin Small Letter S with Caron
-				{0x04,0x05,0x7E,0x05,0x04},		//   (215)  T - 0x0164 Latin Capital Letter T with Caron
-				{0x08,0x3C,0x48,0x22,0x01},		//   (216) t' - 0x0165 Latin Small Letter T with Caron
-				{0x3C,0x42,0x45,0x42,0x3C},		//   (217)  U - 0x016E Latin Capital Letter U with Ring Above
-				{0x38,0x42,0x45,0x22,0x78},		//   (218)  u - 0x016F Latin Small Letter U with Ring Above
-				{0x3C,0x43,0x40,0x43,0x3C},		//   (219) "U - 0x0170 Latin Capital Letter U with Double Acute
-				{0x38,0x43,0x40,0x23,0x78},		//   (220) "u - 0x0171 Latin Small Letter U with Double Acute
-				{0x0C,0x11,0x60,0x11,0x0C},		//   (221) "Y - 0x0178 Latin Capital Letter Y with Diaeresis
-				{0x44,0x66,0x55,0x4C,0x44},		//   (222) 'Z - 0x0179 Latin Capital Letter Z with Acute
-				{0x48,0x6A,0x59,0x48,0x00},		//   (223) 'z - 0x017A Latin Small Letter Z with Acute
-				{0x44,0x64,0x55,0x4C,0x44},		//   (224)  Z - 0x017B Latin Capital Letter Z with Dot Above
-				{0x48,0x68,0x5A,0x48,0x00},		//   (225)  z - 0x017C Latin Small Letter Z with Dot Above
-				{0x44,0x65,0x56,0x4D,0x44},		//   (226)  Z - 0x017D Latin Capital Letter Z with Caron
-				{0x48,0x69,0x5A,0x49,0x00},		//   (227)  z - 0x017E Latin Small Letter Z with Caron
-				{0x00,0x02,0x01,0x02,0x00},		//   (228)  ^ - 0x02C6 Modifier Letter Circumflex Accent
-				{0x00,0x01,0x02,0x01,0x00},		//   (229)    - 0x02C7 Caron
-				{0x00,0x01,0x01,0x01,0x00},		//   (230)    - 0x02C9 Modifier Letter Macron
-				{0x01,0x02,0x02,0x01,0x00},		//   (231)    - 0x02D8 Breve
-				{0x00,0x00,0x01,0x00,0x00},		//   (232)    - 0x02D9 Dot Above
-				{0x00,0x02,0x05,0x02,0x00},		//   (233)    - 0x02DA Ring Above
-				{0x02,0x01,0x02,0x01,0x00},		//   (234)  ~ - 0x02DC Small Tilde
-				{0x7F,0x05,0x15,0x3A,0x50},		//   (235) Pt - 0x20A7 Peseta Sign
-				{0x3E,0x55,0x55,0x41,0x22},		//   (236)  C - 0x20AC Euro Sign
-				{0x18,0x14,0x08,0x14,0x0C},		//   (237)    - 0x221E Infinity
-				{0x44,0x4A,0x4A,0x51,0x51},		//   (238)  < - 0x2264 Less-Than or Equal to
-				{0x51,0x51,0x4A,0x4A,0x44},		//   (239)  > - 0x2265 Greater-Than or Equal to
-				{0x74,0x42,0x41,0x42,0x74},		//   (240)    - 0x2302 House
-			};
-
-
-			const unsigned char Ascii_2[107][5]={		// Refer to "Times New Roman" Font Database...
-									//   Greek & Japanese Letters
-				{0x7E,0x11,0x11,0x11,0x7E},		//   (  1)  A - 0x0391 Greek Capital Letter Alpha
-				{0x7F,0x49,0x49,0x49,0x36},		//   (  2)  B - 0x0392 Greek Capital Letter Beta
-				{0x7F,0x02,0x01,0x01,0x03},		//   (  3)    - 0x0393 Greek Capital Letter Gamma
-				{0x70,0x4E,0x41,0x4E,0x70},		//   (  4)    - 0x0394 Greek Capital Letter Delta
-				{0x7F,0x49,0x49,0x49,0x41},		//   (  5)  E - 0x0395 Greek Capital Letter Epsilon
-				{0x61,0x51,0x49,0x45,0x43},		//   (  6)  Z - 0x0396 Greek Capital Letter Zeta
-				{0x7F,0x08,0x08,0x08,0x7F},		//   (  7)  H - 0x0397 Greek Capital Letter Eta
-				{0x3E,0x49,0x49,0x49,0x3E},		//   (  8)    - 0x0398 Greek Capital Letter Theta
-				{0x00,0x41,0x7F,0x41,0x00},		//   (  9)  I - 0x0399 Greek Capital Letter Iota
-				{0x7F,0x08,0x14,0x22,0x41},		//   ( 10)  K - 0x039A Greek Capital Letter Kappa
-				{0x70,0x0E,0x01,0x0E,0x70},		//   ( 11)    - 0x039B Greek Capital Letter Lamda
-				{0x7F,0x02,0x0C,0x02,0x7F},		//   ( 12)  M - 0x039C Greek Capital Letter Mu
-				{0x7F,0x04,0x08,0x10,0x7F},		//   ( 13)  N - 0x039D Greek Capital Letter Nu
-				{0x63,0x5D,0x49,0x5D,0x63},		//   ( 14)    - 0x039E Greek Capital Letter Xi
-				{0x3E,0x41,0x41,0x41,0x3E},		//   ( 15)  O - 0x039F Greek Capital Letter Omicron
-				{0x41,0x3F,0x01,0x3F,0x41},		//   ( 16)    - 0x03A0 Greek Capital Letter Pi
-				{0x7F,0x09,0x09,0x09,0x06},		//   ( 17)  P - 0x03A1 Greek Capital Letter Rho
-				{0x63,0x55,0x49,0x41,0x41},		//   ( 18)    - 0x03A3 Greek Capital Letter Sigma
-				{0x01,0x01,0x7F,0x01,0x01},		//   ( 19)  T - 0x03A4 Greek Capital Letter Tau
-				{0x03,0x01,0x7E,0x01,0x03},		//   ( 20)    - 0x03A5 Greek Capital Letter Upsilon
-				{0x08,0x55,0x7F,0x55,0x08},		//   ( 21)    - 0x03A6 Greek Capital Letter Phi
-				{0x63,0x14,0x08,0x14,0x63},		//   ( 22)  X - 0x03A7 Greek Capital Letter Chi
-				{0x07,0x48,0x7F,0x48,0x07},		//   ( 23)    - 0x03A8 Greek Capital Letter Psi
-				{0x5E,0x61,0x01,0x61,0x5E},		//   ( 24)    - 0x03A9 Greek Capital Letter Omega
-				{0x38,0x44,0x48,0x30,0x4C},		//   ( 25)  a - 0x03B1 Greek Small Letter Alpha
-				{0x7C,0x2A,0x2A,0x2A,0x14},		//   ( 26)  B - 0x03B2 Greek Small Letter Beta
-				{0x44,0x38,0x04,0x04,0x08},		//   ( 27)  r - 0x03B3 Greek Small Letter Gamma
-				{0x30,0x4B,0x4D,0x59,0x30},		//   ( 28)    - 0x03B4 Greek Small Letter Delta
-				{0x28,0x54,0x54,0x44,0x20},		//   ( 29)    - 0x03B5 Greek Small Letter Epsilon
-				{0x00,0x18,0x55,0x52,0x22},		//   ( 30)    - 0x03B6 Greek Small Letter Zeta
-				{0x3E,0x04,0x02,0x02,0x7C},		//   ( 31)  n - 0x03B7 Greek Small Letter Eta
-				{0x3C,0x4A,0x4A,0x4A,0x3C},		//   ( 32)    - 0x03B8 Greek Small Letter Theta
-				{0x00,0x3C,0x40,0x20,0x00},		//   ( 33)  i - 0x03B9 Greek Small Letter Iota
-				{0x7C,0x10,0x28,0x44,0x40},		//   ( 34)  k - 0x03BA Greek Small Letter Kappa
-				{0x41,0x32,0x0C,0x30,0x40},		//   ( 35)    - 0x03BB Greek Small Letter Lamda
-				{0x7E,0x20,0x20,0x10,0x3E},		//   ( 36)  u - 0x03BC Greek Small Letter Mu
-				{0x1C,0x20,0x40,0x20,0x1C},		//   ( 37)  v - 0x03BD Greek Small Letter Nu
-				{0x14,0x2B,0x2A,0x2A,0x60},		//   ( 38)    - 0x03BE Greek Small Letter Xi
-				{0x38,0x44,0x44,0x44,0x38},		//   ( 39)  o - 0x03BF Greek Small Letter Omicron
-				{0x44,0x3C,0x04,0x7C,0x44},		//   ( 40)    - 0x03C0 Greek Small Letter Pi
-				{0x70,0x28,0x24,0x24,0x18},		//   ( 41)  p - 0x03C1 Greek Small Letter Rho
-				{0x0C,0x12,0x12,0x52,0x60},		//   ( 42)    - 0x03C2 Greek Small Letter Final Sigma
-				{0x38,0x44,0x4C,0x54,0x24},		//   ( 43)    - 0x03C3 Greek Small Letter Sigma
-				{0x04,0x3C,0x44,0x20,0x00},		//   ( 44)  t - 0x03C4 Greek Small Letter Tau
-				{0x3C,0x40,0x40,0x20,0x1C},		//   ( 45)  v - 0x03C5 Greek Small Letter Upsilon
-				{0x18,0x24,0x7E,0x24,0x18},		//   ( 46)    - 0x03C6 Greek Small Letter Phi
-				{0x44,0x28,0x10,0x28,0x44},		//   ( 47)  x - 0x03C7 Greek Small Letter Chi
-				{0x0C,0x10,0x7E,0x10,0x0C},		//   ( 48)    - 0x03C8 Greek Small Letter Psi
-				{0x38,0x44,0x30,0x44,0x38},		//   ( 49)  w - 0x03C9 Greek Small Letter Omega
-				{0x0A,0x0A,0x4A,0x2A,0x1E},		//   ( 50)    - 0xFF66 Katakana Letter Wo
-				{0x04,0x44,0x34,0x14,0x0C},		//   ( 51)    - 0xFF67 Katakana Letter Small A
-				{0x20,0x10,0x78,0x04,0x00},		//   ( 52)    - 0xFF68 Katakana Letter Small I
-				{0x18,0x08,0x4C,0x48,0x38},		//   ( 53)    - 0xFF69 Katakana Letter Small U
-				{0x48,0x48,0x78,0x48,0x48},		//   ( 54)    - 0xFF6A Katakana Letter Small E
-				{0x48,0x28,0x18,0x7C,0x08},		//   ( 55)    - 0xFF6B Katakana Letter Small O
-				{0x08,0x7C,0x08,0x28,0x18},		//   ( 56)    - 0xFF6C Katakana Letter Small Ya
-				{0x40,0x48,0x48,0x78,0x40},		//   ( 57)    - 0xFF6D Katakana Letter Small Yu
-				{0x54,0x54,0x54,0x7C,0x00},		//   ( 58)    - 0xFF6E Katakana Letter Small Yo
-				{0x18,0x00,0x58,0x40,0x38},		//   ( 59)    - 0xFF6F Katakana Letter Small Tu
-				{0x08,0x08,0x08,0x08,0x08},		//   ( 60)    - 0xFF70 Katakana-Hiragana Prolonged Sound Mark
-				{0x01,0x41,0x3D,0x09,0x07},		//   ( 61)    - 0xFF71 Katakana Letter A
-				{0x10,0x08,0x7C,0x02,0x01},		//   ( 62)    - 0xFF72 Katakana Letter I
-				{0x0E,0x02,0x43,0x22,0x1E},		//   ( 63)    - 0xFF73 Katakana Letter U
-				{0x42,0x42,0x7E,0x42,0x42},		//   ( 64)    - 0xFF74 Katakana Letter E
-				{0x22,0x12,0x0A,0x7F,0x02},		//   ( 65)    - 0xFF75 Katakana Letter O
-				{0x42,0x3F,0x02,0x42,0x3E},		//   ( 66)    - 0xFF76 Katakana Letter Ka
-				{0x0A,0x0A,0x7F,0x0A,0x0A},		//   ( 67)    - 0xFF77 Katakana Letter Ki
-				{0x08,0x46,0x42,0x22,0x1E},		//   ( 68)    - 0xFF78 Katakana Letter Ku
-				{0x04,0x03,0x42,0x3E,0x02},		//   ( 69)    - 0xFF79 Katakana Letter Ke
-				{0x42,0x42,0x42,0x42,0x7E},		//   ( 70)    - 0xFF7A Katakana Letter Ko
-				{0x02,0x4F,0x22,0x1F,0x02},		//   ( 71)    - 0xFF7B Katakana Letter Sa
-				{0x4A,0x4A,0x40,0x20,0x1C},		//   ( 72)    - 0xFF7C Katakana Letter Shi
-				{0x42,0x22,0x12,0x2A,0x46},		//   ( 73)    - 0xFF7D Katakana Letter Su
-				{0x02,0x3F,0x42,0x4A,0x46},		//   ( 74)    - 0xFF7E Katakana Letter Se
-				{0x06,0x48,0x40,0x20,0x1E},		//   ( 75)    - 0xFF7F Katakana Letter So
-				{0x08,0x46,0x4A,0x32,0x1E},		//   ( 76)    - 0xFF80 Katakana Letter Ta
-				{0x0A,0x4A,0x3E,0x09,0x08},		//   ( 77)    - 0xFF81 Katakana Letter Chi
-				{0x0E,0x00,0x4E,0x20,0x1E},		//   ( 78)    - 0xFF82 Katakana Letter Tsu
-				{0x04,0x45,0x3D,0x05,0x04},		//   ( 79)    - 0xFF83 Katakana Letter Te
-				{0x00,0x7F,0x08,0x10,0x00},		//   ( 80)    - 0xFF84 Katakana Letter To
-				{0x44,0x24,0x1F,0x04,0x04},		//   ( 81)    - 0xFF85 Katakana Letter Na
-				{0x40,0x42,0x42,0x42,0x40},		//   ( 82)    - 0xFF86 Katakana Letter Ni
-				{0x42,0x2A,0x12,0x2A,0x06},		//   ( 83)    - 0xFF87 Katakana Letter Nu
-				{0x22,0x12,0x7B,0x16,0x22},		//   ( 84)    - 0xFF88 Katakana Letter Ne
-				{0x00,0x40,0x20,0x1F,0x00},		//   ( 85)    - 0xFF89 Katakana Letter No
-				{0x78,0x00,0x02,0x04,0x78},		//   ( 86)    - 0xFF8A Katakana Letter Ha
-				{0x3F,0x44,0x44,0x44,0x44},		//   ( 87)    - 0xFF8B Katakana Letter Hi
-				{0x02,0x42,0x42,0x22,0x1E},		//   ( 88)    - 0xFF8C Katakana Letter Fu
-				{0x04,0x02,0x04,0x08,0x30},		//   ( 89)    - 0xFF8D Katakana Letter He
-				{0x32,0x02,0x7F,0x02,0x32},		//   ( 90)    - 0xFF8E Katakana Letter Ho
-				{0x02,0x12,0x22,0x52,0x0E},		//   ( 91)    - 0xFF8F Katakana Letter Ma
-				{0x00,0x2A,0x2A,0x2A,0x40},		//   ( 92)    - 0xFF90 Katakana Letter Mi
-				{0x38,0x24,0x22,0x20,0x70},		//   ( 93)    - 0xFF91 Katakana Letter Mu
-				{0x40,0x28,0x10,0x28,0x06},		//   ( 94)    - 0xFF92 Katakana Letter Me
-				{0x0A,0x3E,0x4A,0x4A,0x4A},		//   ( 95)    - 0xFF93 Katakana Letter Mo
-				{0x04,0x7F,0x04,0x14,0x0C},		//   ( 96)    - 0xFF94 Katakana Letter Ya
-				{0x40,0x42,0x42,0x7E,0x40},		//   ( 97)    - 0xFF95 Katakana Letter Yu
-				{0x4A,0x4A,0x4A,0x4A,0x7E},		//   ( 98)    - 0xFF96 Katakana Letter Yo
-				{0x04,0x05,0x45,0x25,0x1C},		//   ( 99)    - 0xFF97 Katakana Letter Ra
-				{0x0F,0x40,0x20,0x1F,0x00},		//   (100)    - 0xFF98 Katakana Letter Ri
-				{0x7C,0x00,0x7E,0x40,0x30},		//   (101)    - 0xFF99 Katakana Letter Ru
-				{0x7E,0x40,0x20,0x10,0x08},		//   (102)    - 0xFF9A Katakana Letter Re
-				{0x7E,0x42,0x42,0x42,0x7E},		//   (103)    - 0xFF9B Katakana Letter Ro
-				{0x0E,0x02,0x42,0x22,0x1E},		//   (104)    - 0xFF9C Katakana Letter Wa
-				{0x42,0x42,0x40,0x20,0x18},		//   (105)    - 0xFF9D Katakana Letter N
-				{0x02,0x04,0x01,0x02,0x00},		//   (106)    - 0xFF9E Katakana Voiced Sound Mark
-				{0x07,0x05,0x07,0x00,0x00},		//   (107)    - 0xFF9F Katakana Semi-Voiced Sound Mark
-			};
-		#endif
+
+		//! @brief		One page of blank GDDRAM, sent once per page by SendInitTable().
+		static const uint8 ssd1306BlankRamPage[ssd1306_NUM_RAM_COLS] = { 0 };
 
 		//===============================================================================================//
 		//===================================== GLOBAL FUNCTIONS ========================================//
@@ -453,14 +94,88 @@ namespace MbeddedNinja
 
 		// See Doxygen documentation or function declarations in SSD1306.h for more info.
 
-		void Ssd1306::EnableI2c()
+		// OledInitVccInt() and OledInitVccExt() pass these by reference, so they need defining
+		template<uint8 numCols, uint8 numRows, class Transport>
+		constexpr ssd1306PanelProfile_t Ssd1306<numCols, numRows, Transport>::PROFILE_VCC_INT;
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		constexpr ssd1306PanelProfile_t Ssd1306<numCols, numRows, Transport>::PROFILE_VCC_EXT;
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		Ssd1306<numCols, numRows, Transport>::Ssd1306(uint8 i2cAddress)
 		{
+			this->i2cAddress = i2cAddress;
+			maxTransactionSize = portASYNC_MAX_TRANSACTION_SIZE;
+
+			// SSD1306 defaults to page addressing mode after reset
+			addressingMode = PAGE_ADDRESSING_MODE;
+			flushMode = FLUSH_MODE_PAGE;
+			planner = NULL;
+			numBusBytesWritten = 0;
+			trace = NULL;
+
+			cmdQueueLength = 0;
+			cmdQueueNumWrites = 0;
+			cmdBatchDepth = 0;
+			numCmdTransactionsSaved = 0;
+
+			flushBufferLength = 0;
+			numFlushTransactions = 0;
+			numFlushTransactionsSent = 0;
+			isCapturingFlush = false;
+			flushCallback = NULL;
+			flushCallbackContext = NULL;
+
+			#if(configSSD1306_STATS == 1)
+				statsSequence = 0;
+				statsLock = 0;
+				flushStartTimeUs = 0;
+			#endif
+			ClearStats();
+		}
 
-			port.I2cStart();
-			port.I2cEnableInt();
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::EnableI2c()
+		{
+			transport.Start(port);
 		}
 
-		void Ssd1306::SetI2cPort(Port::i2cPort_t i2cPort)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetI2cAddress(uint8 i2cAddress)
+		{
+			// Anything still being sent has to go to the old address
+			transport.WaitForWrite(port);
+
+			this->i2cAddress = i2cAddress;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		uint8 Ssd1306<numCols, numRows, Transport>::GetI2cAddress()
+		{
+			return i2cAddress;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetMaxTransactionSize(uint16 maxTransactionSize)
+		{
+			if(maxTransactionSize < ssd1306MIN_TRANSACTION_SIZE)
+				maxTransactionSize = ssd1306MIN_TRANSACTION_SIZE;
+			#if(portASYNC_MAX_TRANSACTION_SIZE < 65535)
+				if(maxTransactionSize > portASYNC_MAX_TRANSACTION_SIZE)
+					maxTransactionSize = portASYNC_MAX_TRANSACTION_SIZE;
+			#endif
+
+			this->maxTransactionSize = maxTransactionSize;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		uint16 Ssd1306<numCols, numRows, Transport>::GetMaxTransactionSize()
+		{
+			return maxTransactionSize;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetI2cPort(Port::i2cPort_t i2cPort)
 		{
 			#if(configDEBUG_SSD1306_VERBOSE == 1)
 				port.PrintDebug("SSD1306: Changing I2C port...\r\n");
@@ -482,47 +197,40 @@ namespace MbeddedNinja
 			}
 		}
 
-		void Ssd1306::EnableVddb()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		Port& Ssd1306<numCols, numRows, Transport>::GetPort()
+		{
+			return port;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		Transport& Ssd1306<numCols, numRows, Transport>::GetTransport()
+		{
+			return transport;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::EnableVddb()
 		{
 			// Enable OLED screens Vddb (P-ch MOSFETs)
-			PinCpRightVddbEnN_Write(0);
-			PinCpLeftVddbEnN_Write(0);
+			port.EnableVddb();
 		}
 
-		void Ssd1306::DisableVddb()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::DisableVddb()
 		{
 			// Disable OLED screens Vddb (P-ch MOSFETs)
-			PinCpRightVddbEnN_Write(1);
-			PinCpLeftVddbEnN_Write(1);
+			port.DisableVddb();
 		}
 		
-		void Ssd1306::OledInitVccExt()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::OledInitVccExt()
 		{
-
-			Reset();
-			DeactivateDisplay();		// Display Off (0xAE/0xAF)
-			SetDisplayClock(0x80);		// Set Clock as 200 Frames/Sec
-			SetMultiplexRatio(0x1F);		// 1/32 Duty (0x0F~0x3F)
-			SetDisplayOffset(0x00);		// Shift Mapping RAM Counter (0x00~0x3F)
-			SetStartLine(0x00);			// Set Mapping RAM Display Start Line (0x00~0x3F)
-			SetChargePumpOff();			// Disable Built-in DC/DC Converter (0x10/0x14)
-			SetAddressingMode(Ssd1306::PAGE_ADDRESSING_MODE);		// Set Page Addressing Mode (0x00/0x01/0x02)
-			SetSegmentRemap(0xA1);		// Set SEG/Column Mapping (0xA0/0xA1)
-			SetCommonRemap(0xC8);			// Set COM/Row Scan Direction (0xC0/0xC8)
-			SetComPinConfig(0x02);		// Set Alternative Configuration (0x02/0x12)
-			SetContrastControl(0xFF);	// Set SEG Output Current
-			SetPrechargePeriod(0x22);		// Set Pre-Charge as 2 Clocks & Discharge as 2 Clocks
-			SetVCOMH(0x40);			// Set VCOM Deselect Level
-			TurnEveryPixelOff();		// Disable Entire Display On (0xA4/0xA5)
-			SetInverseDisplay(false);		// Disable Inverse Display On (0xA6/0xA7)
-
-			FillRam(0x00);				// Clear Screen
-
-			ActivateDisplay();		// Display On (0xAE/0xAF)
-
+			OledInit<PROFILE_VCC_EXT>();
 		}
 		
-		void Ssd1306::OledInitVccInt()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::OledInitVccInt()
 		{
 
 			// Applicable to both left and right
@@ -531,37 +239,55 @@ namespace MbeddedNinja
 
 			// LEFT
 			SetI2cPort(SSD1306Ns::Port::i2cLeft);
-			Reset();
 
-			//! @debug
-			SetChargePumpOn();
+			OledInit<PROFILE_VCC_INT>();
+		}
 
-			ActivateDisplay();
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SendInitTable(const ssd1306InitTable_t &initTable)
+		{
+			Port::ioVector_t vectors[ssd1306_NUM_RAM_PAGES];
+			uint8 page;
 
-			SetDisplayClock(0x80);			// Set Clock as 175 Frames/Sec
-			SetMultiplexRatio(0x1F);		// 1/32 Duty (0x0F~0x3F)
-			SetDisplayOffset(0x00);			// Shift Mapping RAM Counter (0x00~0x3F)
-			SetStartLine(0x00);				// Set Mapping RAM Display Start Line (0x00~0x3F)
-			SetAddressingMode(Ssd1306::PAGE_ADDRESSING_MODE);		// Set Page Addressing Mode (0x00/0x01/0x02)
-			SetSegmentRemap(0xA1);			// Set SEG/Column Mapping (0xA0/0xA1)
-			SetCommonRemap(0xC8);			// Set COM/Row Scan Direction (0xC0/0xC8)
+			#if(configDEBUG_SSD1306_VERBOSE == 1)
+				port.PrintDebug("SSD1306: Initialising...\r\n");
+			#endif
 
-			// This next one is important for pixels to be mapped correctly.
-			// Sets COM pin config to sequential mapped
-			SetComPinConfig(0x02);
+			Reset();
 
-			// Set contrast to full
-			SetContrastControl(0xFF);
+			// Blank screen. The reset has marked the whole frame buffer dirty.
+			frameBuffer.Fill(0x00);
+
+			// The table and the window for the clear go out as one command transaction, then
+			// the whole RAM as one data transaction
+			BeginCommandBatch();
+			WriteCommandArray(initTable.commands, ssd1306INIT_TABLE_SIZE);
+
+			// All 8 pages of GDDRAM, not just the ones the panel shows, as the rest come into
+			// view when the display start line is moved (e.g. Animator::StartScroll()). All 128
+			// columns of each, whatever the width of the panel.
+			SetAddressingMode(HORIZONTAL_ADDRESSING_MODE);
+			SetColumnAddress(0, ssd1306_NUM_RAM_COLS - 1);
+			SetPageAddress(0, ssd1306_NUM_RAM_PAGES - 1);
+			for(page = 0; page < ssd1306_NUM_RAM_PAGES; page++)
+			{
+				vectors[page].data = ssd1306BlankRamPage;
+				vectors[page].numBytes = ssd1306_NUM_RAM_COLS;
+			}
+			WriteDataVectored(vectors, ssd1306_NUM_RAM_PAGES);
 
-			// Set pre-charge as 15 DCLKs and discharge as 1 DCLKs (0b11110001)
-			//ssd1306.SetPrechargePeriod(0xF1);
-			SetPrechargePeriod(0xF1);
+			frameBuffer.ClearDirty();
+			if(planner != NULL)
+				planner->Sync(frameBuffer);
 
-			// Make screen blank
-			FillRam(0x00);
+			// Back to page addressing mode (as after a reset), and display on
+			EnterPageAddressingMode();
+			ActivateDisplay();
+			EndCommandBatch();
 		}
 
-		void Ssd1306::Reset()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::Reset()
 		{
 			#if(configDEBUG_SSD1306_VERBOSE == 1)
 				port.PrintDebug("SSD1306: Resetting...\r\n");
@@ -574,9 +300,16 @@ namespace MbeddedNinja
 			port.DelayUs(ssd1306_RESET_DELAY_TIME_US);
 
 			port.PullResetHigh();
+
+			// RAM contents are no longer known, next flush has to send everything
+			frameBuffer.Invalidate();
+
+			// Addressing mode goes back to default
+			addressingMode = PAGE_ADDRESSING_MODE;
 		}
 
-		void Ssd1306::SetChargePumpOn()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetChargePumpOn()
 		{
 			#if(configDEBUG_SSD1306_VERBOSE == 1)
 				port.PrintDebug("SSD1306: Enabling charge pump...\r\n");
@@ -591,7 +324,8 @@ namespace MbeddedNinja
 			WriteCommandArray(commandArray, 2);
 		}
 
-		void Ssd1306::SetChargePumpOff()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetChargePumpOff()
 		{
 			uint8 commandArray[2];
 
@@ -607,7 +341,8 @@ namespace MbeddedNinja
 			WriteCommandArray(commandArray, 2);
 		}
 
-		void Ssd1306::ActivateDisplay()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::ActivateDisplay()
 		{
 			#if(configDEBUG_SSD1306_VERBOSE == 1)
 				port.PrintDebug("SSD1306: Turning display on...\r\n");
@@ -617,7 +352,8 @@ namespace MbeddedNinja
 			WriteCommand(ssd1306REG_VAL_ACTIVATE_DISPLAY);
 		}
 
-		void Ssd1306::DeactivateDisplay()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::DeactivateDisplay()
 		{
 			#if(configDEBUG_SSD1306_VERBOSE == 1)
 				port.PrintDebug("SSD1306: Turning display off...\r\n");
@@ -627,7 +363,8 @@ namespace MbeddedNinja
 			WriteCommand(ssd1306REG_VAL_DEACTIVATE_DISPLAY);
 		}
 	
-		void Ssd1306::TurnEveryPixelOn()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::TurnEveryPixelOn()
 		{
 			uint8 commandArray[1];
 
@@ -640,7 +377,8 @@ namespace MbeddedNinja
 			WriteCommandArray(commandArray, 1);
 		}
 	
-		void Ssd1306::TurnEveryPixelOff()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::TurnEveryPixelOff()
 		{
 			#if(configDEBUG_SSD1306_VERBOSE == 1)
 				port.PrintDebug("SSD1306: Turning entire display off...\r\n");
@@ -653,7 +391,8 @@ namespace MbeddedNinja
 			WriteCommandArray(commandArray, 1);
 		}
 
-		void Ssd1306::ShowPattern(
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::ShowPattern(
 			uint8 *pixelArray,
 			uint8 startPage,
 			uint8 endPage,
@@ -661,7 +400,7 @@ namespace MbeddedNinja
 			uint8 totalCol)
 		{
 			uint8 *pixelPointer;
-			uint8 i,j;
+			uint8 i;
 
 			#if(configDEBUG_SSD1306 == 1)
 				port.PrintDebug("SSD1306: Showing pattern...\r\n");
@@ -670,65 +409,296 @@ namespace MbeddedNinja
 			// Assign pixel pointer to the start of the array
 			pixelPointer = &pixelArray[0];
 			
-			//! @todo Add bounds checking
-			for(i = startPage; i < (endPage+1); i++)
+			// Frame buffer clips anything that falls off the screen
+			for(i = startPage; (i < (endPage+1)) && (i < NUM_PAGES); i++)
 			{
-				SetStartPage(i);
-				SetStartColumn(startCol);
+				// Write a page worth of pixels (8 pixels per byte)
+				frameBuffer.WriteBytes(i, startCol, pixelPointer, totalCol);
+				pixelPointer += totalCol;
+			}
+		}
 
-				// Start transmission
-				port.I2cMasterSendStart(SSD1306_I2C_ADD, 0);
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::Flush()
+		{
+			#if(configDEBUG_SSD1306_VERBOSE == 1)
+				port.PrintDebug("SSD1306: Flushing frame buffer...\r\n");
+			#endif
 
-				// Indicate we are writing data (ssd1306DATA_FOLLOWS_BYTE), not a command (0x00)
-				port.I2cMasterWriteByte(ssd1306DATA_FOLLOWS_BYTE);
+			// Screen is only up to date once any flush started with FlushAsync() has finished
+			transport.WaitForWrite(port);
 
-				for(j = 0; j < totalCol; j++)
-				{
-					// Write byte of pixels (settings for 8 pixels)
-					port.I2cMasterWriteByte(*pixelPointer);
-					pixelPointer++;
-				}
+			if(!frameBuffer.IsDirty())
+				return;
+
+			#if(configSSD1306_STATS == 1)
+				flushStartTimeUs = Port::GetTimeUs();
+			#endif
+
+			FlushDirty();
+
+			frameBuffer.ClearDirty();
+
+			#if(configSSD1306_STATS == 1)
+				CountFlush();
+			#endif
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		bool Ssd1306<numCols, numRows, Transport>::FlushAsync(flushCallback_t callback, void *context)
+		{
+			Port::ioVector_t payload;
+			uint8 result;
+			uint8 i;
+
+			#if(configDEBUG_SSD1306_VERBOSE == 1)
+				port.PrintDebug("SSD1306: Starting asynchronous flush...\r\n");
+			#endif
+
+			// Previous flush (or a scheduled one) is still using flushBuffer
+			if(transport.IsWriteBusy(port) || (numFlushTransactionsSent < numFlushTransactions))
+				return false;
+
+			if(!frameBuffer.IsDirty())
+			{
+				if(callback != NULL)
+					callback(this, context);
+				return true;
+			}
+
+			#if(configSSD1306_STATS == 1)
+				flushStartTimeUs = Port::GetTimeUs();
+			#endif
+
+			CaptureFlush();
+
+			// Sent by the port, not SendNextTransaction()
+			numFlushTransactionsSent = numFlushTransactions;
 
-				// End transmission
-				port.I2cMasterSendStop();
+			// Counted and recorded before they are started, as the port may finish them in the background
+			for(i = 0; i < numFlushTransactions; i++)
+			{
+				payload.data = flushTransactions[i].data + 1;
+				payload.numBytes = flushTransactions[i].numBytes - 1;
+
+				#if(configSSD1306_STATS == 1)
+					CountTransaction(flushTransactions[i].data[0], payload.numBytes);
+				#endif
+
+				if(trace != NULL)
+					trace->Record(i2cAddress, flushTransactions[i].data[0], &payload, 1);
 			}
+
+			flushCallback = callback;
+			flushCallbackContext = context;
+
+			result = transport.StartWrite(
+				port,
+				i2cAddress,
+				flushTransactions,
+				numFlushTransactions,
+				&Ssd1306::FlushAsyncComplete,
+				this);
+
+			ReportTransferResult(result);
+
+			return true;
 		}
 
-		void Ssd1306::WriteData(uint8 cmd)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		bool Ssd1306<numCols, numRows, Transport>::IsBusy()
 		{
-			port.I2cMasterSendStart(SSD1306_I2C_ADD, 0);
-			port.I2cMasterWriteByte(ssd1306DATA_FOLLOWS_BYTE);
-			port.I2cMasterWriteByte(cmd);
-			port.I2cMasterSendStop();
+			return transport.IsWriteBusy(port);
 		}
 
-		void Ssd1306::FillRam(unsigned char byteToFillRamWith)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::Wait()
 		{
-			// Fills RAM with constant single byte
-			unsigned char i,j;
+			transport.WaitForWrite(port);
+		}
 
-			#if(configDEBUG_SSD1306 == 1)
-				port.PrintDebug("SSD1306: Filling RAM with constant byte...\r\n");
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::ServiceFlush()
+		{
+			transport.ServiceWrite(port);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		bool Ssd1306<numCols, numRows, Transport>::StartScheduledFlush()
+		{
+			// Previous flush is still using flushBuffer
+			if((numFlushTransactionsSent < numFlushTransactions) || transport.IsWriteBusy(port))
+				return false;
+
+			if(!frameBuffer.IsDirty())
+			{
+				numFlushTransactions = 0;
+				numFlushTransactionsSent = 0;
+				return true;
+			}
+
+			#if(configSSD1306_STATS == 1)
+				flushStartTimeUs = Port::GetTimeUs();
+			#endif
+
+			CaptureFlush();
+			numFlushTransactionsSent = 0;
+
+			#if(configSSD1306_STATS == 1)
+				// Nothing to send, so SendNextTransaction() won't finish it
+				if(numFlushTransactions == 0)
+					CountFlush();
+			#endif
+
+			return true;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		uint16 Ssd1306<numCols, numRows, Transport>::GetNextTransactionSize()
+		{
+			if(numFlushTransactionsSent >= numFlushTransactions)
+				return 0;
+
+			// Control byte is already part of the transaction (and isn't sent on SPI)
+			return flushTransactions[numFlushTransactionsSent].numBytes - 1 + transport.GetOverheadBytes(port);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		uint8 Ssd1306<numCols, numRows, Transport>::SendNextTransaction()
+		{
+			const Port::ioVector_t *transaction;
+			Port::ioVector_t payload;
+			uint8 result;
+
+			if(numFlushTransactionsSent >= numFlushTransactions)
+				return Port::TRANSFER_OK;
+
+			transaction = &flushTransactions[numFlushTransactionsSent];
+
+			// First byte is the control byte
+			payload.data = transaction->data + 1;
+			payload.numBytes = transaction->numBytes - 1;
+
+			#if(configSSD1306_STATS == 1)
+				CountTransaction(transaction->data[0], payload.numBytes);
+			#endif
+
+			if(trace != NULL)
+				trace->Record(i2cAddress, transaction->data[0], &payload, 1);
+
+			result = transport.Write(port, i2cAddress, transaction->data[0], &payload, 1);
+
+			numFlushTransactionsSent++;
+
+			ReportTransferResult(result);
+
+			#if(configSSD1306_STATS == 1)
+				if(numFlushTransactionsSent == numFlushTransactions)
+					CountFlush();
 			#endif
 
-			for(i = 0; i < 4; i++)
+			return result;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		bool Ssd1306<numCols, numRows, Transport>::LoadFrame(FrameMailbox<numCols, numRows> &mailbox)
+		{
+			const FrameBuffer<numCols, numRows> *frame;
+			uint8 page;
+
+			frame = mailbox.Acquire();
+			if(frame == NULL)
+				return false;
+
+			// Compare-on-write, so only the changes since the last frame end up dirty
+			for(page = 0; page < NUM_PAGES; page++)
 			{
-				SetStartPage(i);
-				SetStartColumn(0x00);
+				frameBuffer.WriteBytes(page, 0, frame->GetPage(page), NUM_COLS);
+			}
+
+			return true;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetFlushMode(flushMode_t flushMode)
+		{
+			this->flushMode = flushMode;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetTransferPlanner(TransferPlanner<numCols, numRows> *planner)
+		{
+			this->planner = planner;
 
-				port.I2cMasterSendStart(SSD1306_I2C_ADD, 0);
-				port.I2cMasterWriteByte(ssd1306DATA_FOLLOWS_BYTE);
+			if(planner != NULL)
+				planner->Invalidate();
+		}
 
-				for(j = 0; j < 128; j++)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		uint32 Ssd1306<numCols, numRows, Transport>::GetNumBusBytesWritten()
+		{
+			return numBusBytesWritten;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		bool Ssd1306<numCols, numRows, Transport>::GetStats(ssd1306Stats_t &stats)
+		{
+			#if(configSSD1306_STATS == 1)
+				uint32 sequence;
+
+				// Copy again if a flush finishing in the background changed them part way through
+				do
 				{
-					port.I2cMasterWriteByte(byteToFillRamWith);
-				}
+					sequence = statsSequence;
+					Port::MemoryBarrier();
+					stats = this->stats;
+					stats.numBusBytes = numBusBytesWritten - statsBusBytesAtClear;
+					Port::MemoryBarrier();
+				} while((sequence & 1) || (sequence != statsSequence));
+
+				return true;
+			#else
+				memset(&stats, 0, sizeof(stats));
+				return false;
+			#endif
+		}
 
-				port.I2cMasterSendStop();
-			}
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::ClearStats()
+		{
+			#if(configSSD1306_STATS == 1)
+				BeginStatsUpdate();
+				memset(&stats, 0, sizeof(stats));
+				statsBusBytesAtClear = numBusBytesWritten;
+				EndStatsUpdate();
+			#endif
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetBusTrace(BusTrace *trace)
+		{
+			this->trace = trace;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::WriteData(uint8 cmd)
+		{
+			WriteDataArray(&cmd, 1);
 		}
 
-		void Ssd1306::SetDisplayClock(uint8 regVal)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::FillRam(unsigned char byteToFillRamWith)
+		{
+			// Fills RAM with constant single byte
+			#if(configDEBUG_SSD1306 == 1)
+				port.PrintDebug("SSD1306: Filling RAM with constant byte...\r\n");
+			#endif
+
+			frameBuffer.Fill(byteToFillRamWith);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetDisplayClock(uint8 regVal)
 		{
 			uint8 command[2];
 
@@ -747,7 +717,8 @@ namespace MbeddedNinja
 
 		}
 
-		void Ssd1306::SetAddressingMode(addressingMode_t addressingMode)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetAddressingMode(addressingMode_t addressingMode)
 		{
 			uint8 cmdArray[2];
 
@@ -765,9 +736,12 @@ namespace MbeddedNinja
 			cmdArray[1] = (uint8)addressingMode;
 
 			WriteCommandArray(cmdArray, 2);
+
+			this->addressingMode = addressingMode;
 		}
 
-		void Ssd1306::SetSegmentRemap(uint8 regVal)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetSegmentRemap(uint8 regVal)
 		{
 			uint8 cmdArray[1];
 
@@ -784,7 +758,8 @@ namespace MbeddedNinja
 			WriteCommandArray(cmdArray, 1);
 		}
 
-		void Ssd1306::SetCommonRemap(uint8 regVal)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetCommonRemap(uint8 regVal)
 		{
 			uint8 cmdArray[1];
 
@@ -801,7 +776,8 @@ namespace MbeddedNinja
 			WriteCommandArray(cmdArray, 1);
 		}
 
-		void Ssd1306::SetDisplayOffset(uint8 regVal)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetDisplayOffset(uint8 regVal)
 		{
 			uint8 cmdArray[2];
 
@@ -817,7 +793,8 @@ namespace MbeddedNinja
 			WriteCommandArray(cmdArray, 2);
 		}
 
-		void Ssd1306::SetStartLine(uint8 regVal)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetStartLine(uint8 regVal)
 		{
 			uint8 cmdArray[1];
 
@@ -832,7 +809,8 @@ namespace MbeddedNinja
 			WriteCommandArray(cmdArray, 1);
 		}
 
-		void Ssd1306::SetComPinConfig(uint8 regVal)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetComPinConfig(uint8 regVal)
 		{
 			uint8 cmdArray[2];
 
@@ -850,7 +828,8 @@ namespace MbeddedNinja
 			WriteCommandArray(cmdArray, 2);
 		}
 
-		void Ssd1306::SetContrastControl(uint8 d)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetContrastControl(uint8 d)
 		{
 			uint8 cmdArray[2];
 
@@ -866,7 +845,8 @@ namespace MbeddedNinja
 			WriteCommandArray(cmdArray, 2);
 		}
 
-		void Ssd1306::SetPrechargePeriod(uint8 d)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetPrechargePeriod(uint8 d)
 		{
 			uint8 cmdArray[2];
 
@@ -884,7 +864,8 @@ namespace MbeddedNinja
 			WriteCommandArray(cmdArray, 2);
 		}
 
-		void Ssd1306::SetVCOMH(uint8 d)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetVCOMH(uint8 d)
 		{
 			uint8 cmdArray[2];
 
@@ -900,7 +881,8 @@ namespace MbeddedNinja
 			WriteCommandArray(cmdArray, 2);
 		}
 
-		void Ssd1306::SetInverseDisplay(bool isInverse)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetInverseDisplay(bool isInverse)
 		{
 			uint8 cmdArray[1];
 
@@ -929,97 +911,321 @@ namespace MbeddedNinja
 
 		//========================================= WRITING COMMANDS ====================================//
 
-		void Ssd1306::WriteCommand(unsigned char cmd)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::WriteCommand(unsigned char cmd)
+		{
+			WriteCommandArray(&cmd, 1);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::WriteCommandArray(const uint8 *commandArray, uint8 numCommands)
 		{
-			uint8 error;
+			Port::ioVector_t vector;
+			uint8 i;
 
-			error = port.I2cMasterSendStart(SSD1306_I2C_ADD, 0);
+			// Make room in the queue if these commands don't fit
+			if((cmdQueueLength + numCommands) > ssd1306CMD_QUEUE_SIZE)
+				CommitCommands();
 
-			if(error != I2cCpLeft_MSTR_NO_ERROR)
+			if(numCommands > ssd1306CMD_QUEUE_SIZE)
 			{
-				#if(configDEBUG_SSD1306_ERROR == 1)
-					port.PrintDebug((char*)"SSD1306: Error. Sending start condition over I2C failed.\r\n");
-				#endif
+				// Too big to queue, send on it's own.
+				// Control byte indicates commands rather than data are coming
+				vector.data = commandArray;
+				vector.numBytes = numCommands;
+				WriteTransaction(ssd1306CMD_FOLLOWS_BYTE, &vector, 1);
+				return;
 			}
 
-			error = port.I2cMasterWriteByte(ssd1306CMD_FOLLOWS_BYTE);
-
-			if(error != I2cCpLeft_MSTR_NO_ERROR)
+			for(i = 0; i < numCommands; i++)
 			{
-				#if(configDEBUG_SSD1306_ERROR == 1)
-					port.PrintDebug((char*)"SSD1306: Error. Sending byte over I2C failed.\r\n");
-				#endif
+				cmdQueue[cmdQueueLength++] = commandArray[i];
 			}
+			cmdQueueNumWrites++;
 
-			error = port.I2cMasterWriteByte(cmd);
+			// Implicit commit if not batching
+			if(cmdBatchDepth == 0)
+				CommitCommands();
+		}
 
-			if(error != I2cCpLeft_MSTR_NO_ERROR)
-			{
-				#if(configDEBUG_SSD1306_ERROR == 1)
-					port.PrintDebug((char*)"SSD1306: Error. Sending byte over I2C failed.\r\n");
-				#endif
-			}
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::BeginCommandBatch()
+		{
+			cmdBatchDepth++;
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::EndCommandBatch()
+		{
+			if(cmdBatchDepth == 0)
+				return;
 
-			error = port.I2cMasterSendStop();
+			cmdBatchDepth--;
 
-			if(error != I2cCpLeft_MSTR_NO_ERROR)
-			{
-				#if(configDEBUG_SSD1306_ERROR == 1)
-					port.PrintDebug("SSD1306: Error. Sending stop condition over I2C failed.\r\n");
-				#endif
-			}
+			if(cmdBatchDepth == 0)
+				CommitCommands();
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::CommitCommands()
+		{
+			Port::ioVector_t vector;
+
+			if(cmdQueueLength == 0)
+				return;
+
+			// Control byte indicates commands rather than data are coming
+			vector.data = cmdQueue;
+			vector.numBytes = cmdQueueLength;
+			WriteTransaction(ssd1306CMD_FOLLOWS_BYTE, &vector, 1);
 
+			// Every write after the first one would have been a transaction of it's own
+			numCmdTransactionsSaved += cmdQueueNumWrites - 1;
 
+			cmdQueueLength = 0;
+			cmdQueueNumWrites = 0;
 		}
 
-		void Ssd1306::WriteCommandArray(uint8 *commandArray, uint8 numCommands)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		uint32 Ssd1306<numCols, numRows, Transport>::GetNumCmdTransactionsSaved()
 		{
-			uint8 error;
-			uint8 commandIndex = 0;
+			return numCmdTransactionsSaved;
+		}
 
-			error = port.I2cMasterSendStart(SSD1306_I2C_ADD, 0);
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::WriteDataVectored(const Port::ioVector_t *vectors, uint8 numVectors)
+		{
+			// Queued commands (e.g. cursor setup) have to reach the SSD1306 before the data
+			CommitCommands();
 
-			if(error != I2cCpLeft_MSTR_NO_ERROR)
+			WriteTransaction(ssd1306DATA_FOLLOWS_BYTE, vectors, numVectors);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::WriteDataArray(const uint8 *dataArray, uint16 numBytes)
+		{
+			Port::ioVector_t vector;
+
+			// Queued commands (e.g. cursor setup) have to reach the SSD1306 before the data
+			CommitCommands();
+
+			// Control byte indicates data rather than commands are coming
+			vector.data = dataArray;
+			vector.numBytes = numBytes;
+			WriteTransaction(ssd1306DATA_FOLLOWS_BYTE, &vector, 1);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::WriteTransaction(uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors)
+		{
+			uint8 result;
+			uint8 i;
+
+			if(isCapturingFlush)
 			{
-				#if(configDEBUG_SSD1306_ERROR == 1)
-					port.PrintDebug("SSD1306: Error. Sending start condition over I2C failed.\r\n");
-				#endif
+				CaptureTransaction(controlByte, vectors, numVectors);
+				return;
 			}
 
-			// Write byte to indicate a command rather than data is coming
-			error = port.I2cMasterWriteByte(ssd1306CMD_FOLLOWS_BYTE);
-			
-			if(error != I2cCpLeft_MSTR_NO_ERROR)
+			// Address and control byte (none on SPI)
+			numBusBytesWritten += transport.GetOverheadBytes(port);
+			for(i = 0; i < numVectors; i++)
 			{
-				#if(configDEBUG_SSD1306_ERROR == 1)
-					port.PrintDebug("SSD1306: Error. Sending byte over I2C failed.\r\n");
-				#endif
+				numBusBytesWritten += vectors[i].numBytes;
 			}
-			
-			// Write the command bytes
-			while(commandIndex < numCommands)
+
+			// A flush started with FlushAsync() may still be using the bus
+			transport.WaitForWrite(port);
+
+			#if(configSSD1306_STATS == 1)
+				uint32 numPayloadBytes = 0;
+
+				for(i = 0; i < numVectors; i++)
+				{
+					numPayloadBytes += vectors[i].numBytes;
+				}
+				CountTransaction(controlByte, numPayloadBytes);
+			#endif
+
+			if(trace != NULL)
+				trace->Record(i2cAddress, controlByte, vectors, numVectors);
+
+			result = transport.Write(port, i2cAddress, controlByte, vectors, numVectors);
+
+			ReportTransferResult(result);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::CaptureTransaction(uint8 controlByte, const Port::ioVector_t *vectors, uint8 numVectors)
+		{
+			uint8 vectorIndex;
+			uint16 byteIndex;
+			bool isNewTransaction = true;
+
+			for(vectorIndex = 0; vectorIndex < numVectors; vectorIndex++)
 			{
-				error = port.I2cMasterWriteByte(commandArray[commandIndex]);
+				for(byteIndex = 0; byteIndex < vectors[vectorIndex].numBytes; byteIndex++)
+				{
+					// Start another transaction (with the control byte again) if the port can't send
+					// one this long. The SSD1306 carries on from where the last one stopped.
+					if(!isNewTransaction && (flushTransactions[numFlushTransactions - 1].numBytes >= maxTransactionSize))
+						isNewTransaction = true;
+
+					if(isNewTransaction)
+					{
+						if((numFlushTransactions >= MAX_FLUSH_TRANSACTIONS) || (flushBufferLength + 2 > FLUSH_BUFFER_SIZE))
+						{
+							#if(configDEBUG_SSD1306_ERROR == 1)
+								port.PrintDebug("SSD1306: Error. Flush buffer full.\r\n");
+							#endif
+							return;
+						}
+
+						flushTransactions[numFlushTransactions].data = &flushBuffer[flushBufferLength];
+						flushTransactions[numFlushTransactions].numBytes = 1;
+						numFlushTransactions++;
+						flushBuffer[flushBufferLength++] = controlByte;
+						isNewTransaction = false;
+
+						// Address and control byte (none on SPI)
+						numBusBytesWritten += transport.GetOverheadBytes(port);
+					}
 
-				if(error != I2cCpLeft_MSTR_NO_ERROR)
+					if(flushBufferLength >= FLUSH_BUFFER_SIZE)
+					{
+						#if(configDEBUG_SSD1306_ERROR == 1)
+							port.PrintDebug("SSD1306: Error. Flush buffer full.\r\n");
+						#endif
+						return;
+					}
+
+					flushBuffer[flushBufferLength++] = vectors[vectorIndex].data[byteIndex];
+					flushTransactions[numFlushTransactions - 1].numBytes++;
+					numBusBytesWritten++;
+				}
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::FlushAsyncComplete(void *context, uint8 result)
+		{
+			Ssd1306 *ssd1306 = (Ssd1306*)context;
+
+			ssd1306->ReportTransferResult(result);
+
+			#if(configSSD1306_STATS == 1)
+				ssd1306->CountFlush();
+			#endif
+
+			if(ssd1306->flushCallback != NULL)
+				ssd1306->flushCallback(ssd1306, ssd1306->flushCallbackContext);
+		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::ReportTransferResult(uint8 result)
+		{
+			#if(configSSD1306_STATS == 1)
+				if(result != Port::TRANSFER_OK)
 				{
-					#if(configDEBUG_SSD1306_ERROR == 1)
+					BeginStatsUpdate();
+					switch(result)
+					{
+						case Port::TRANSFER_ERROR_START:
+							stats.numStartErrors++;
+							break;
+						case Port::TRANSFER_ERROR_BYTE:
+							stats.numByteErrors++;
+							break;
+						case Port::TRANSFER_ERROR_STOP:
+							stats.numStopErrors++;
+							break;
+						case Port::TRANSFER_BUSY:
+							stats.numBusyErrors++;
+							break;
+					}
+					EndStatsUpdate();
+				}
+			#endif
+
+			#if(configDEBUG_SSD1306_ERROR == 1)
+				switch(result)
+				{
+					case Port::TRANSFER_ERROR_START:
+						port.PrintDebug("SSD1306: Error. Sending start condition over I2C failed.\r\n");
+						break;
+					case Port::TRANSFER_ERROR_BYTE:
 						port.PrintDebug("SSD1306: Error. Sending byte over I2C failed.\r\n");
-					#endif
+						break;
+					case Port::TRANSFER_ERROR_STOP:
+						port.PrintDebug("SSD1306: Error. Sending stop condition over I2C failed.\r\n");
+						break;
+					case Port::TRANSFER_BUSY:
+						port.PrintDebug("SSD1306: Error. I2C port busy with another write.\r\n");
+						break;
 				}
+			#else
+				(void)result;
+			#endif
+		}
 
-				commandIndex++;
+		#if(configSSD1306_STATS == 1)
+			template<uint8 numCols, uint8 numRows, class Transport>
+			void Ssd1306<numCols, numRows, Transport>::BeginStatsUpdate()
+			{
+				// Counters are updated from the app, the port's worker thread (or interrupt) and
+				// DisplayScheduler's worker, so only one may change them at a time
+				statsInterruptState = Port::EnterCritical(&statsLock);
+				statsSequence++;
+				Port::MemoryBarrier();
 			}
 
-			error = port.I2cMasterSendStop();
+			template<uint8 numCols, uint8 numRows, class Transport>
+			void Ssd1306<numCols, numRows, Transport>::EndStatsUpdate()
+			{
+				Port::MemoryBarrier();
+				statsSequence++;
+				Port::ExitCritical(&statsLock, statsInterruptState);
+			}
 
-			if(error != I2cCpLeft_MSTR_NO_ERROR)
+			template<uint8 numCols, uint8 numRows, class Transport>
+			void Ssd1306<numCols, numRows, Transport>::CountTransaction(uint8 controlByte, uint32 numPayloadBytes)
 			{
-				#if(configDEBUG_SSD1306_ERROR == 1)
-					port.PrintDebug("SSD1306: Error. Sending stop condition over I2C failed.\r\n");
-				#endif
+				BeginStatsUpdate();
+				stats.numTransactions++;
+				if(controlByte & ssd1306DATA_FOLLOWS_BYTE)
+					stats.numDataBytes += numPayloadBytes;
+				else
+					stats.numCommandBytes += numPayloadBytes;
+				EndStatsUpdate();
 			}
-		}
+
+			template<uint8 numCols, uint8 numRows, class Transport>
+			void Ssd1306<numCols, numRows, Transport>::CountFlush()
+			{
+				uint32 flushTimeUs;
+				uint32 bucketLimitUs;
+				uint8 bucket;
+
+				flushTimeUs = Port::GetTimeUs() - flushStartTimeUs;
+
+				// Last bucket takes everything that doesn't fit in the others
+				bucketLimitUs = ssd1306STATS_FIRST_BUCKET_US;
+				for(bucket = 0; bucket < ssd1306STATS_NUM_FLUSH_BUCKETS - 1; bucket++)
+				{
+					if(flushTimeUs < bucketLimitUs)
+						break;
+					bucketLimitUs *= 2;
+				}
+
+				BeginStatsUpdate();
+				stats.numFlushes++;
+				stats.totalFlushTimeUs += flushTimeUs;
+				if(flushTimeUs > stats.maxFlushTimeUs)
+					stats.maxFlushTimeUs = flushTimeUs;
+				stats.flushTimeHistogram[bucket]++;
+				EndStatsUpdate();
+			}
+		#endif
 
 
 
@@ -1029,32 +1235,42 @@ namespace MbeddedNinja
 
 		//! @brief		Sets the start column
 		//! @private
-		void Ssd1306::SetStartColumn(unsigned char d)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetStartColumn(unsigned char d)
 		{
+			BeginCommandBatch();
 			// Set Lower Column Start Address for Page Addressing Mode (modulo 16)
 			//   Default => 0x00
 			WriteCommand(0x00+d%16);
 			// Set Higher Column Start Address for Page Addressing Mode (dividsor 16)
 			//   Default => 0x10
 			WriteCommand(0x10+d/16);
+			EndCommandBatch();
 		}
 
-		void Ssd1306::SetColumnAddress(unsigned char a, unsigned char b)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetColumnAddress(unsigned char a, unsigned char b)
 		{
+			BeginCommandBatch();
 			WriteCommand(0x21);			// Set Column Address
 			WriteCommand(a);			//   Default => 0x00 (Column Start Address)
 			WriteCommand(b);			//   Default => 0x7F (Column End Address)
+			EndCommandBatch();
 		}
 
 
-		void Ssd1306::SetPageAddress(unsigned char a, unsigned char b)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetPageAddress(unsigned char a, unsigned char b)
 		{
+			BeginCommandBatch();
 			WriteCommand(0x22);			// Set Page Address
 			WriteCommand(a);			//   Default => 0x00 (Page Start Address)
 			WriteCommand(b);			//   Default => 0x07 (Page End Address)
+			EndCommandBatch();
 		}
 
-		void Ssd1306::SetMultiplexRatio(uint8 regVal)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetMultiplexRatio(uint8 regVal)
 		{
 			uint8 commandArray[2];
 
@@ -1070,177 +1286,265 @@ namespace MbeddedNinja
 			WriteCommandArray(commandArray, 2);
 		}
 
-		void Ssd1306::SetStartPage(unsigned char d)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetStartPage(unsigned char d)
 		{
 			// Set Page Start Address for Page Addressing Mode
 			//   Default => 0xB0 (0x00)
 			WriteCommand(0xB0|d);
 		}
 
-		void Ssd1306::SetNOP()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::SetNOP()
 		{
 			WriteCommand(0xE3);			// Command for No Operation
 		}
 	
-		void Ssd1306::FillBlock(
-			unsigned char byteToFillRamWith,
-			unsigned char startPage,
-			unsigned char endPage,
-			unsigned char startCol,
-			unsigned char numCols)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::FlushPages()
 		{
-			unsigned char i,j;
+			uint8 page, startCol, endCol;
 
-			// Can be partial or full screen
-			for(i = startPage; i < (endPage + 1); i++)
+			// Cursor setup for each page is coalesced into one command transaction,
+			// which gets committed by the data write
+			BeginCommandBatch();
+
+			// Start page/column commands only work in page addressing mode
+			if(addressingMode != PAGE_ADDRESSING_MODE)
+				EnterPageAddressingMode();
+
+			for(page = 0; page < NUM_PAGES; page++)
 			{
-				SetStartPage(i);
-				SetStartColumn(startCol);
+				// Skip pages which haven't changed
+				if(!frameBuffer.GetDirtyRange(page, &startCol, &endCol))
+					continue;
 
-				port.I2cMasterSendStart(SSD1306_I2C_ADD, 0);
-				port.I2cMasterWriteByte(ssd1306DATA_FOLLOWS_BYTE);
+				SetStartPage(page);
+				SetStartColumn(startCol + COL_OFFSET);
 
-				for(j = 0; j < numCols; j++)
-				{
-					port.I2cMasterWriteByte(byteToFillRamWith);
-				}
+				// Send the dirty part of the page in one transaction
+				WriteDataArray(frameBuffer.GetPage(page) + startCol, endCol - startCol + 1);
+			}
+
+			EndCommandBatch();
+		}
 
-				port.I2cMasterSendStop();
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::FlushWindow()
+		{
+			Port::ioVector_t vectors[NUM_PAGES];
+			uint8 page, pageStartCol, pageEndCol;
+			uint8 startPage = 0xFF;
+			uint8 endPage = 0;
+			uint8 startCol = 0xFF;
+			uint8 endCol = 0;
+			uint8 numVectors = 0;
+
+			// Find the smallest window that covers every dirty page range
+			for(page = 0; page < NUM_PAGES; page++)
+			{
+				if(!frameBuffer.GetDirtyRange(page, &pageStartCol, &pageEndCol))
+					continue;
+
+				if(startPage == 0xFF)
+					startPage = page;
+				endPage = page;
+
+				if(pageStartCol < startCol)
+					startCol = pageStartCol;
+				if(pageEndCol > endCol)
+					endCol = pageEndCol;
 			}
+
+			// Addressing mode and window are coalesced into one command transaction
+			BeginCommandBatch();
+
+			// Column/page windows only work in horizontal (or vertical) addressing mode
+			if(addressingMode != HORIZONTAL_ADDRESSING_MODE)
+				SetAddressingMode(HORIZONTAL_ADDRESSING_MODE);
+
+			SetColumnAddress(startCol + COL_OFFSET, endCol + COL_OFFSET);
+			SetPageAddress(startPage, endPage);
+
+			// In horizontal addressing mode the SSD1306 wraps to the next page at the end
+			// of the window, so the rows of the window can be streamed back-to-back
+			for(page = startPage; page <= endPage; page++)
+			{
+				vectors[numVectors].data = frameBuffer.GetPage(page) + startCol;
+				vectors[numVectors].numBytes = endCol - startCol + 1;
+				numVectors++;
+			}
+
+			WriteDataVectored(vectors, numVectors);
+
+			EndCommandBatch();
 		}
 
-		void Ssd1306::Checkerboard()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::EnterPageAddressingMode()
 		{
-			unsigned char i,j;
+			BeginCommandBatch();
+			SetAddressingMode(PAGE_ADDRESSING_MODE);
+			// Page addressing mode wraps at the end of the column window, which FlushWindow() may
+			// have narrowed
+			SetColumnAddress(0, 127);
+			EndCommandBatch();
+		}
 
-			// Checkerboard is full-screen
-			for(i = 0; i < 8; i++)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::FlushPlanned()
+		{
+			Port::ioVector_t vectors[NUM_PAGES];
+			const transferWindow_t *transfers;
+			uint32 numBusBytesAtStart;
+			uint8 numTransfers, transferIndex, page, numVectors;
+
+			numTransfers = planner->Plan(frameBuffer, addressingMode == HORIZONTAL_ADDRESSING_MODE);
+			transfers = planner->GetTransfers();
+			numBusBytesAtStart = numBusBytesWritten;
+
+			// Cursor setup for each transfer is coalesced into one command transaction,
+			// which gets committed by the data write
+			BeginCommandBatch();
+
+			if(numTransfers != 0)
+			{
+				if(planner->IsWindowPlan() && (addressingMode != HORIZONTAL_ADDRESSING_MODE))
+					SetAddressingMode(HORIZONTAL_ADDRESSING_MODE);
+				else if(!planner->IsWindowPlan() && (addressingMode != PAGE_ADDRESSING_MODE))
+					EnterPageAddressingMode();
+			}
+
+			for(transferIndex = 0; transferIndex < numTransfers; transferIndex++)
 			{
-				SetStartPage(i);
-				SetStartColumn(0x00);
+				const transferWindow_t &transfer = transfers[transferIndex];
 
-				port.I2cMasterSendStart(SSD1306_I2C_ADD, 0);
-				port.I2cMasterWriteByte(ssd1306DATA_FOLLOWS_BYTE);
+				if(!planner->IsWindowPlan())
+				{
+					SetStartPage(transfer.startPage);
+					SetStartColumn(transfer.startCol + COL_OFFSET);
+					WriteDataArray(frameBuffer.GetPage(transfer.startPage) + transfer.startCol, transfer.endCol - transfer.startCol + 1);
+					continue;
+				}
+
+				SetColumnAddress(transfer.startCol + COL_OFFSET, transfer.endCol + COL_OFFSET);
+				SetPageAddress(transfer.startPage, transfer.endPage);
 
-				for(j = 0; j < 64; j++)
+				numVectors = 0;
+				for(page = transfer.startPage; page <= transfer.endPage; page++)
 				{
-					port.I2cMasterWriteByte(0x55);
-					port.I2cMasterWriteByte(0xAA);
+					vectors[numVectors].data = frameBuffer.GetPage(page) + transfer.startCol;
+					vectors[numVectors].numBytes = transfer.endCol - transfer.startCol + 1;
+					numVectors++;
 				}
 
-				port.I2cMasterSendStop();
+				WriteDataVectored(vectors, numVectors);
 			}
+
+			EndCommandBatch();
+
+			planner->Commit(frameBuffer, numBusBytesWritten - numBusBytesAtStart);
 		}
 
-		void Ssd1306::DrawFrame()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::CaptureFlush()
 		{
-			unsigned char i,j;
+			// Run the normal flush, but collect the transactions in flushBuffer rather
+			// than sending them. This copies the dirty regions, so frameBuffer can be drawn
+			// into as soon as this returns.
+			flushBufferLength = 0;
+			numFlushTransactions = 0;
+			isCapturingFlush = true;
 
-			// Draw 1-pixel wide top border
-			
-			// Full-screen
-			SetStartPage(0x00);
-			//SetStartColumn(XLevel);
-			SetStartColumn(0x00);
+			FlushDirty();
+
+			isCapturingFlush = false;
 
-			port.I2cMasterSendStart(SSD1306_I2C_ADD, 0);
-			port.I2cMasterWriteByte(ssd1306DATA_FOLLOWS_BYTE);
+			frameBuffer.ClearDirty();
+		}
 
-			for(i = 0; i < ssd1306NUM_COLS; i++)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::FlushDirty()
+		{
+			if((flushMode == FLUSH_MODE_PLANNED) && (planner != NULL))
 			{
-				port.I2cMasterWriteByte(0x01);
+				FlushPlanned();
+				return;
 			}
 
-			port.I2cMasterSendStop();
-
-			// Draw 1-pixel wide bottom border
+			if(flushMode == FLUSH_MODE_WINDOW)
+				FlushWindow();
+			else
+				FlushPages();
 
-			SetStartPage(0x03);
-			SetStartColumn(0x00);
-			//SetStartColumn(XLevel);
+			// Planner has to know what was sent, in case the flush mode is changed back
+			if(planner != NULL)
+				planner->Sync(frameBuffer);
+		}
 
-			port.I2cMasterSendStart(SSD1306_I2C_ADD, 0);
-			port.I2cMasterWriteByte(ssd1306DATA_FOLLOWS_BYTE);
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::FillBlock(
+			unsigned char byteToFillRamWith,
+			unsigned char startPage,
+			unsigned char endPage,
+			unsigned char startCol,
+			unsigned char totalCol)
+		{
+			unsigned char i;
 
-			for(i = 0; i< ssd1306NUM_COLS; i++)
+			// Can be partial or full screen
+			for(i = startPage; (i < (endPage + 1)) && (i < NUM_PAGES); i++)
 			{
-				port.I2cMasterWriteByte(0x80);
+				frameBuffer.FillBytes(i, startCol, byteToFillRamWith, totalCol);
 			}
+		}
 
-			port.I2cMasterSendStop();
-
-			// Draw 1-pixel wide left and right borders
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::Checkerboard()
+		{
+			unsigned char i,j;
 
-			for(i = 0; i < 4; i++)
+			// Checkerboard is full-screen
+			for(i = 0; i < NUM_PAGES; i++)
 			{
-				SetStartPage(i);
-
-				for(j = 0; j < ssd1306NUM_COLS; j += (ssd1306NUM_COLS-1))
+				for(j = 0; j < NUM_COLS; j += 2)
 				{
-					SetStartColumn(j);
-					WriteData(0xFF);
+					frameBuffer.WriteByte(i, j, 0x55);
+					frameBuffer.WriteByte(i, j + 1, 0xAA);
 				}
 			}
 		}
+
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::DrawFrame()
+		{
+			frameBuffer.DrawRect(0, 0, NUM_ROWS, NUM_COLS);
+		}
 	
 		#if(ssd1306ENABLE_FONTS == 1)
-			void Ssd1306::ShowFont57(
+			template<uint8 numCols, uint8 numRows, class Transport>
+			void Ssd1306<numCols, numRows, Transport>::ShowFont57(
 				unsigned char fontArraySel,
 				unsigned char asciiChar,
 				unsigned char startPage,
 				unsigned char startCol)
 			{
+				char msg[2] = { (char)asciiChar, 0 };
 
-				const unsigned char *Src_Pointer;
-				unsigned char i;
-
-				switch(fontArraySel)
-				{
-					case 1:
-						Src_Pointer = &Ascii_1[(asciiChar - 1)][0];
-						break;
-					case 2:
-						Src_Pointer = &Ascii_2[(asciiChar - 1)][0];
-						break;
-				}
-				SetStartPage(startPage);
-				SetStartColumn(startCol);
-
-				port.I2cMasterSendStart(SSD1306_I2C_ADD, 0);
-				port.I2cMasterWriteByte(ssd1306DATA_FOLLOWS_BYTE);
-
-				for(i = 0; i < 5; i++)
-				{
-					port.I2cMasterWriteByte(*Src_Pointer);
-					Src_Pointer++;
-				}
-
-				port.I2cMasterWriteByte(0x00);
-				port.I2cMasterSendStop();
-
+				ShowString(fontArraySel, msg, startPage, startCol);
 			}
 
-			void Ssd1306::ShowString(
+			template<uint8 numCols, uint8 numRows, class Transport>
+			void Ssd1306<numCols, numRows, Transport>::ShowString(
 				uint8_t databaseNum,
-				char *msg,
+				const char *msg,
 				uint8_t startPage,
 				uint8_t startCol)
 			{
-				char *internalPtr;
-
-				internalPtr = msg;
-				ShowFont57(1, 96, startPage, startCol);			// No-Break Space
-									//   Must be written first before the string start...
-
-				while(1)
-				{
-					ShowFont57(databaseNum, *internalPtr, startPage, startCol);
-					internalPtr++;
-					startCol += 6;
-					// Check for terminating null character
-					if(*internalPtr == 0)
-						break;
-				}
+				if(databaseNum == 2)
+					frameBuffer.DrawString(fontSymbols5x7, msg, startPage, startCol);
+				else
+					frameBuffer.DrawString(fontFixed5x7, msg, startPage, startCol);
 			}
 		#endif
 
@@ -1255,7 +1559,8 @@ namespace MbeddedNinja
 		//    d: Set Numbers of Row Scroll per Step
 		//    e: Set Time Interval between Each Scroll Step
 		//-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-		void Ssd1306::VerticalScroll(
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::VerticalScroll(
 			unsigned char a,
 			unsigned char b,
 			unsigned char c,
@@ -1264,9 +1569,11 @@ namespace MbeddedNinja
 		{
 			unsigned int i,j;
 
+			BeginCommandBatch();
 			WriteCommand(0xA3);			// Set Vertical Scroll Area
 			WriteCommand(b);			//   Default => 0x00 (Top Fixed Area)
 			WriteCommand(c);			//   Default => 0x40 (Vertical Scroll Area)
+			EndCommandBatch();
 
 			switch(a)
 			{
@@ -1294,13 +1601,16 @@ namespace MbeddedNinja
 			SetStartLine(0x00);
 		}
 
-		void Ssd1306::HorizontalScroll(
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::HorizontalScroll(
 			unsigned char scrollDir,
 			unsigned char startPage,
 			unsigned char endPage,
 			unsigned char timeInterval,
 			unsigned char delayTime)
 		{
+			BeginCommandBatch();
+
 			// Setup horizontal scroll.
 			WriteCommand(0x26|scrollDir);
 
@@ -1310,8 +1620,15 @@ namespace MbeddedNinja
 			WriteCommand(timeInterval);
 			WriteCommand(endPage);
 
+			// Dummy bytes for last two parameters (datasheet requires 0x00, 0xFF)
+			WriteCommand(0x00);
+			WriteCommand(0xFF);
+
 			// Activate Scrolling
 			WriteCommand(0x2F);
+
+			// Send setup and activation as one transaction before delaying
+			EndCommandBatch();
 			port.DelayMs(delayTime);
 		}
 
@@ -1330,7 +1647,8 @@ namespace MbeddedNinja
 		//    h: Delay Time
 		//    * d+e must be less than or equal to the Multiplex Ratio...
 		//-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-		void Ssd1306::ContinuousScroll(
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::ContinuousScroll(
 			unsigned char a,
 			unsigned char b,
 			unsigned char c,
@@ -1340,6 +1658,8 @@ namespace MbeddedNinja
 			unsigned char g,
 			unsigned char h)
 		{
+			BeginCommandBatch();
+
 			WriteCommand(0xA3);			// Set Vertical Scroll Area
 			WriteCommand(d);			//   Default => 0x00 (Top Fixed Area)
 			WriteCommand(e);			//   Default => 0x40 (Vertical Scroll Area)
@@ -1351,16 +1671,21 @@ namespace MbeddedNinja
 			WriteCommand(c);
 			WriteCommand(f);
 			WriteCommand(0x2F);			// Activate Scrolling
+
+			// Send setup and activation as one transaction before delaying
+			EndCommandBatch();
 			port.DelayMs(h);
 		}
 
-		void Ssd1306::DeactivateScroll()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::DeactivateScroll()
 		{
 			// Deactivate Scrolling
 			WriteCommand(0x2E);
 		}
 
-		void Ssd1306::FadeIn()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::FadeIn()
 		{
 			unsigned int i;
 
@@ -1374,7 +1699,8 @@ namespace MbeddedNinja
 			}
 		}
 
-		void Ssd1306::FadeOut()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::FadeOut()
 		{
 			unsigned int i;
 
@@ -1394,7 +1720,8 @@ namespace MbeddedNinja
 		//    "0x00" Enter Sleep Mode
 		//    "0x01" Exit Sleep Mode
 		//-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-		void Ssd1306::Sleep(unsigned char a)
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::Sleep(unsigned char a)
 		{
 			switch(a)
 			{
@@ -1409,7 +1736,8 @@ namespace MbeddedNinja
 			}
 		}
 
-		void Ssd1306::Test()
+		template<uint8 numCols, uint8 numRows, class Transport>
+		void Ssd1306<numCols, numRows, Transport>::Test()
 		{
 			unsigned char i;
 
@@ -1443,6 +1771,14 @@ namespace MbeddedNinja
 
 		// none
 
+		//===============================================================================================//
+		//=================================== EXPLICIT INSTANTIATIONS ===================================//
+		//===============================================================================================//
+
+		#define ssd1306INSTANTIATE_TRANSPORT(numCols, numRows, Transport)		template class Ssd1306<numCols, numRows, Transport>;
+		#define ssd1306INSTANTIATE(numCols, numRows)		ssd1306TRANSPORTS(ssd1306INSTANTIATE_TRANSPORT, numCols, numRows)
+		ssd1306PANEL_SIZES(ssd1306INSTANTIATE)
+
 	} // namespace MSsd1306
 } // namespace MbeddedNinja
 
@@ -0,0 +1,456 @@
+//!
+//! @file 				Ssd1306Emulator.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Software model of the SSD1306, which decodes the I2C command/data stream.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/Ssd1306Emulator.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//========================================== DEFINES ============================================//
+		//===============================================================================================//
+
+		//! @brief		Continuation bit of the control byte. If set, only one byte follows before the next control byte.
+		#define ssd1306EmuCONTROL_CO_BIT		(0x80)
+
+		//! @brief		Data/command bit of the control byte. If set, data follows, otherwise commands.
+		#define ssd1306EmuCONTROL_DC_BIT		(0x40)
+
+		//===============================================================================================//
+		//===================================== GLOBAL FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		// See Doxygen documentation or function declarations in Ssd1306Emulator.hpp for more info.
+
+		Ssd1306Emulator::Ssd1306Emulator(uint8 i2cAddress)
+		{
+			uint8 page, col;
+
+			this->i2cAddress = i2cAddress;
+
+			// Real RAM powers up with random contents, zero is easier to test against
+			for(page = 0; page < ssd1306EmuRAM_PAGES; page++)
+			{
+				for(col = 0; col < ssd1306EmuRAM_COLS; col++)
+				{
+					gddram[page][col] = 0x00;
+				}
+			}
+
+			Reset();
+			ClearStats();
+		}
+
+		void Ssd1306Emulator::Reset()
+		{
+			uint8 i;
+
+			// Reset values, as per the datasheet
+			addressingMode = 0x02;
+			colStart = 0;
+			colEnd = ssd1306EmuRAM_COLS - 1;
+			pageStart = 0;
+			pageEnd = ssd1306EmuRAM_PAGES - 1;
+			col = 0;
+			page = 0;
+			startLine = 0;
+			displayOffset = 0;
+			multiplexRatio = 63;
+			contrast = 0x7F;
+			clockDivide = 0x80;
+			prechargePeriod = 0x22;
+			vcomhLevel = 0x20;
+			comPinConfig = 0x12;
+			chargePump = 0x10;
+			isSegmentRemapped = false;
+			isComScanReversed = false;
+			isInverse = false;
+			isEntireDisplayOn = false;
+			isDisplayOn = false;
+			isScrollActive = false;
+			scrollCommand = 0;
+			for(i = 0; i < ssd1306EmuMAX_CMD_PARAMS; i++)
+				scrollParams[i] = 0;
+			verticalScrollTopFixed = 0;
+			verticalScrollRows = 64;
+
+			parseState = STATE_CONTROL_BYTE;
+			isData = false;
+			isCmdPending = false;
+			numCmdParams = 0;
+			numCmdParamsExpected = 0;
+			cmdOpcode = 0;
+		}
+
+		uint8 Ssd1306Emulator::GetI2cAddress() const
+		{
+			return i2cAddress;
+		}
+
+		void Ssd1306Emulator::Start()
+		{
+			stats.numTransactions++;
+
+			// Address byte
+			stats.numBusBytes++;
+
+			// First byte of every transaction is a control byte. Partly received commands
+			// carry on into the next transaction, the driver relies on this.
+			parseState = STATE_CONTROL_BYTE;
+		}
+
+		void Ssd1306Emulator::WriteByte(uint8 byte)
+		{
+			stats.numBusBytes++;
+
+			switch(parseState)
+			{
+				case STATE_CONTROL_BYTE:
+					stats.numControlBytes++;
+					isData = ((byte & ssd1306EmuCONTROL_DC_BIT) != 0);
+					if(byte & ssd1306EmuCONTROL_CO_BIT)
+						parseState = STATE_SINGLE_BYTE;
+					else
+						parseState = STATE_STREAM;
+					break;
+				case STATE_SINGLE_BYTE:
+				case STATE_STREAM:
+					if(isData)
+					{
+						stats.numDataBytes++;
+						ProcessDataByte(byte);
+					}
+					else
+					{
+						stats.numCommandBytes++;
+						ProcessCommandByte(byte);
+					}
+
+					// Co = 1 means another control byte comes next
+					if(parseState == STATE_SINGLE_BYTE)
+						parseState = STATE_CONTROL_BYTE;
+					break;
+			}
+		}
+
+		void Ssd1306Emulator::WriteBytes(const uint8 *bytes, uint16 numBytes)
+		{
+			uint16 i;
+
+			for(i = 0; i < numBytes; i++)
+			{
+				WriteByte(bytes[i]);
+			}
+		}
+
+		void Ssd1306Emulator::Stop()
+		{
+			parseState = STATE_CONTROL_BYTE;
+		}
+
+		void Ssd1306Emulator::Select()
+		{
+			stats.numTransactions++;
+		}
+
+		void Ssd1306Emulator::SetDcPin(bool isData)
+		{
+			this->isData = isData;
+		}
+
+		void Ssd1306Emulator::WriteSpiByte(uint8 byte)
+		{
+			stats.numBusBytes++;
+
+			if(isData)
+			{
+				stats.numDataBytes++;
+				ProcessDataByte(byte);
+			}
+			else
+			{
+				stats.numCommandBytes++;
+				ProcessCommandByte(byte);
+			}
+		}
+
+		uint8 Ssd1306Emulator::GetRamByte(uint8 page, uint8 col) const
+		{
+			if((page >= ssd1306EmuRAM_PAGES) || (col >= ssd1306EmuRAM_COLS))
+				return 0x00;
+
+			return gddram[page][col];
+		}
+
+		bool Ssd1306Emulator::GetPixel(uint8 seg, uint8 com) const
+		{
+			uint8 displayRow, ramRow, ramCol;
+			bool isOn;
+
+			if(!isDisplayOn || (seg >= ssd1306EmuRAM_COLS) || (com > multiplexRatio))
+				return false;
+
+			if(isEntireDisplayOn)
+				return true;
+
+			// COM scan direction decides which display row goes out on this COM
+			if(isComScanReversed)
+				displayRow = multiplexRatio - com;
+			else
+				displayRow = com;
+
+			ramRow = (displayRow + displayOffset + startLine) & 0x3F;
+
+			// Segment remap decides which column goes out on this SEG
+			if(isSegmentRemapped)
+				ramCol = (ssd1306EmuRAM_COLS - 1) - seg;
+			else
+				ramCol = seg;
+
+			isOn = ((gddram[ramRow >> 3][ramCol] >> (ramRow & 0x07)) & 0x01) != 0;
+
+			return isOn != isInverse;
+		}
+
+		const Ssd1306Emulator::stats_t& Ssd1306Emulator::GetStats() const
+		{
+			return stats;
+		}
+
+		void Ssd1306Emulator::ClearStats()
+		{
+			stats.numTransactions = 0;
+			stats.numBusBytes = 0;
+			stats.numControlBytes = 0;
+			stats.numCommandBytes = 0;
+			stats.numDataBytes = 0;
+			stats.numUnknownCommands = 0;
+		}
+
+		//===============================================================================================//
+		//====================================== PRIVATE FUNCTIONS ======================================//
+		//===============================================================================================//
+
+		void Ssd1306Emulator::ProcessCommandByte(uint8 byte)
+		{
+			if(isCmdPending)
+			{
+				cmdParams[numCmdParams++] = byte;
+				if(numCmdParams == numCmdParamsExpected)
+				{
+					isCmdPending = false;
+					ExecuteCommand();
+				}
+				return;
+			}
+
+			cmdOpcode = byte;
+			numCmdParams = 0;
+			numCmdParamsExpected = GetNumParams(byte);
+
+			if(numCmdParamsExpected == 0)
+				ExecuteCommand();
+			else
+				isCmdPending = true;
+		}
+
+		uint8 Ssd1306Emulator::GetNumParams(uint8 opcode)
+		{
+			switch(opcode)
+			{
+				case 0x20:		// Memory addressing mode
+				case 0x81:		// Contrast
+				case 0x8D:		// Charge pump
+				case 0xA8:		// Multiplex ratio
+				case 0xD3:		// Display offset
+				case 0xD5:		// Clock divide ratio/oscillator frequency
+				case 0xD9:		// Pre-charge period
+				case 0xDA:		// COM pins hardware configuration
+				case 0xDB:		// VCOMH deselect level
+					return 1;
+				case 0x21:		// Column address
+				case 0x22:		// Page address
+				case 0xA3:		// Vertical scroll area
+					return 2;
+				case 0x29:		// Continuous vertical and horizontal scroll setup
+				case 0x2A:
+					return 5;
+				case 0x26:		// Continuous horizontal scroll setup
+				case 0x27:
+					return 6;
+				default:
+					return 0;
+			}
+		}
+
+		void Ssd1306Emulator::ExecuteCommand()
+		{
+			uint8 i;
+
+			// Single byte commands with the value in the opcode
+			if(cmdOpcode <= 0x0F)
+			{
+				// Lower nibble of column start address (page addressing mode)
+				col = (col & 0xF0) | (cmdOpcode & 0x0F);
+				return;
+			}
+			else if(cmdOpcode <= 0x1F)
+			{
+				// Upper nibble of column start address (page addressing mode)
+				col = (col & 0x0F) | ((cmdOpcode & 0x07) << 4);
+				return;
+			}
+			else if((cmdOpcode >= 0x40) && (cmdOpcode <= 0x7F))
+			{
+				startLine = cmdOpcode & 0x3F;
+				return;
+			}
+			else if((cmdOpcode >= 0xB0) && (cmdOpcode <= 0xB7))
+			{
+				// Page start address (page addressing mode)
+				page = cmdOpcode & 0x07;
+				return;
+			}
+			else if((cmdOpcode >= 0xC0) && (cmdOpcode <= 0xCF))
+			{
+				isComScanReversed = ((cmdOpcode & 0x08) != 0);
+				return;
+			}
+
+			switch(cmdOpcode)
+			{
+				case 0x20:
+					addressingMode = cmdParams[0] & 0x03;
+					break;
+				case 0x21:
+					colStart = cmdParams[0] & 0x7F;
+					colEnd = cmdParams[1] & 0x7F;
+					col = colStart;
+					break;
+				case 0x22:
+					pageStart = cmdParams[0] & 0x07;
+					pageEnd = cmdParams[1] & 0x07;
+					page = pageStart;
+					break;
+				case 0x26:
+				case 0x27:
+				case 0x29:
+				case 0x2A:
+					scrollCommand = cmdOpcode;
+					for(i = 0; i < numCmdParams; i++)
+						scrollParams[i] = cmdParams[i];
+					break;
+				case 0x2E:
+					isScrollActive = false;
+					break;
+				case 0x2F:
+					isScrollActive = true;
+					break;
+				case 0x81:
+					contrast = cmdParams[0];
+					break;
+				case 0x8D:
+					chargePump = cmdParams[0];
+					break;
+				case 0xA0:
+				case 0xA1:
+					isSegmentRemapped = (cmdOpcode == 0xA1);
+					break;
+				case 0xA3:
+					verticalScrollTopFixed = cmdParams[0] & 0x3F;
+					verticalScrollRows = cmdParams[1] & 0x7F;
+					break;
+				case 0xA4:
+				case 0xA5:
+					isEntireDisplayOn = (cmdOpcode == 0xA5);
+					break;
+				case 0xA6:
+				case 0xA7:
+					isInverse = (cmdOpcode == 0xA7);
+					break;
+				case 0xA8:
+					multiplexRatio = cmdParams[0] & 0x3F;
+					break;
+				case 0xAE:
+				case 0xAF:
+					isDisplayOn = (cmdOpcode == 0xAF);
+					break;
+				case 0xD3:
+					displayOffset = cmdParams[0] & 0x3F;
+					break;
+				case 0xD5:
+					clockDivide = cmdParams[0];
+					break;
+				case 0xD9:
+					prechargePeriod = cmdParams[0];
+					break;
+				case 0xDA:
+					comPinConfig = cmdParams[0];
+					break;
+				case 0xDB:
+					vcomhLevel = cmdParams[0];
+					break;
+				case 0xE3:
+					// NOP
+					break;
+				default:
+					stats.numUnknownCommands++;
+					break;
+			}
+		}
+
+		void Ssd1306Emulator::ProcessDataByte(uint8 byte)
+		{
+			gddram[page & 0x07][col & 0x7F] = byte;
+
+			switch(addressingMode)
+			{
+				case 0x00:
+					// Horizontal, across the window then down to the next page
+					if(col >= colEnd)
+					{
+						col = colStart;
+						page = (page >= pageEnd) ? pageStart : page + 1;
+					}
+					else
+						col++;
+					break;
+				case 0x01:
+					// Vertical, down the window then across to the next column
+					if(page >= pageEnd)
+					{
+						page = pageStart;
+						col = (col >= colEnd) ? colStart : col + 1;
+					}
+					else
+						page++;
+					break;
+				default:
+					// Page, across the page only, page pointer doesn't change
+					if(col >= colEnd)
+						col = colStart;
+					else
+						col++;
+					break;
+			}
+		}
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+// EOF
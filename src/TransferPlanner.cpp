@@ -0,0 +1,416 @@
+//!
+//! @file 				TransferPlanner.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Works out the cheapest set of transfers to bring the SSD1306 RAM up to date.
+//! @details
+//!						See the README in the repo root dir for more info.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// System includes
+#include <string.h>		// memcpy()
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/FrameBuffer.hpp"
+#include "../include/TransferPlanner.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MSsd1306
+	{
+
+		//===============================================================================================//
+		//========================================== DEFINES ============================================//
+		//===============================================================================================//
+
+		//! @brief		Value of segmentEndPage (in Plan()) for a page that is sent as one window per run.
+		#define transferPlannerRUNS_SEGMENT		(0xFF)
+
+		//===============================================================================================//
+		//===================================== GLOBAL FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		// See Doxygen documentation or function declarations in TransferPlanner.hpp for more info.
+
+		template<uint8 numCols, uint8 numRows>
+		TransferPlanner<numCols, numRows>::TransferPlanner()
+		{
+			isShadowValid = false;
+			frameInvalidateCount = 0;
+
+			costModel.commandOverhead = portTRANSACTION_OVERHEAD;
+			costModel.dataOverhead = portTRANSACTION_OVERHEAD;
+
+			numTransfers = 0;
+			isWindowPlan = false;
+			expectedBytes = 0;
+			baselineBytes = 0;
+
+			ClearStats();
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void TransferPlanner<numCols, numRows>::SetCostModel(const transferCostModel_t &costModel)
+		{
+			this->costModel = costModel;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		const transferCostModel_t& TransferPlanner<numCols, numRows>::GetCostModel() const
+		{
+			return costModel;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		uint8 TransferPlanner<numCols, numRows>::Plan(const FrameBuffer<numCols, numRows> &frame, bool isWindowModeNow)
+		{
+			uint32 segmentCost[NUM_PAGES + 1];
+			uint8 segmentEndPage[NUM_PAGES + 1];
+			uint16 runsCost[NUM_PAGES];
+			uint8 extentStartCol[NUM_PAGES];
+			uint8 extentEndCol[NUM_PAGES];
+			transferWindow_t runs[MAX_TRANSFERS];
+			uint32 pageCost, windowCost, cost;
+			uint16 pageGap, windowGap, numBytes, pageNumBytes;
+			uint8 page, endPage, startCol, endCol, numRuns, pageNumRuns, i;
+			uint8 pageCursorCost, windowCursorCost;
+			bool isAnyDirty = false;
+
+			// Everything dirty has to be sent if the SSD1306 RAM was reset since the last sync
+			if(frame.GetInvalidateCount() != frameInvalidateCount)
+				isShadowValid = false;
+
+			pageCursorCost = costModel.commandOverhead + PAGE_CURSOR_BYTES + costModel.dataOverhead;
+			windowCursorCost = costModel.commandOverhead + WINDOW_CURSOR_BYTES + costModel.dataOverhead;
+
+			// What FLUSH_MODE_PAGE would have sent, for the stats
+			baselineBytes = 0;
+			for(page = 0; page < NUM_PAGES; page++)
+			{
+				if(!frame.GetDirtyRange(page, &startCol, &endCol))
+					continue;
+
+				baselineBytes += 2*TRANSACTION_BYTES + PAGE_CURSOR_BYTES + (endCol - startCol + 1);
+				isAnyDirty = true;
+			}
+			if(isAnyDirty && isWindowModeNow)
+				baselineBytes += PAGE_MODE_SWITCH_BYTES;
+
+			//========== PAGE ADDRESSING MODE PLAN ==========//
+
+			// Built straight into transfers, and replaced below if the window plan is cheaper
+			pageGap = FindMaxGap(frame, PAGE_CURSOR_BYTES);
+			pageNumBytes = 0;
+			pageNumRuns = 0;
+			for(page = 0; page < NUM_PAGES; page++)
+			{
+				pageNumRuns += FindRuns(frame, page, pageGap, &transfers[pageNumRuns], &pageNumBytes);
+			}
+
+			pageCost = (uint32)pageNumRuns*pageCursorCost + pageNumBytes;
+			if((pageNumRuns != 0) && isWindowModeNow)
+				pageCost += PAGE_MODE_SWITCH_BYTES;
+
+			//========== HORIZONTAL ADDRESSING MODE PLAN ==========//
+
+			// Each page is either sent as one single-page window per run, or is part of a
+			// window covering it and the pages after it
+			windowGap = FindMaxGap(frame, WINDOW_CURSOR_BYTES);
+			for(page = 0; page < NUM_PAGES; page++)
+			{
+				numBytes = 0;
+				numRuns = FindRuns(frame, page, windowGap, runs, &numBytes);
+				runsCost[page] = numRuns*windowCursorCost + numBytes;
+				if(numRuns != 0)
+				{
+					extentStartCol[page] = runs[0].startCol;
+					extentEndCol[page] = runs[numRuns - 1].endCol;
+				}
+				else
+				{
+					// Nothing to send
+					extentStartCol[page] = 0xFF;
+					extentEndCol[page] = 0;
+				}
+			}
+
+			// segmentCost[page] is the cheapest way of sending everything from page onwards
+			segmentCost[NUM_PAGES] = 0;
+			for(page = NUM_PAGES; page-- > 0;)
+			{
+				segmentCost[page] = runsCost[page] + segmentCost[page + 1];
+				segmentEndPage[page] = transferPlannerRUNS_SEGMENT;
+
+				// Nothing changed on this page, no point starting a window here
+				if(extentStartCol[page] > extentEndCol[page])
+					continue;
+
+				startCol = extentStartCol[page];
+				endCol = extentEndCol[page];
+				for(endPage = page; endPage < NUM_PAGES; endPage++)
+				{
+					if(extentStartCol[endPage] < startCol)
+						startCol = extentStartCol[endPage];
+					if((extentStartCol[endPage] <= extentEndCol[endPage]) && (extentEndCol[endPage] > endCol))
+						endCol = extentEndCol[endPage];
+
+					cost = windowCursorCost + (uint32)(endPage - page + 1)*(endCol - startCol + 1) + segmentCost[endPage + 1];
+					if(cost < segmentCost[page])
+					{
+						segmentCost[page] = cost;
+						segmentEndPage[page] = endPage;
+					}
+				}
+			}
+
+			windowCost = segmentCost[0];
+			if((windowCost != 0) && !isWindowModeNow)
+				windowCost += WINDOW_MODE_SWITCH_BYTES;
+
+			//========== PICK THE CHEAPEST ==========//
+
+			// Stay in the current mode if they cost the same
+			isWindowPlan = (windowCost < pageCost) || ((windowCost == pageCost) && isWindowModeNow);
+
+			if(!isWindowPlan)
+			{
+				numTransfers = pageNumRuns;
+				expectedBytes = (uint32)pageNumRuns*(2*TRANSACTION_BYTES + PAGE_CURSOR_BYTES) + pageNumBytes;
+				if((numTransfers != 0) && isWindowModeNow)
+					expectedBytes += PAGE_MODE_SWITCH_BYTES;
+				return numTransfers;
+			}
+
+			numTransfers = 0;
+			expectedBytes = 0;
+			page = 0;
+			while(page < NUM_PAGES)
+			{
+				if(segmentEndPage[page] == transferPlannerRUNS_SEGMENT)
+				{
+					numBytes = 0;
+					numRuns = FindRuns(frame, page, windowGap, &transfers[numTransfers], &numBytes);
+					numTransfers += numRuns;
+					expectedBytes += (uint32)numRuns*(2*TRANSACTION_BYTES + WINDOW_CURSOR_BYTES) + numBytes;
+					page++;
+					continue;
+				}
+
+				endPage = segmentEndPage[page];
+				startCol = 0xFF;
+				endCol = 0;
+				for(i = page; i <= endPage; i++)
+				{
+					if(extentStartCol[i] > extentEndCol[i])
+						continue;
+					if(extentStartCol[i] < startCol)
+						startCol = extentStartCol[i];
+					if(extentEndCol[i] > endCol)
+						endCol = extentEndCol[i];
+				}
+
+				transfers[numTransfers].startPage = page;
+				transfers[numTransfers].endPage = endPage;
+				transfers[numTransfers].startCol = startCol;
+				transfers[numTransfers].endCol = endCol;
+				numTransfers++;
+				expectedBytes += 2*TRANSACTION_BYTES + WINDOW_CURSOR_BYTES + (uint32)(endPage - page + 1)*(endCol - startCol + 1);
+
+				page = endPage + 1;
+			}
+
+			if((numTransfers != 0) && !isWindowModeNow)
+				expectedBytes += WINDOW_MODE_SWITCH_BYTES;
+
+			return numTransfers;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		bool TransferPlanner<numCols, numRows>::IsWindowPlan() const
+		{
+			return isWindowPlan;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		const transferWindow_t* TransferPlanner<numCols, numRows>::GetTransfers() const
+		{
+			return transfers;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		uint32 TransferPlanner<numCols, numRows>::GetExpectedBytes() const
+		{
+			return expectedBytes;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void TransferPlanner<numCols, numRows>::Commit(const FrameBuffer<numCols, numRows> &frame, uint32 numActualBytes)
+		{
+			stats.numFlushes++;
+			stats.numBaselineBytes += baselineBytes;
+			stats.numExpectedBytes += expectedBytes;
+			stats.numActualBytes += numActualBytes;
+
+			Sync(frame);
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void TransferPlanner<numCols, numRows>::Sync(const FrameBuffer<numCols, numRows> &frame)
+		{
+			uint8 page, startCol, endCol;
+
+			for(page = 0; page < NUM_PAGES; page++)
+			{
+				if(!isShadowValid)
+				{
+					// Parts of the frame buffer that aren't dirty already match the SSD1306 RAM
+					memcpy(shadow[page], frame.GetPage(page), NUM_COLS);
+				}
+				else if(frame.GetDirtyRange(page, &startCol, &endCol))
+				{
+					memcpy(&shadow[page][startCol], frame.GetPage(page) + startCol, endCol - startCol + 1);
+				}
+			}
+
+			isShadowValid = true;
+			frameInvalidateCount = frame.GetInvalidateCount();
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void TransferPlanner<numCols, numRows>::Invalidate()
+		{
+			isShadowValid = false;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		transferPlannerStats_t TransferPlanner<numCols, numRows>::GetStats() const
+		{
+			return stats;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		void TransferPlanner<numCols, numRows>::ClearStats()
+		{
+			stats.numFlushes = 0;
+			stats.numBaselineBytes = 0;
+			stats.numExpectedBytes = 0;
+			stats.numActualBytes = 0;
+		}
+
+		//===============================================================================================//
+		//====================================== PRIVATE FUNCTIONS ======================================//
+		//===============================================================================================//
+
+		template<uint8 numCols, uint8 numRows>
+		uint8 TransferPlanner<numCols, numRows>::FindRuns(
+			const FrameBuffer<numCols, numRows> &frame,
+			uint8 page,
+			uint16 maxGap,
+			transferWindow_t *runs,
+			uint16 *numBytes) const
+		{
+			uint8 startCol, endCol, col;
+			uint8 runStartCol = 0;
+			uint8 runEndCol = 0;
+			uint8 numRuns = 0;
+			bool isInRun = false;
+
+			if(!frame.GetDirtyRange(page, &startCol, &endCol))
+				return 0;
+
+			for(col = startCol; col <= endCol; col++)
+			{
+				if(!IsChanged(frame, page, col))
+					continue;
+
+				if(isInRun && ((uint16)(col - runEndCol - 1) <= maxGap))
+				{
+					// Cheaper to send the unchanged bytes in between than to start another transfer
+					runEndCol = col;
+				}
+				else
+				{
+					if(isInRun)
+					{
+						if(runs != NULL)
+						{
+							runs[numRuns].startPage = page;
+							runs[numRuns].endPage = page;
+							runs[numRuns].startCol = runStartCol;
+							runs[numRuns].endCol = runEndCol;
+						}
+						*numBytes += runEndCol - runStartCol + 1;
+						numRuns++;
+					}
+
+					runStartCol = col;
+					runEndCol = col;
+					isInRun = true;
+				}
+			}
+
+			if(isInRun)
+			{
+				if(runs != NULL)
+				{
+					runs[numRuns].startPage = page;
+					runs[numRuns].endPage = page;
+					runs[numRuns].startCol = runStartCol;
+					runs[numRuns].endCol = runEndCol;
+				}
+				*numBytes += runEndCol - runStartCol + 1;
+				numRuns++;
+			}
+
+			return numRuns;
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		uint16 TransferPlanner<numCols, numRows>::FindMaxGap(const FrameBuffer<numCols, numRows> &frame, uint8 cursorBytes) const
+		{
+			uint16 maxGap, numBytes, numRuns;
+			uint8 page;
+
+			// Joining two runs costs the bytes in between, splitting them costs another cursor setup
+			maxGap = costModel.commandOverhead + cursorBytes + costModel.dataOverhead;
+
+			// Every page is one run by the time the gap covers the whole page, so this always ends
+			for(;;)
+			{
+				numRuns = 0;
+				numBytes = 0;
+				for(page = 0; page < NUM_PAGES; page++)
+				{
+					numRuns += FindRuns(frame, page, maxGap, NULL, &numBytes);
+				}
+
+				if(numRuns <= MAX_TRANSFERS)
+					return maxGap;
+
+				maxGap = 2*maxGap + 1;
+			}
+		}
+
+		template<uint8 numCols, uint8 numRows>
+		bool TransferPlanner<numCols, numRows>::IsChanged(const FrameBuffer<numCols, numRows> &frame, uint8 page, uint8 col) const
+		{
+			return !isShadowValid || (shadow[page][col] != frame.GetPage(page)[col]);
+		}
+
+		//===============================================================================================//
+		//=================================== EXPLICIT INSTANTIATIONS ===================================//
+		//===============================================================================================//
+
+		#define transferPlannerINSTANTIATE(numCols, numRows)		template class TransferPlanner<numCols, numRows>;
+		ssd1306PANEL_SIZES(transferPlannerINSTANTIATE)
+
+	} // namespace MSsd1306
+} // namespace MbeddedNinja
+
+// EOF
@@ -0,0 +1,384 @@
+#!/usr/bin/env python3
+#
+# @file 				FontCompiler.py
+# @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+# @edited 			n/a
+# @created			2026-10-16
+# @last-modified 		2026-10-16
+# @brief 				Converts a BDF bitmap font into a page-packed font_t header for MSsd1306.
+# @details
+#						Runs on the host, not the MCU. See the README in the repo root dir for more info.
+#
+# Usage:
+#
+#	python3 tools/FontCompiler.py fonts/Ssd1306_5x7.bdf --name Prop5x7 --chars 0x20-0x7E \
+#		--kerning fonts/Prop5x7.kern -o include/fonts/Prop5x7.hpp
+#
+# The glyphs are stored the same way as the SSD1306 GDDRAM: one byte per column, bit 0 at the
+# top, with all the columns of a glyph's first page followed by all the columns of its second
+# page and so on. Fonts taller than 8 pixels take more than one page.
+
+import argparse
+import os
+import sys
+
+MAX_CODE = 255
+
+#===============================================================================================#
+#========================================== BDF PARSER =========================================#
+#===============================================================================================#
+
+class Glyph:
+	def __init__(self):
+		self.codepoint = None
+		self.name = ''
+		self.dwidth = 0
+		self.bbx = (0, 0, 0, 0)
+		self.rows = []
+
+def ParseBdf(path):
+	"""Returns (glyphs, ascent, descent, defaultCodepoint) for the BDF file at path."""
+	glyphs = []
+	ascent = None
+	descent = None
+	defaultCodepoint = None
+	fontBbx = None
+	glyph = None
+	bitmapRowsLeft = 0
+
+	with open(path, 'r', encoding='latin-1') as f:
+		for lineNum, line in enumerate(f, 1):
+			words = line.split()
+			if not words:
+				continue
+
+			if bitmapRowsLeft > 0:
+				# Left-align each row in 32 bits, leftmost pixel is the MSB
+				if len(words[0]) > 8:
+					sys.exit('%s:%d: glyphs wider than 32 pixels are not supported' % (path, lineNum))
+				glyph.rows.append(int(words[0], 16) << (32 - 4 * len(words[0])))
+				bitmapRowsLeft -= 1
+				continue
+
+			key = words[0]
+			if key == 'FONTBOUNDINGBOX':
+				fontBbx = tuple(int(w) for w in words[1:5])
+			elif key == 'FONT_ASCENT':
+				ascent = int(words[1])
+			elif key == 'FONT_DESCENT':
+				descent = int(words[1])
+			elif key == 'DEFAULT_CHAR':
+				defaultCodepoint = int(words[1])
+			elif key == 'STARTCHAR':
+				glyph = Glyph()
+				glyph.name = ' '.join(words[1:])
+			elif key == 'COMMENT' and glyph is not None:
+				glyph.name = ' '.join(words[1:])
+			elif key == 'ENCODING':
+				glyph.codepoint = int(words[1])
+			elif key == 'DWIDTH':
+				glyph.dwidth = int(words[1])
+			elif key == 'BBX':
+				glyph.bbx = tuple(int(w) for w in words[1:5])
+			elif key == 'BITMAP':
+				bitmapRowsLeft = glyph.bbx[1]
+			elif key == 'ENDCHAR':
+				# Unencoded glyphs have an encoding of -1
+				if glyph.codepoint is not None and glyph.codepoint >= 0:
+					glyphs.append(glyph)
+				glyph = None
+
+	if fontBbx is None and (ascent is None or descent is None):
+		sys.exit('%s: no FONTBOUNDINGBOX or FONT_ASCENT/FONT_DESCENT' % path)
+	if ascent is None:
+		ascent = fontBbx[1] + fontBbx[3]
+	if descent is None:
+		descent = -fontBbx[3]
+
+	return glyphs, ascent, descent, defaultCodepoint
+
+def GlyphPixels(glyph, ascent, height):
+	"""Returns the set of (x, row) pixels that are on, with row 0 at the top of the cell."""
+	w, h, xOff, yOff = glyph.bbx
+	pixels = set()
+	for i, rowBits in enumerate(glyph.rows):
+		# Baseline is y = 0, rows above it are positive
+		y = yOff + h - 1 - i
+		row = ascent - 1 - y
+		if row < 0 or row >= height:
+			if rowBits:
+				print('warning: glyph 0x%04X sticks out of the font height, clipped' % glyph.codepoint, file=sys.stderr)
+			continue
+		for j in range(w):
+			if rowBits & (0x80000000 >> j):
+				pixels.add((xOff + j, row))
+	return pixels
+
+#===============================================================================================#
+#======================================== OPTION PARSING =======================================#
+#===============================================================================================#
+
+def ParseChar(text):
+	"""Parses a character given as a literal ('A'), hex (0x41) or Unicode (U+0041) value."""
+	if len(text) == 1:
+		return ord(text)
+	if text.lower().startswith('0x'):
+		return int(text, 16)
+	if text.upper().startswith('U+'):
+		return int(text[2:], 16)
+	return int(text)
+
+def ParseRanges(text):
+	"""Parses a comma separated list of characters and ranges, e.g. '0x20-0x7E,0xB0'."""
+	codepoints = set()
+	for part in text.split(','):
+		if '-' in part[1:]:
+			split = part.index('-', 1)
+			first = ParseChar(part[:split])
+			last = ParseChar(part[split + 1:])
+			codepoints.update(range(first, last + 1))
+		else:
+			codepoints.add(ParseChar(part))
+	return codepoints
+
+def ParseKerning(path):
+	"""Reads '<left> <right> <adjust>' lines, with codepoints in any form ParseChar() takes.
+	Lines starting with '#' are comments (write the '#' character itself as 0x23)."""
+	pairs = []
+	with open(path, 'r', encoding='utf-8') as f:
+		for lineNum, line in enumerate(f, 1):
+			words = line.split()
+			if not words or line.startswith('#'):
+				continue
+			if len(words) != 3:
+				sys.exit('%s:%d: expected "<left> <right> <adjust>"' % (path, lineNum))
+			pairs.append((ParseChar(words[0]), ParseChar(words[1]), int(words[2])))
+	return pairs
+
+#===============================================================================================#
+#========================================== COMPILER ===========================================#
+#===============================================================================================#
+
+def Compile(args):
+	bdfGlyphs, ascent, descent, bdfDefault = ParseBdf(args.bdf)
+	height = ascent + descent
+	numPages = (height + 7) // 8
+
+	if numPages > 8:
+		sys.exit('font is %d pixels high, the SSD1306 only has 64 rows' % height)
+
+	wanted = ParseRanges(args.chars)
+	selected = sorted((g for g in bdfGlyphs if g.codepoint in wanted), key=lambda g: g.codepoint)
+	if not selected:
+		sys.exit('no glyphs in %s match --chars %s' % (args.bdf, args.chars))
+
+	# Codepoint -> code in the compiled font
+	if args.code_base is not None:
+		codes = dict((g.codepoint, args.code_base + i) for i, g in enumerate(selected))
+	else:
+		codes = dict((g.codepoint, g.codepoint) for g in selected)
+	for codepoint, code in codes.items():
+		if code > MAX_CODE:
+			sys.exit('U+%04X would be code %d, fonts are indexed by a uint8 (use --code-base to remap)' % (codepoint, code))
+
+	pixelSets = dict((g.codepoint, GlyphPixels(g, ascent, height)) for g in selected)
+
+	# Fixed fonts keep every glyph in the same cell so that text can be overwritten in place
+	minX = min([0] + [x for pixels in pixelSets.values() for (x, row) in pixels])
+	cellWidth = max([1] + [x - minX + 1 for pixels in pixelSets.values() for (x, row) in pixels])
+	maxDwidth = max(g.dwidth for g in selected)
+
+	bitmaps = []
+	bitmapOffsets = {}
+	glyphs = {}
+	advances = []
+	for g in selected:
+		pixels = pixelSets[g.codepoint]
+		if pixels:
+			if args.fixed:
+				firstX, lastX = minX, minX + cellWidth - 1
+			else:
+				firstX = min(x for (x, row) in pixels)
+				lastX = max(x for (x, row) in pixels)
+			width = lastX - firstX + 1
+		else:
+			firstX, width = 0, 0
+
+		if args.fixed:
+			advance = cellWidth + args.spacing if args.spacing is not None else maxDwidth
+		elif pixels:
+			advance = width + (args.spacing if args.spacing is not None else 1)
+		else:
+			advance = args.space_width if args.space_width is not None else (g.dwidth + 1) // 2
+
+		if width > 255 or advance > 255 or advance == 0:
+			sys.exit('glyph U+%04X has width %d and advance %d, must be 1-255' % (g.codepoint, width, advance))
+
+		data = []
+		for page in range(numPages):
+			for x in range(firstX, firstX + width):
+				byte = 0
+				for bit in range(8):
+					if (x, page * 8 + bit) in pixels:
+						byte |= 1 << bit
+				data.append(byte)
+		data = tuple(data)
+
+		# Identical glyphs (e.g. Latin and Greek capital A) share their bitmap
+		if data not in bitmapOffsets:
+			bitmapOffsets[data] = len(bitmaps)
+			bitmaps.extend(data)
+		glyphs[codes[g.codepoint]] = (bitmapOffsets[data] if data else 0, width, advance, g)
+		advances.append(advance)
+
+	if len(bitmaps) > 0xFFFF:
+		sys.exit('%d bytes of bitmaps, glyph offsets are a uint16' % len(bitmaps))
+
+	firstChar = min(glyphs)
+	lastChar = max(glyphs)
+
+	if args.default_char is not None:
+		defaultChar = codes.get(ParseChar(args.default_char))
+	elif bdfDefault in codes:
+		defaultChar = codes[bdfDefault]
+	else:
+		defaultChar = codes.get(0x20, firstChar)
+	if defaultChar not in glyphs:
+		sys.exit('default character is not in the font')
+
+	kerning = []
+	if args.kerning:
+		for left, right, adjust in ParseKerning(args.kerning):
+			if left not in codes or right not in codes:
+				print('warning: kerning pair U+%04X U+%04X not in font, skipped' % (left, right), file=sys.stderr)
+				continue
+			if adjust < -128 or adjust > 127:
+				sys.exit('kerning adjustment %d out of range' % adjust)
+			kerning.append((codes[left], codes[right], adjust))
+		kerning.sort()
+
+	return {
+		'bitmaps': bitmaps, 'glyphs': glyphs, 'kerning': kerning,
+		'firstChar': firstChar, 'lastChar': lastChar, 'defaultChar': defaultChar,
+		'height': height, 'numPages': numPages, 'advances': advances, 'cellAdvance': maxDwidth,
+	}
+
+#===============================================================================================#
+#========================================= CODE OUTPUT =========================================#
+#===============================================================================================#
+
+def CharComment(code, g):
+	if g.codepoint == code and 0x20 < code < 0x7F and chr(code) not in '\\':
+		return "'%s' %s" % (chr(code), g.name)
+	return 'U+%04X %s' % (g.codepoint, g.name)
+
+def WriteHeader(args, font, out):
+	name = args.name
+	guard = 'M_SSD1306_FONT_%s_H' % name.upper()
+	fileName = os.path.basename(args.output) if args.output else name + '.hpp'
+	bdfName = os.path.relpath(args.bdf).replace(os.sep, '/')
+	command = ' '.join(['tools/FontCompiler.py'] + [a.replace(os.sep, '/') for a in sys.argv[1:] if a != args.output and a != '-o'])
+
+	w = out.write
+	w('//!\n')
+	w('//! @file 				%s\n' % fileName)
+	w('//! @author 			Generated by tools/FontCompiler.py\n')
+	w('//! @edited 			n/a\n')
+	w('//! @created			2026-10-16\n')
+	w('//! @last-modified 		2026-10-16\n')
+	w('//! @brief 				%s font (%d pixels high, %s), compiled from %s.\n' % (
+		name, font['height'], 'fixed width' if args.fixed else 'proportional', bdfName))
+	w('//! @details\n')
+	w('//!						Do not edit, re-run the font compiler instead:\n')
+	w('//!						%s\n' % command)
+	w('\n')
+	w('#ifndef %s\n' % guard)
+	w('#define %s\n' % guard)
+	w('\n')
+	w('#include "../Font.hpp"\n')
+	w('\n')
+	w('namespace MbeddedNinja\n{\n\tnamespace MSsd1306\n\t{\n\n')
+
+	glyphs = font['glyphs']
+	w('\t\t//! @brief		Glyph bitmaps, page-major, bit 0 at the top.\n')
+	w('\t\tconstexpr uint8 font%sBitmaps[] =\n\t\t{\n' % name)
+	written = set()
+	for code in range(font['firstChar'], font['lastChar'] + 1):
+		if code not in glyphs:
+			continue
+		offset, width, advance, g = glyphs[code]
+		if width == 0 or offset in written:
+			continue
+		written.add(offset)
+		data = font['bitmaps'][offset:offset + width * font['numPages']]
+		w('\t\t\t%s,\t\t// %s\n' % (','.join('0x%02X' % b for b in data), CharComment(code, g)))
+	w('\t\t};\n\n')
+
+	w('\t\t//! @brief		One glyph per character from %d to %d: offset, width, advance.\n' % (font['firstChar'], font['lastChar']))
+	w('\t\tconstexpr fontGlyph_t font%sGlyphs[] =\n\t\t{\n' % name)
+	for code in range(font['firstChar'], font['lastChar'] + 1):
+		if code in glyphs:
+			offset, width, advance, g = glyphs[code]
+			w('\t\t\t{%d, %d, %d},\t\t// %d: %s\n' % (offset, width, advance, code, CharComment(code, g)))
+		else:
+			w('\t\t\t{0, 0, 0},\t\t// %d: (none)\n' % code)
+	w('\t\t};\n\n')
+
+	if font['kerning']:
+		w('\t\t//! @brief		Kerning pairs, sorted by left then right character.\n')
+		w('\t\tconstexpr fontKerningPair_t font%sKerningPairs[] =\n\t\t{\n' % name)
+		for left, right, adjust in font['kerning']:
+			w('\t\t\t{%d, %d, %d},\n' % (left, right, adjust))
+		w('\t\t};\n\n')
+		kerningName = 'font%sKerningPairs' % name
+	else:
+		kerningName = 'NULL'
+
+	w('\t\t//! @brief		The %s font.\n' % name)
+	w('\t\tconstexpr font_t font%s =\n\t\t{\n' % name)
+	w('\t\t\tfont%sBitmaps,\n' % name)
+	w('\t\t\tfont%sGlyphs,\n' % name)
+	w('\t\t\t%s,\n' % kerningName)
+	w('\t\t\t%d,\t\t// numKerningPairs\n' % len(font['kerning']))
+	w('\t\t\t%d,\t\t// firstChar\n' % font['firstChar'])
+	w('\t\t\t%d,\t\t// lastChar\n' % font['lastChar'])
+	w('\t\t\t%d,\t\t// defaultChar\n' % font['defaultChar'])
+	w('\t\t\t%d,\t\t// height\n' % font['height'])
+	w('\t\t\t%d\t\t// numPages\n' % font['numPages'])
+	w('\t\t};\n\n')
+
+	w('\t} // namespace MSsd1306\n} // namespace MbeddedNinja\n\n')
+	w('#endif // #ifndef %s\n\n' % guard)
+	w('// EOF\n')
+
+def main():
+	parser = argparse.ArgumentParser(description='Converts a BDF bitmap font into a page-packed font_t header for MSsd1306.')
+	parser.add_argument('bdf', help='BDF font to read')
+	parser.add_argument('--name', required=True, help='font name, used for the C++ identifiers (e.g. Prop5x7 -> fontProp5x7)')
+	parser.add_argument('--chars', default='0x20-0x7E', help='characters to include, e.g. "0x20-0x7E,0xB0" (default ASCII)')
+	parser.add_argument('--fixed', action='store_true', help='keep every glyph in the same cell (default is proportional)')
+	parser.add_argument('--spacing', type=int, help='blank columns after each glyph')
+	parser.add_argument('--space-width', type=int, help='advance of glyphs with no ink in a proportional font')
+	parser.add_argument('--code-base', type=int, help='number the selected glyphs from this code, in codepoint order')
+	parser.add_argument('--default-char', help='character drawn for codes the font does not have')
+	parser.add_argument('--kerning', help='file of "<left> <right> <adjust>" lines')
+	parser.add_argument('-o', '--output', help='header to write (default stdout)')
+	args = parser.parse_args()
+
+	font = Compile(args)
+
+	if args.output:
+		with open(args.output, 'w', newline='\r\n') as out:
+			WriteHeader(args, font, out)
+	else:
+		WriteHeader(args, font, sys.stdout)
+
+	numGlyphs = len(font['glyphs'])
+	tableBytes = len(font['bitmaps']) + 4 * (font['lastChar'] - font['firstChar'] + 1) + 3 * len(font['kerning'])
+	averageAdvance = float(sum(font['advances'])) / len(font['advances'])
+	print('%s: %d glyphs, %d pages high, %d bytes, average advance %.2f columns (%.0f%% of %d)' % (
+		args.name, numGlyphs, font['numPages'], tableBytes, averageAdvance,
+		100.0 * averageAdvance / font['cellAdvance'], font['cellAdvance']), file=sys.stderr)
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,391 @@
+//!
+//! @file 				TraceReplay.cpp
+//! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @edited 			n/a
+//! @created			2026-10-16
+//! @last-modified 		2026-10-16
+//! @brief 				Replays a trace recorded with BusTrace into the emulator or a real bus, and reports throughput.
+//! @details
+//!						Runs on the host, not the MCU. Build from the repo root dir with either:
+//!
+//!						g++ -O2 -DMCU_PLATFORM=EMULATOR -Ibenchmark -include Config.h tools/TraceReplay.cpp src/*.cpp -o TraceReplay
+//!						g++ -O2 -DMCU_PLATFORM=LINUX -Ibenchmark -include Config.h tools/TraceReplay.cpp src/*.cpp -lpthread -o TraceReplay
+//!
+//!						Run with:
+//!
+//!						./TraceReplay trace.bin [--show] [--repeat N]						(EMULATOR)
+//!						./TraceReplay trace.bin --i2c BUS [--realtime] [--repeat N]			(LINUX)
+//!						./TraceReplay trace.bin --spi BUS CS --dc CHIP LINE [--realtime]	(LINUX)
+//!
+//!						--show prints what each emulated panel ends up showing, --realtime keeps the gaps
+//!						between transactions that were recorded, and --repeat sends the trace N times.
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+// System includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if(MCU_PLATFORM == LINUX)
+	#include <unistd.h>
+#endif
+
+// User includes
+#include "../include/Port.hpp"
+#include "../include/BusTrace.hpp"
+#include "../include/SSD1306.hpp"
+#if(MCU_PLATFORM == EMULATOR)
+	#include "../include/Ssd1306Emulator.hpp"
+#endif
+
+//===============================================================================================//
+//===================================== PRE-COMPILER CHECKS =====================================//
+//===============================================================================================//
+
+#if((MCU_PLATFORM != EMULATOR) && (MCU_PLATFORM != LINUX))
+	#error TraceReplay has to be built with MCU_PLATFORM == EMULATOR or LINUX
+#endif
+
+using namespace MbeddedNinja::MSsd1306;
+
+//===============================================================================================//
+//========================================== DEFINES ============================================//
+//===============================================================================================//
+
+//! @brief		Largest trace file TraceReplay will load.
+#define replayMAX_TRACE_SIZE		(64*1024*1024)
+
+//===============================================================================================//
+//======================================= PRIVATE TYPEDEFS ======================================//
+//===============================================================================================//
+
+//! @brief		Totals for one pass through a trace.
+typedef struct
+{
+	uint32 numTransactions;
+	uint32 numCommandTransactions;
+	uint32 numCommandBytes;
+	uint32 numDataBytes;
+	uint32 numBusBytes;
+	uint32 numErrors;
+	//! @brief		Time of the last transaction, relative to the start of the trace.
+	uint32 lastTimeUs;
+} replayTotals_t;
+
+//===============================================================================================//
+//====================================== PRIVATE VARIABLES ======================================//
+//===============================================================================================//
+
+#if(MCU_PLATFORM == EMULATOR)
+	//! @brief		One emulated panel for each address in the trace.
+	static Ssd1306Emulator *emulators[portEMULATOR_MAX_DEVICES];
+	static uint8 numEmulators = 0;
+#endif
+
+//===============================================================================================//
+//====================================== PRIVATE FUNCTIONS ======================================//
+//===============================================================================================//
+
+//! @brief		Returns a monotonic time in micro-seconds.
+static double NowUs()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec*1000000.0 + (double)now.tv_nsec/1000.0;
+}
+
+//! @brief		Works out how long an I2C bus is busy for, in micro-seconds.
+//! @details	Same model as Ssd1306Benchmark: 9 clocks per byte and 2 per transaction.
+static double I2cBusTimeUs(uint32 numBusBytes, uint32 numTransactions, uint32 busSpeedHz)
+{
+	return ((double)numBusBytes*9.0 + (double)numTransactions*2.0)*1000000.0/(double)busSpeedHz;
+}
+
+//! @brief		Reads a whole file into memory.
+//! @returns	The contents (free() it), or NULL if it couldn't be read.
+static uint8* LoadFile(const char *fileName, uint32 *length)
+{
+	FILE *file;
+	uint8 *data;
+	long size;
+
+	file = fopen(fileName, "rb");
+	if(file == NULL)
+		return NULL;
+
+	if((fseek(file, 0, SEEK_END) != 0) || ((size = ftell(file)) < 0) || (size > replayMAX_TRACE_SIZE))
+	{
+		fclose(file);
+		return NULL;
+	}
+	rewind(file);
+
+	data = (uint8*)malloc(size > 0 ? size : 1);
+	if((data != NULL) && (fread(data, 1, size, file) != (size_t)size))
+	{
+		free(data);
+		data = NULL;
+	}
+
+	fclose(file);
+	*length = (uint32)size;
+	return data;
+}
+
+#if(MCU_PLATFORM == EMULATOR)
+	//! @brief		Attaches an emulated panel for every address in the trace.
+	static void AttachEmulators(Port &port, BusTraceReader &reader)
+	{
+		busTraceRecord_t record;
+		uint8 i;
+
+		reader.Rewind();
+		while(reader.Next(record))
+		{
+			for(i = 0; i < numEmulators; i++)
+			{
+				if(emulators[i]->GetI2cAddress() == record.slaveAddress)
+					break;
+			}
+
+			if(i < numEmulators)
+				continue;
+
+			if(numEmulators >= portEMULATOR_MAX_DEVICES)
+			{
+				printf("Warning: Too many addresses, transactions to 0x%02X will fail.\n", record.slaveAddress);
+				continue;
+			}
+
+			emulators[numEmulators] = new Ssd1306Emulator(record.slaveAddress);
+			port.AttachEmulator(Port::i2cLeft, emulators[numEmulators]);
+			numEmulators++;
+		}
+		reader.Rewind();
+	}
+
+	//! @brief		Prints what an emulated panel shows, one character per pixel.
+	static void ShowEmulator(const Ssd1306Emulator &emulator)
+	{
+		uint8 seg, com;
+
+		printf("Panel 0x%02X:\n", emulator.GetI2cAddress());
+		for(com = 0; com < 8*ssd1306EmuRAM_PAGES; com++)
+		{
+			for(seg = 0; seg < ssd1306EmuRAM_COLS; seg++)
+			{
+				putchar(emulator.GetPixel(seg, com) ? '#' : '.');
+			}
+			putchar('\n');
+		}
+	}
+#endif
+
+//! @brief		Sends every transaction of a trace to the port.
+//! @param		isRealTime		True to wait between transactions for as long as was recorded.
+static void Replay(Port &port, BusTraceReader &reader, bool isRealTime, replayTotals_t *totals)
+{
+	busTraceRecord_t record;
+	Port::ioVector_t vector;
+	uint32 numBytesLeft;
+
+	#if(MCU_PLATFORM == LINUX)
+		double startUs, waitUs;
+
+		startUs = NowUs();
+	#else
+		// Nothing to wait for on the emulator
+		(void)isRealTime;
+	#endif
+
+	reader.Rewind();
+	while(reader.Next(record))
+	{
+		#if(MCU_PLATFORM == LINUX)
+			if(isRealTime)
+			{
+				waitUs = (double)record.timeUs - (NowUs() - startUs);
+				if(waitUs > 0)
+					usleep((useconds_t)waitUs);
+			}
+		#endif
+
+		totals->numTransactions++;
+		totals->numBusBytes += port.GetTransactionOverheadBytes() + record.numBytes;
+		if(record.controlByte & ssd1306DATA_FOLLOWS_BYTE)
+			totals->numDataBytes += record.numBytes;
+		else
+		{
+			totals->numCommandTransactions++;
+			totals->numCommandBytes += record.numBytes;
+		}
+		totals->lastTimeUs = record.timeUs;
+
+		// ioVector_t holds up to 64k, longer payloads (which the driver never makes) go in pieces
+		vector.data = record.data;
+		numBytesLeft = record.numBytes;
+		do
+		{
+			vector.numBytes = (numBytesLeft > 0xFFFF) ? 0xFFFF : (uint16)numBytesLeft;
+			if(port.I2cMasterWriteVectored(record.slaveAddress, record.controlByte, &vector, 1) != Port::TRANSFER_OK)
+				totals->numErrors++;
+			vector.data += vector.numBytes;
+			numBytesLeft -= vector.numBytes;
+		} while(numBytesLeft > 0);
+	}
+}
+
+static void PrintUsage()
+{
+	printf("Usage:\n");
+	#if(MCU_PLATFORM == EMULATOR)
+		printf("  TraceReplay trace.bin [--show] [--repeat N]\n");
+	#else
+		printf("  TraceReplay trace.bin --i2c BUS [--realtime] [--repeat N]\n");
+		printf("  TraceReplay trace.bin --spi BUS CS --dc CHIP LINE [--realtime] [--repeat N]\n");
+	#endif
+}
+
+//===============================================================================================//
+//============================================ MAIN =============================================//
+//===============================================================================================//
+
+int main(int argc, char *argv[])
+{
+	const char *traceFileName = NULL;
+	bool isRealTime = false;
+	bool isShow = false;
+	uint32 numRepeats = 1;
+	uint8 *traceData;
+	uint32 traceLength = 0;
+	replayTotals_t totals;
+	double startUs, elapsedUs, recordedUs;
+	Port port;
+	int i;
+
+	#if(MCU_PLATFORM == LINUX)
+		bool isBusSet = false;
+	#endif
+
+	for(i = 1; i < argc; i++)
+	{
+		if(strcmp(argv[i], "--realtime") == 0)
+			isRealTime = true;
+		else if(strcmp(argv[i], "--show") == 0)
+			isShow = true;
+		else if((strcmp(argv[i], "--repeat") == 0) && (i + 1 < argc))
+			numRepeats = (uint32)atoi(argv[++i]);
+		#if(MCU_PLATFORM == LINUX)
+			else if((strcmp(argv[i], "--i2c") == 0) && (i + 1 < argc))
+			{
+				port.SetBusNumber(Port::i2cLeft, (uint8)atoi(argv[++i]));
+				isBusSet = true;
+			}
+			else if((strcmp(argv[i], "--spi") == 0) && (i + 2 < argc))
+			{
+				port.SetInterface(Port::INTERFACE_SPI);
+				port.SetSpiDevice(Port::i2cLeft, (uint8)atoi(argv[i + 1]), (uint8)atoi(argv[i + 2]));
+				i += 2;
+				isBusSet = true;
+			}
+			else if((strcmp(argv[i], "--dc") == 0) && (i + 2 < argc))
+			{
+				port.SetDcGpio(Port::i2cLeft, (uint8)atoi(argv[i + 1]), (uint8)atoi(argv[i + 2]));
+				i += 2;
+			}
+		#endif
+		else if((argv[i][0] != '-') && (traceFileName == NULL))
+			traceFileName = argv[i];
+		else
+		{
+			PrintUsage();
+			return 2;
+		}
+	}
+
+	if(traceFileName == NULL)
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	#if(MCU_PLATFORM == LINUX)
+		if(!isBusSet)
+		{
+			printf("Error: Give the bus to replay onto with --i2c or --spi.\n");
+			return 2;
+		}
+	#endif
+
+	traceData = LoadFile(traceFileName, &traceLength);
+	if(traceData == NULL)
+	{
+		printf("Error: Couldn't read %s.\n", traceFileName);
+		return 2;
+	}
+
+	BusTraceReader reader(traceData, traceLength);
+	if(!reader.IsValid())
+	{
+		printf("Error: %s isn't a version %u bus trace.\n", traceFileName, busTraceVERSION);
+		free(traceData);
+		return 2;
+	}
+
+	#if(MCU_PLATFORM == EMULATOR)
+		AttachEmulators(port, reader);
+	#else
+		port.I2cStart();
+	#endif
+
+	memset(&totals, 0, sizeof(totals));
+	startUs = NowUs();
+	for(i = 0; i < (int)numRepeats; i++)
+		Replay(port, reader, isRealTime, &totals);
+	elapsedUs = NowUs() - startUs;
+
+	// Time the recording spanned, for all the repeats
+	recordedUs = (double)totals.lastTimeUs*numRepeats;
+
+	printf("Trace:     %u transactions (%u command, %u data), %u command bytes, %u data bytes\n",
+		totals.numTransactions, totals.numCommandTransactions, totals.numTransactions - totals.numCommandTransactions,
+		totals.numCommandBytes, totals.numDataBytes);
+	printf("Bus bytes: %u, including %u bytes of address and control per transaction\n",
+		totals.numBusBytes, port.GetTransactionOverheadBytes());
+	if(recordedUs > 0)
+	{
+		printf("Recorded:  %10.1fms, %10.1f kB/s, %10.1f transactions/s\n",
+			recordedUs/1000.0, totals.numBusBytes*1000.0/recordedUs, totals.numTransactions*1000000.0/recordedUs);
+	}
+	if(elapsedUs > 0)
+	{
+		printf("Replayed:  %10.1fms, %10.1f kB/s, %10.1f transactions/s, %u errors\n",
+			elapsedUs/1000.0, totals.numBusBytes*1000.0/elapsedUs, totals.numTransactions*1000000.0/elapsedUs, totals.numErrors);
+	}
+	printf("I2C bus time at 100kHz: %.1fms, 400kHz: %.1fms, 1MHz: %.1fms\n",
+		I2cBusTimeUs(totals.numBusBytes, totals.numTransactions, 100000)/1000.0,
+		I2cBusTimeUs(totals.numBusBytes, totals.numTransactions, 400000)/1000.0,
+		I2cBusTimeUs(totals.numBusBytes, totals.numTransactions, 1000000)/1000.0);
+
+	#if(MCU_PLATFORM == EMULATOR)
+		uint8 j;
+
+		for(j = 0; j < numEmulators; j++)
+		{
+			if(isShow)
+				ShowEmulator(*emulators[j]);
+			delete emulators[j];
+		}
+	#else
+		(void)isShow;
+	#endif
+
+	free(traceData);
+
+	return (totals.numErrors == 0) ? 0 : 1;
+}
+
+// EOF